@@ -13,12 +13,13 @@ Benchmark::Benchmark(benchmark::Cores &&cores, const std::uint16_t iterations, s
                      const mx::synchronization::protocol preferred_synchronization_method,
                      const bool print_tree_statistics, const bool check_tree, std::string &&result_file_name,
                      std::string &&statistic_file_name, std::string &&tree_file_name, std::string &&nodes_file_name,
-                     const bool profile)
+                     const bool profile, const bool use_coroutines)
     : _cores(std::move(cores)), _iterations(iterations), _node_isolation_level(node_isolation_level),
       _preferred_synchronization_method(preferred_synchronization_method),
       _print_tree_statistics(print_tree_statistics), _check_tree(check_tree),
       _result_file_name(std::move(result_file_name)), _statistic_file_name(std::move(statistic_file_name)),
-      _tree_file_name(std::move(tree_file_name)), _nodes_file_name(std::move(nodes_file_name)), _profile(profile)
+      _tree_file_name(std::move(tree_file_name)), _nodes_file_name(std::move(nodes_file_name)), _profile(profile),
+      _use_coroutines(use_coroutines)
 {
     if (use_performance_counter)
     {
@@ -102,7 +103,8 @@ void Benchmark::start()
                  ++target_worker_id)
             {
                 auto *request_scheduler = mx::tasking::runtime::new_task<RequestSchedulerTask>(
-                    worker_id, target_worker_id, this->_workload, this->_cores.current(), this->_tree.get(), this);
+                    worker_id, target_worker_id, this->_workload, this->_cores.current(), this->_tree.get(), this,
+                    this->_use_coroutines);
                 mx::tasking::runtime::spawn(*request_scheduler, worker_id);
                 this->_request_scheduler.push_back(request_scheduler);
             }
@@ -158,15 +160,33 @@ void Benchmark::requests_finished()
         mx::tasking::runtime::stop();
         std::cout << result << std::endl;
 
+        // Deleted nodes that were not reclaimed yet; the memory held by the reclamation scheme.
+        const auto is_reclaiming_memory =
+            mx::tasking::runtime::configuration().memory_reclamation() != mx::tasking::config::None;
+        const auto peak_garbage = mx::tasking::runtime::peak_garbage();
+        const auto peak_garbage_bytes = peak_garbage * db::index::blinktree::config::node_size();
+        if (is_reclaiming_memory)
+        {
+            std::cout << "garbage: " << mx::tasking::runtime::count_garbage() << " nodes / peak " << peak_garbage
+                      << " nodes (" << peak_garbage_bytes / double(1024U * 1024U) << " MB)" << std::endl;
+        }
+
         // Dump results to file.
         if (this->_result_file_name.empty() == false)
         {
+            auto result_json = result.to_json();
+            if (is_reclaiming_memory)
+            {
+                result_json["peak-garbage-nodes"] = peak_garbage;
+                result_json["peak-garbage-bytes"] = peak_garbage_bytes;
+            }
+
             std::ofstream result_file_stream(this->_result_file_name, std::ofstream::app);
-            result_file_stream << result.to_json().dump() << std::endl;
+            result_file_stream << result_json.dump() << std::endl;
         }
 
         // Dump statistics to file.
-        if constexpr (mx::tasking::config::is_use_task_counter())
+        if (result.task_counter().empty() == false)
         {
             if (this->_statistic_file_name.empty() == false)
             {
@@ -206,6 +226,16 @@ void Benchmark::requests_finished()
                         double(result.operation_count());
                 }
 
+                /// Distances chosen when tuning the automatic prefetch distance.
+                const auto prefetch_distances = mx::tasking::runtime::prefetch_distance_histogram();
+                for (auto distance = 0U; distance < prefetch_distances.size(); ++distance)
+                {
+                    if (prefetch_distances[distance] > 0U)
+                    {
+                        result_json["prefetch-distances"][std::to_string(distance)] = prefetch_distances[distance];
+                    }
+                }
+
                 statistic_file_stream << result_json.dump(2) << std::endl;
             }
         }
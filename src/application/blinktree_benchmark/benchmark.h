@@ -27,7 +27,7 @@ public:
               mx::synchronization::isolation_level node_isolation_level,
               mx::synchronization::protocol preferred_synchronization_method, bool print_tree_statistics,
               bool check_tree, std::string &&result_file_name, std::string &&statistic_file_name,
-              std::string &&tree_file_name, std::string &&nodes_file_name, bool profile);
+              std::string &&tree_file_name, std::string &&nodes_file_name, bool profile, bool use_coroutines);
 
     ~Benchmark() noexcept override = default;
 
@@ -90,6 +90,9 @@ private:
     // If true, use idle profiling.
     const bool _profile;
 
+    // If true, lookups are executed as coroutines.
+    const bool _use_coroutines;
+
     // Number of open request tasks; used for tracking the benchmark.
     alignas(mx::system::cache::line_size()) std::atomic_uint16_t _open_requests = 0;
 
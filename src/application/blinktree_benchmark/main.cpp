@@ -16,7 +16,8 @@ using namespace application::blinktree_benchmark;
  *
  * @return Instance of the benchmark and parameters for tasking runtime.
  */
-std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool> create_benchmark(int count_arguments, char **arguments);
+std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool, mx::tasking::runtime_config> create_benchmark(
+    int count_arguments, char **arguments);
 
 /**
  * Starts the benchmark.
@@ -33,7 +34,8 @@ int main(int count_arguments, char **arguments)
         std::cout << "[Warn] NUMA balancing may be enabled, set '/proc/sys/kernel/numa_balancing' to '0'" << std::endl;
     }
 
-    auto [benchmark, prefetch_distance, use_system_allocator] = create_benchmark(count_arguments, arguments);
+    auto [benchmark, prefetch_distance, use_system_allocator, tasking_config] =
+        create_benchmark(count_arguments, arguments);
     if (benchmark == nullptr)
     {
         return 1;
@@ -43,7 +45,7 @@ int main(int count_arguments, char **arguments)
 
     while ((cores = benchmark->core_set()))
     {
-        auto runtime = mx::tasking::runtime_guard{use_system_allocator, cores, prefetch_distance};
+        auto runtime = mx::tasking::runtime_guard{use_system_allocator, cores, prefetch_distance, tasking_config};
         benchmark->start();
     }
 
@@ -52,7 +54,8 @@ int main(int count_arguments, char **arguments)
     return 0;
 }
 
-std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool> create_benchmark(int count_arguments, char **arguments)
+std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool, mx::tasking::runtime_config> create_benchmark(
+    int count_arguments, char **arguments)
 {
     // Set up arguments.
     argparse::ArgumentParser argument_parser("blinktree_benchmark");
@@ -102,6 +105,23 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool> create_benchmark(in
         .help("Let the tasking layer decide the synchronization primitive.")
         .implicit_value(true)
         .default_value(false);
+    argument_parser.add_argument("--coroutines")
+        .help("Run lookups as coroutines that suspend while prefetching tree nodes (requires optimistic "
+              "synchronization).")
+        .implicit_value(true)
+        .default_value(false);
+    argument_parser.add_argument("--shared-queues")
+        .help("Dispatch tasks that may run on any worker to queues shared by all workers of a NUMA region.")
+        .implicit_value(true)
+        .default_value(false);
+    argument_parser.add_argument("--memory-reclamation")
+        .help("Reclamation of deleted optimistic nodes: none, read (epoch per read), periodic (epoch every "
+              "interval), or qsbr (quiescent states on task buffer refill).")
+        .default_value(std::string("none"));
+    argument_parser.add_argument("--task-buffer-size")
+        .help("Number of tasks a worker fetches from its queues at once.")
+        .default_value(std::uint16_t(mx::tasking::config::task_buffer_size()))
+        .action([](const std::string &value) { return std::uint16_t(std::stoi(value)); });
     argument_parser.add_argument("--print-stats")
         .help("Print tree statistics after every iteration.")
         .implicit_value(true)
@@ -152,7 +172,7 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool> create_benchmark(in
     catch (std::runtime_error &e)
     {
         std::cout << argument_parser << std::endl;
-        return std::make_tuple(nullptr, mx::tasking::PrefetchDistance{0U}, false);
+        return std::make_tuple(nullptr, mx::tasking::PrefetchDistance{0U}, false, mx::tasking::runtime_config{});
     }
 
     auto order =
@@ -181,6 +201,26 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool> create_benchmark(in
         preferred_synchronization_method = mx::synchronization::protocol::None;
     }
 
+    auto memory_reclamation = mx::tasking::config::None;
+    const auto memory_reclamation_name = argument_parser.get<std::string>("--memory-reclamation");
+    if (memory_reclamation_name == "read")
+    {
+        memory_reclamation = mx::tasking::config::UpdateEpochOnRead;
+    }
+    else if (memory_reclamation_name == "periodic")
+    {
+        memory_reclamation = mx::tasking::config::UpdateEpochPeriodically;
+    }
+    else if (memory_reclamation_name == "qsbr")
+    {
+        memory_reclamation = mx::tasking::config::QuiescentStateBased;
+    }
+    else if (memory_reclamation_name != "none")
+    {
+        std::cout << argument_parser << std::endl;
+        return std::make_tuple(nullptr, mx::tasking::PrefetchDistance{0U}, false, mx::tasking::runtime_config{});
+    }
+
     // Create the benchmark.
     auto *benchmark =
         new Benchmark(std::move(cores), argument_parser.get<std::uint16_t>("-i"), std::move(workload_files[0]),
@@ -188,7 +228,8 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool> create_benchmark(in
                       preferred_synchronization_method, argument_parser.get<bool>("--print-stats"),
                       argument_parser.get<bool>("--disable-check") == false, argument_parser.get<std::string>("-o"),
                       argument_parser.get<std::string>("-os"), argument_parser.get<std::string>("-ot"),
-                      argument_parser.get<std::string>("--out-nodes"), argument_parser.get<bool>("--profiling"));
+                      argument_parser.get<std::string>("--out-nodes"), argument_parser.get<bool>("--profiling"),
+                      argument_parser.get<bool>("--coroutines"));
 
     auto prefetch_distance = mx::tasking::PrefetchDistance{argument_parser.get<std::uint8_t>("-pd")};
     if (argument_parser.get<bool>("--prefetch4me"))
@@ -196,5 +237,18 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance, bool> create_benchmark(in
         prefetch_distance = mx::tasking::PrefetchDistance::make_automatic();
     }
 
-    return std::make_tuple(benchmark, prefetch_distance, argument_parser.get<bool>("--system-allocator"));
+    auto tasking_config = mx::tasking::runtime_config{};
+    if (argument_parser.get<bool>("--shared-queues"))
+    {
+        tasking_config.queue(mx::tasking::config::queue_backend::NUMAShared);
+    }
+    tasking_config.task_buffer_size(argument_parser.get<std::uint16_t>("--task-buffer-size"));
+    tasking_config.memory_reclamation(memory_reclamation);
+    if (argument_parser.get<std::string>("-os").empty() == false)
+    {
+        tasking_config.use_task_counter(true);
+    }
+
+    return std::make_tuple(benchmark, prefetch_distance, argument_parser.get<bool>("--system-allocator"),
+                           tasking_config);
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <db/index/blinktree/b_link_tree.h>
 #include <db/index/blinktree/config.h>
+#include <db/index/blinktree/coroutine_lookup_task.h>
 #include <db/index/blinktree/insert_value_task.h>
 #include <db/index/blinktree/lookup_task.h>
 #include <db/index/blinktree/update_task.h>
@@ -179,8 +180,9 @@ class RequestSchedulerTask final : public mx::tasking::TaskInterface
 public:
     RequestSchedulerTask(const std::uint16_t worker_id, benchmark::Workload &workload,
                          const mx::util::core_set &core_set,
-                         db::index::blinktree::BLinkTree<std::uint64_t, std::int64_t> *tree, Listener *listener)
-        : _tree(tree), _listener(listener)
+                         db::index::blinktree::BLinkTree<std::uint64_t, std::int64_t> *tree, Listener *listener,
+                         const bool use_coroutines)
+        : _tree(tree), _listener(listener), _use_coroutines(use_coroutines)
     {
         this->annotate(mx::tasking::priority::low);
         this->annotate(mx::tasking::annotation::access_intention::write);
@@ -213,6 +215,16 @@ public:
                     task->annotate(_tree->height() > 1U ? mx::tasking::annotation::access_intention::readonly
                                                         : mx::tasking::annotation::access_intention::write);
                 }
+                else if (tuple == benchmark::NumericTuple::LOOKUP && this->is_use_coroutine_lookup())
+                {
+                    /// Coroutines synchronize on their own and are not annotated with the root.
+                    auto *lookup_task = mx::tasking::runtime::new_task<
+                        db::index::blinktree::CoroutineLookupTask<std::uint64_t, std::int64_t, RequestContainer>>(
+                        worker_id, tuple.key(), _tree->root(), request_container);
+                    lookup_task->annotate(worker_id);
+                    mx::tasking::runtime::spawn(*lookup_task, worker_id);
+                    continue;
+                }
                 else if (tuple == benchmark::NumericTuple::LOOKUP)
                 {
                     task = mx::tasking::runtime::new_task<
@@ -253,5 +265,15 @@ private:
 
     // Benchmark listener to notify on requests are done.
     Listener *_listener;
+
+    // If true, lookups are executed as coroutines (when the tree is synchronized optimistically).
+    const bool _use_coroutines;
+
+    [[nodiscard]] bool is_use_coroutine_lookup() const noexcept
+    {
+        return _use_coroutines &&
+               db::index::blinktree::CoroutineLookupTask<std::uint64_t, std::int64_t, RequestContainer>::is_supported(
+                   _tree->root().synchronization_primitive());
+    }
 };
 } // namespace application::blinktree_benchmark
\ No newline at end of file
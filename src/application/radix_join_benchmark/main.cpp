@@ -16,7 +16,8 @@ using namespace application::rjbenchmark;
  *
  * @return Instance of the benchmark and parameters for tasking runtime.
  */
-std::tuple<Benchmark *, mx::tasking::PrefetchDistance> create_benchmark(int count_arguments, char **arguments);
+std::tuple<Benchmark *, mx::tasking::PrefetchDistance, mx::tasking::runtime_config> create_benchmark(
+    int count_arguments, char **arguments);
 
 /**
  * Starts the benchmark.
@@ -33,7 +34,7 @@ int main(int count_arguments, char **arguments)
         std::cout << "[Warn] NUMA balancing may be enabled, set '/proc/sys/kernel/numa_balancing' to '0'" << std::endl;
     }
 
-    auto [benchmark, prefetch_distance] = create_benchmark(count_arguments, arguments);
+    auto [benchmark, prefetch_distance, tasking_config] = create_benchmark(count_arguments, arguments);
     if (benchmark == nullptr)
     {
         return 1;
@@ -43,7 +44,7 @@ int main(int count_arguments, char **arguments)
 
     while ((cores = benchmark->core_set()))
     {
-        auto _ = mx::tasking::runtime_guard{false, cores, prefetch_distance};
+        auto _ = mx::tasking::runtime_guard{false, cores, prefetch_distance, tasking_config};
         benchmark->start();
     }
 
@@ -52,7 +53,8 @@ int main(int count_arguments, char **arguments)
     return 0;
 }
 
-std::tuple<Benchmark *, mx::tasking::PrefetchDistance> create_benchmark(int count_arguments, char **arguments)
+std::tuple<Benchmark *, mx::tasking::PrefetchDistance, mx::tasking::runtime_config> create_benchmark(
+    int count_arguments, char **arguments)
 {
     // Set up arguments.
     argparse::ArgumentParser argument_parser("blinktree_benchmark");
@@ -90,6 +92,14 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance> create_benchmark(int coun
         .help("Enables automatic prefetching. When set, the fixed prefetch distance will be discarded.")
         .implicit_value(true)
         .default_value(false);
+    argument_parser.add_argument("--shared-queues")
+        .help("Dispatch tasks that may run on any worker to queues shared by all workers of a NUMA region.")
+        .implicit_value(true)
+        .default_value(false);
+    argument_parser.add_argument("--task-buffer-size")
+        .help("Number of tasks a worker fetches from its queues at once.")
+        .default_value(std::uint16_t(mx::tasking::config::task_buffer_size()))
+        .action([](const std::string &value) { return std::uint16_t(std::stoi(value)); });
     argument_parser.add_argument("-o", "--out")
         .help("Name of the file, the results will be written to.")
         .default_value(std::string(""));
@@ -102,7 +112,7 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance> create_benchmark(int coun
     catch (std::runtime_error &e)
     {
         std::cout << argument_parser << std::endl;
-        return std::make_tuple(nullptr, mx::tasking::PrefetchDistance{0U});
+        return std::make_tuple(nullptr, mx::tasking::PrefetchDistance{0U}, mx::tasking::runtime_config{});
     }
 
     auto order =
@@ -123,5 +133,12 @@ std::tuple<Benchmark *, mx::tasking::PrefetchDistance> create_benchmark(int coun
         prefetch_distance = mx::tasking::PrefetchDistance::make_automatic();
     }
 
-    return std::make_tuple(benchmark, prefetch_distance);
+    auto tasking_config = mx::tasking::runtime_config{};
+    if (argument_parser.get<bool>("--shared-queues"))
+    {
+        tasking_config.queue(mx::tasking::config::queue_backend::NUMAShared);
+    }
+    tasking_config.task_buffer_size(argument_parser.get<std::uint16_t>("--task-buffer-size"));
+
+    return std::make_tuple(benchmark, prefetch_distance, tasking_config);
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "udf.h"
+#include <algorithm>
 #include <argparse/argparse.hpp>
 #include <cstdint>
 #include <db/config.h>
@@ -15,6 +16,7 @@
 #include <filesystem>
 #include <fmt/core.h>
 #include <iostream>
+#include <mx/system/cpu.h>
 #include <mx/tasking/runtime.h>
 #include <mx/util/logger.h>
 #include <spdlog/sinks/basic_file_sink.h>
@@ -167,11 +169,22 @@ int main(const int count_arguments, char **arguments)
         auto is_db_booted = false;
         do
         {
-            auto cores = mx::util::core_set::build(configuration.count_cores(), configuration.cores_order());
+            /// When workers can be resized at runtime, workers are created for all cores
+            /// and the configured number of cores is activated afterwards.
+            const auto count_worker_cores =
+                mx::tasking::config::is_allow_resizing_workers()
+                    ? std::min<std::uint16_t>(std::max(configuration.count_cores(), mx::system::cpu::count_cores()),
+                                              mx::tasking::config::max_cores())
+                    : configuration.count_cores();
+            auto cores = mx::util::core_set::build(count_worker_cores, configuration.cores_order());
             mx::util::Logger::info(fmt::format("Utilizing {} cores: {}.", cores.count_cores(), cores.to_string()));
 
-            auto runtime = mx::tasking::runtime_guard{true, cores, prefetch_distance};
-            if (mx::tasking::config::is_collect_task_traces() ||
+            auto runtime = mx::tasking::runtime_guard{true, cores, prefetch_distance, configuration.tasking()};
+            if constexpr (mx::tasking::config::is_allow_resizing_workers())
+            {
+                configuration.count_cores(mx::tasking::runtime::resize(configuration.count_cores()));
+            }
+            if (configuration.tasking().is_collect_task_traces() ||
                 mx::tasking::config::is_monitor_task_cycles_for_prefetching())
             {
                 mx::tasking::runtime::register_task_for_trace(db::config::task_id_planning(), "Planning");
@@ -33,7 +33,7 @@ template <typename P> class InterimResult
             stream << "\t" << value_per_operation << " " << name << "/op";
         }
 
-        if constexpr (mx::tasking::config::is_use_task_counter())
+        if (result.task_counter().empty() == false)
         {
             const auto &task_counter = result.task_counter();
             stream << "\t"
@@ -56,6 +56,8 @@ template <typename P> class InterimResult
                    << task_counter.at(mx::tasking::profiling::TaskCounter::Counter::FilledBuffer).sum() /
                           double(result.operation_count())
                    << " fills/op";
+            stream << "\t" << mx::tasking::profiling::TaskCounter::remote_access_ratio(task_counter)
+                   << " remote-data-ratio";
         }
 
         return stream << std::flush;
@@ -104,7 +106,7 @@ public:
             json[name] = value / double(operation_count());
         }
 
-        if constexpr (mx::tasking::config::is_use_task_counter())
+        if (_task_counter.empty() == false)
         {
             json["executed-writer"] =
                 _task_counter.at(mx::tasking::profiling::TaskCounter::Counter::ExecutedWriter).sum() /
@@ -121,6 +123,7 @@ public:
             json["filled-buffer"] =
                 _task_counter.at(mx::tasking::profiling::TaskCounter::Counter::ExecutedWriter).sum() /
                 double(operation_count());
+            json["remote-data-ratio"] = mx::tasking::profiling::TaskCounter::remote_access_ratio(_task_counter);
         }
 
         return json;
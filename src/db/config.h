@@ -19,6 +19,49 @@ public:
      */
     [[nodiscard]] static constexpr auto prefetch_iterations() { return 16U; }
 
+    /**
+     * @return True, if workers should pull morsels of tiles when scanning tables, instead of
+     *  scanning the tiles mapped to them. Morsels balance the load when tiles differ in cost,
+     *  but tiles are processed by the pulling worker instead of the worker owning the tile.
+     *  Opt-in; default of the runtime switch (.set morsel_scans).
+     */
+    [[nodiscard]] static constexpr auto is_use_morsel_driven_scans() { return false; }
+
+    /**
+     * @return Number of tiles per morsel before the size is adapted to the cost of a tile.
+     */
+    [[nodiscard]] static constexpr auto initial_tiles_per_morsel() { return 4U; }
+
+    /**
+     * @return True, if results of queries should be sent to the client in chunks while the
+     *  query is running, instead of gathering the whole result before sending it.
+     */
+    [[nodiscard]] static constexpr auto is_stream_query_results() { return true; }
+
+    /**
+     * @return Number of records of a result chunk that is sent while the query is running.
+     */
+    [[nodiscard]] static constexpr auto streamed_result_chunk_records() { return 1U << 16U; }
+
+    /**
+     * @return Number of bytes the socket of a client may hold before sending results
+     *  pauses until the client caught up.
+     */
+    [[nodiscard]] static constexpr auto max_pending_result_bytes() { return 1U << 20U; }
+
+    /**
+     * @return Number of sealed result chunks waiting for the client before the producers
+     *  of the query are throttled (independent of dataflow backpressure).
+     */
+    [[nodiscard]] static constexpr auto max_sealed_result_chunks() { return 4U; }
+
+    /**
+     * @return Minimal and maximal time (in microseconds) a result sender waits before it
+     *  checks the socket of a client again that did not catch up.
+     */
+    [[nodiscard]] static constexpr auto min_result_send_backoff() { return 16U; }
+    [[nodiscard]] static constexpr auto max_result_send_backoff() { return 2048U; }
+
     /**
      * @return True, if prevalent attributes should be preferred for prefetching.
      */
@@ -6,6 +6,7 @@
 #include <db/config.h>
 #include <db/topology/physical_schema.h>
 #include <mx/memory/alignment_helper.h>
+#include <mx/memory/slab_allocator.h>
 #include <mx/system/cache.h>
 #include <mx/tasking/runtime.h>
 #include <optional>
@@ -31,15 +32,71 @@ public:
 
     [[nodiscard]] static mx::resource::ptr make(const topology::PhysicalSchema &schema, const bool is_temporary,
                                                 const std::uint16_t worker_id)
+    {
+        return PaxTile::make(schema, is_temporary, worker_id, nullptr);
+    }
+
+    /**
+     * Creates a tile. Temporary tiles are allocated from the given arena (if any),
+     * which recycles the tiles of the same schema worker-locally and releases
+     * them at once when the query finished.
+     *
+     * @param schema Schema of the records.
+     * @param is_temporary True, if the tile is needed only for query execution.
+     * @param worker_id Worker the tile is mapped to.
+     * @param arena Arena of the query, may be nullptr.
+     * @return Resource pointer to the tile.
+     */
+    [[nodiscard]] static mx::resource::ptr make(const topology::PhysicalSchema &schema, const bool is_temporary,
+                                                const std::uint16_t worker_id, mx::memory::slab::Arena *arena)
     {
         /// Size for tile object + size for records.
         const auto tile_size = sizeof(PaxTile) + PaxTile::size(schema);
 
-        return mx::tasking::runtime::new_resource<data::PaxTile>(
+        if (is_temporary && arena != nullptr)
+        {
+            auto *memory = arena->allocate(mx::tasking::runtime::worker_id(), tile_size);
+            if (memory != nullptr) [[likely]]
+            {
+                return mx::tasking::runtime::to_resource<data::PaxTile>(
+                    new (memory) PaxTile(AllocationType::TemporaryResource, schema, arena),
+                    mx::resource::annotation{worker_id, mx::synchronization::isolation_level::Exclusive,
+                                             mx::synchronization::protocol::Queue});
+            }
+        }
+
+        auto tile = mx::tasking::runtime::new_resource<data::PaxTile>(
             tile_size,
             mx::resource::annotation{worker_id, mx::synchronization::isolation_level::Exclusive,
                                      mx::synchronization::protocol::Queue},
             static_cast<AllocationType>(is_temporary), schema);
+
+        /// Temporary tiles that did not fit into the arena count for the query, too.
+        if (is_temporary && arena != nullptr)
+        {
+            arena->budget().charge(tile_size);
+            tile.get<PaxTile>()->_charged_budget = &arena->budget();
+        }
+
+        return tile;
+    }
+
+    /**
+     * Creates a persistent tile in memory that is managed by the caller
+     * (e.g., tiles of a table that are interleaved or replicated).
+     *
+     * @param schema Schema of the records.
+     * @param memory Memory of at least sizeof(PaxTile) + PaxTile::size(schema) bytes.
+     * @param worker_id Worker the tile is mapped to.
+     * @return Resource pointer to the tile.
+     */
+    [[nodiscard]] static mx::resource::ptr make_in_place(const topology::PhysicalSchema &schema, void *memory,
+                                                         const std::uint16_t worker_id)
+    {
+        return mx::tasking::runtime::to_resource<data::PaxTile>(
+            new (memory) PaxTile(AllocationType::Resource, schema),
+            mx::resource::annotation{worker_id, mx::synchronization::isolation_level::Exclusive,
+                                     mx::synchronization::protocol::Queue});
     }
 
     [[nodiscard]] static mx::resource::ptr make_for_client(const topology::PhysicalSchema &schema)
@@ -57,6 +114,36 @@ public:
     {
     }
 
+    constexpr PaxTile(const AllocationType allocation_type, const topology::PhysicalSchema &schema,
+                      mx::memory::slab::Arena *arena) noexcept
+        : _schema(schema), _allocation_type(allocation_type), _arena(arena)
+    {
+    }
+
+    /**
+     * Frees a temporary tile, either by recycling it in the arena
+     * it was allocated from or by deleting the resource.
+     *
+     * @param tile Tile to free.
+     */
+    static void release(const mx::resource::ptr tile)
+    {
+        auto *pax_tile = tile.get<PaxTile>();
+        if (pax_tile->_arena != nullptr)
+        {
+            pax_tile->_arena->free(mx::tasking::runtime::worker_id(), static_cast<void *>(pax_tile),
+                                   sizeof(PaxTile) + PaxTile::size(pax_tile->_schema));
+        }
+        else
+        {
+            if (pax_tile->_charged_budget != nullptr)
+            {
+                pax_tile->_charged_budget->release(sizeof(PaxTile) + PaxTile::size(pax_tile->_schema));
+            }
+            mx::tasking::runtime::delete_resource<data::PaxTile>(tile);
+        }
+    }
+
     void size(const std::uint32_t size) noexcept { _size = size; }
 
     [[nodiscard]] void *begin() noexcept { return static_cast<void *>(this + 1U); }
@@ -128,5 +215,11 @@ private:
     /// specifically for clients (implicit temporary),
     /// or persisted resources (when used as store for a table).
     const AllocationType _allocation_type;
+
+    /// Arena the (temporary) tile was allocated from, if any.
+    mx::memory::slab::Arena *_arena{nullptr};
+
+    /// Budget of the query the (temporary) tile is charged to, if it did not fit into the arena.
+    mx::memory::Budget *_charged_budget{nullptr};
 };
 } // namespace db::data
\ No newline at end of file
@@ -15,9 +15,9 @@ public:
                              mx::tasking::dataflow::EmitterInterface<execution::RecordSet> &graph,
                              mx::tasking::dataflow::NodeInterface<execution::RecordSet> *node)
         : _worker_id(worker_id), _schema(schema), _graph(graph), _node(node),
-          _record_set(RecordSet::make_record_set(_schema, _worker_id)),
+          _record_set(RecordSet::make_record_set(_schema, _worker_id, _graph.slab_arena())),
           _prefetch_descriptor(make_prefetch_descriptor(node)),
-          _boundness(node->out()->annotation().resource_boundness())
+          _boundness(node->out()->annotation().resource_boundness()), _consumer_trace_id(node->out()->trace_id())
     {
     }
 
@@ -47,6 +47,23 @@ protected:
     /// Resource boundness.
     const enum mx::tasking::annotation::resource_boundness _boundness;
 
+    /// Trace id of the node consuming the emitted record sets.
+    const std::uint64_t _consumer_trace_id;
+
+    /**
+     * @return The boundness annotated to the consuming node or, if the
+     *  node is not annotated, the boundness classified by the runtime.
+     */
+    [[nodiscard]] enum mx::tasking::annotation::resource_boundness boundness() const noexcept
+    {
+        if (_boundness != mx::tasking::annotation::resource_boundness::mixed)
+        {
+            return _boundness;
+        }
+
+        return mx::tasking::runtime::resource_boundness(_consumer_trace_id);
+    }
+
     [[nodiscard]] static mx::tasking::PrefetchDescriptor make_prefetch_descriptor(
         mx::tasking::dataflow::NodeInterface<execution::RecordSet> *emitting_node)
     {
@@ -101,14 +118,14 @@ private:
 
             if constexpr (mx::tasking::config::is_consider_resource_bound_workers())
             {
-                annotation.set(_boundness);
+                annotation.set(this->boundness());
             }
 
             /// Steal the (written) record set and emit it as token to the graph.
             auto token = execution::RecordToken{std::move(_record_set), annotation};
             _graph.emit(_worker_id, _node, std::move(token));
 
-            _record_set = execution::RecordSet::make_record_set(_schema, _worker_id);
+            _record_set = execution::RecordSet::make_record_set(_schema, _worker_id, _graph.slab_arena());
         }
 
         return _record_set.tile().get();
@@ -167,7 +184,7 @@ public:
 
             if constexpr (mx::tasking::config::is_consider_resource_bound_workers())
             {
-                annotation.set(_boundness);
+                annotation.set(this->boundness());
             }
 
             /// Steal the (written) record set and emit it as token to the graph.
@@ -177,7 +194,7 @@ public:
 
             if (is_create_new_record_set)
             {
-                _record_set = execution::RecordSet::make_record_set(_schema, _worker_id);
+                _record_set = execution::RecordSet::make_record_set(_schema, _worker_id, _graph.slab_arena());
             }
         }
     }
@@ -8,6 +8,8 @@
 #include <flounder/program.h>
 #include <flounder/statement.h>
 #include <functional>
+#include <mx/memory/budget.h>
+#include <mx/memory/slab_allocator.h>
 #include <mx/tasking/task.h>
 #include <mx/tasking/task_squad.h>
 
@@ -60,16 +62,44 @@ public:
     using create_hash_callback_t =
         std::function<flounder::Register(flounder::Program &, flounder::Register, std::uint32_t)>;
 
-    AbstractTable(Descriptor descriptor) noexcept : _descriptor(descriptor) {}
+    AbstractTable(Descriptor descriptor, mx::memory::slab::Arena *slab_arena = nullptr) noexcept
+        : _descriptor(descriptor), _slab_arena(slab_arena)
+    {
+    }
 
     ~AbstractTable() noexcept override = default;
 
     [[nodiscard]] const Descriptor &descriptor() const noexcept { return _descriptor; }
 
+    /**
+     * @return Arena of the query, the table is allocated from, or nullptr.
+     */
+    [[nodiscard]] mx::memory::slab::Arena *slab_arena() const noexcept { return _slab_arena; }
+
+    /**
+     * @return True, if the memory of the table is released with the arena of the query.
+     */
+    [[nodiscard]] bool is_arena_allocated() const noexcept { return _slab_arena != nullptr; }
+
+    /**
+     * Tables of a query that did not fit into its arena are charged to the budget
+     * of the query; the charge is released when the table is freed.
+     *
+     * @param budget Budget the table is charged to.
+     */
+    void charged_budget(mx::memory::Budget *budget) noexcept { _charged_budget = budget; }
+    [[nodiscard]] mx::memory::Budget *charged_budget() const noexcept { return _charged_budget; }
+
     virtual void initialize_empty() = 0;
 
 private:
     Descriptor _descriptor;
+
+    /// Arena of the query, the table is allocated from.
+    mx::memory::slab::Arena *_slab_arena;
+
+    /// Budget the table is charged to, if allocated outside of the arena.
+    mx::memory::Budget *_charged_budget{nullptr};
 };
 
 class InitializeTableTask final : public mx::tasking::TaskInterface
@@ -2,14 +2,24 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <mx/memory/slab_allocator.h>
+#include <mx/tasking/runtime.h>
 #include <utility>
 #include <vector>
 
 namespace db::execution::compilation::hashtable {
+/**
+ * Allocates entries from chunks of 1MB. When the allocator has an arena of the
+ * query, chunks are taken from the arena of the calling worker and released
+ * with the query.
+ */
 class ChainEntryAllocator
 {
 public:
-    ChainEntryAllocator() { _allocated_chunks.emplace_back(Chunk{}); }
+    ChainEntryAllocator(mx::memory::slab::Arena *slab_arena = nullptr) : _slab_arena(slab_arena)
+    {
+        _allocated_chunks.emplace_back(Chunk{slab_arena});
+    }
     ChainEntryAllocator(ChainEntryAllocator &&) noexcept = default;
     ~ChainEntryAllocator() = default;
 
@@ -19,7 +29,7 @@ public:
     {
         if (_allocated_chunks.back().can_allocate(size) == false)
         {
-            _allocated_chunks.template emplace_back(Chunk{});
+            _allocated_chunks.template emplace_back(Chunk{_slab_arena});
         }
 
         return _allocated_chunks.back().allocate(size);
@@ -29,10 +39,26 @@ private:
     class Chunk
     {
     public:
-        Chunk() : _memory(std::uintptr_t(std::aligned_alloc(64U, _capacity_in_bytes))) {}
+        explicit Chunk(mx::memory::slab::Arena *slab_arena)
+        {
+            if (slab_arena != nullptr)
+            {
+                const auto worker_id = mx::tasking::runtime::worker_id();
+                _memory = std::uintptr_t(slab_arena->allocate_block(
+                    worker_id, mx::tasking::runtime::numa_node_id(worker_id), _capacity_in_bytes));
+                _is_arena_allocated = _memory != 0U;
+            }
+
+            /// Threads that are no workers of the arena allocate from the system.
+            if (_memory == 0U)
+            {
+                _memory = std::uintptr_t(std::aligned_alloc(64U, _capacity_in_bytes));
+            }
+        }
 
         Chunk(Chunk &&other) noexcept
-            : _size_in_bytes(std::exchange(other._size_in_bytes, 0U)), _memory(std::exchange(other._memory, 0U))
+            : _size_in_bytes(std::exchange(other._size_in_bytes, 0U)), _memory(std::exchange(other._memory, 0U)),
+              _is_arena_allocated(other._is_arena_allocated)
         {
         }
 
@@ -40,7 +66,8 @@ private:
 
         ~Chunk()
         {
-            if (_memory != 0U)
+            /// Chunks of the arena are released with the arena.
+            if (_memory != 0U && _is_arena_allocated == false)
             {
                 std::free(reinterpret_cast<void *>(_memory));
             }
@@ -64,8 +91,12 @@ private:
         static inline constexpr std::size_t _capacity_in_bytes{1U << 20U};
         std::size_t _size_in_bytes{0U};
         std::uintptr_t _memory{0U};
+        bool _is_arena_allocated{false};
     };
 
+    /// Arena of the query, may be nullptr.
+    mx::memory::slab::Arena *_slab_arena;
+
     std::vector<Chunk> _allocated_chunks;
 };
 } // namespace db::execution::compilation::hashtable
\ No newline at end of file
@@ -13,6 +13,10 @@ class ChainedTable final : public AbstractTable
 {
 public:
     ChainedTable(Descriptor descriptor) noexcept : AbstractTable(descriptor), _capacity(descriptor.capacity()) {}
+    ChainedTable(Descriptor descriptor, mx::memory::slab::Arena *slab_arena) noexcept
+        : AbstractTable(descriptor, slab_arena), _capacity(descriptor.capacity())
+    {
+    }
 
     ~ChainedTable() noexcept override;
 
@@ -13,6 +13,10 @@ class LinearProbingTable final : public AbstractTable
 {
 public:
     LinearProbingTable(Descriptor descriptor) noexcept : AbstractTable(descriptor) {}
+    LinearProbingTable(Descriptor descriptor, mx::memory::slab::Arena *slab_arena) noexcept
+        : AbstractTable(descriptor, slab_arena), _spill_entry_allocator(slab_arena)
+    {
+    }
 
     ~LinearProbingTable() noexcept override = default;
 
@@ -1,4 +1,5 @@
 #include "aggregation_operator.h"
+#include <db/execution/compilation/materializer.h>
 #include <flounder/debug.h>
 #include <flounder/statement.h>
 #include <fmt/core.h>
@@ -93,86 +94,96 @@ void AggregationOperator::produce(const GenerationPhase phase, flounder::Program
         program << program.clear(this->_local_aggregation_result_vreg.value());
     }
 
-    /// During finalization phase
+    /// During finalization phase, the local results are reduced pairwise (the
+    /// result of arg3 into the result of arg2). The program called without a
+    /// result to reduce (arg3 is null) emits the result of arg2.
     else if (phase == GenerationPhase::finalization)
     {
         auto context_guard = flounder::ContextGuard{program, "Aggregation"};
 
-        /// Request registers for local aggregation.
-        auto registers = AbstractAggregationOperator::make_aggregation_registers(program, this->_aggregation_schema,
-                                                                                 this->_aggregations, std::nullopt);
-        for (auto [vreg, type, value] : registers)
-        {
-            this->_finalize_aggregation_result_registers.emplace_back(vreg);
-            program.header() << program.request_vreg(vreg, type.register_width());
-            if (value.has_value())
-            {
-                if (value->is_constant() && value->constant().value_as_int64() == 0U)
-                {
-                    program << program.xor_(vreg, vreg);
-                }
-                else
-                {
-                    program << program.mov(vreg, value.value());
-                }
-            }
-        }
+        /// Whenever there are more than a single local result ( = more than one worker ), we need
+        /// to provide reduce.
+        const auto is_need_reduce = this->_local_results->size() > 1U;
 
-        /// Register for the local results (process one after the other).
+        /// Read the local result.
         auto local_result_vreg = program.vreg("local_result_record");
+        program.arguments() << program.request_vreg64(local_result_vreg) << program.get_arg2(local_result_vreg);
 
-        /// Register for the end of the local result iterator.
-        auto local_result_end_vreg = program.vreg("local_result_end");
-
-        /// Set begin pointing to the begin of the local results tile.
-        program << program.request_vreg64(local_result_vreg)
-                << program.mov(local_result_vreg, program.address(this->_local_results->tile()->begin()));
-
-        /// End is equals to |schema| * |local result rows| + address of begin of the result tile.
-        const auto local_result_end = this->_local_results->tile()->schema().row_size() * this->_local_results->size() +
-                                      std::uintptr_t(this->_local_results->tile()->begin());
-        program << program.request_vreg64(local_result_end_vreg)
-                << program.mov(local_result_end_vreg, program.constant64(local_result_end));
+        auto is_last_label = program.label("emit_aggregation_result");
+        auto finalization_finished_label = program.label("finalize_end");
 
+        if (is_need_reduce)
         {
-            auto merge_loop = flounder::ForEach(program, local_result_vreg, local_result_end_vreg,
-                                                this->_local_results->tile()->schema().row_size(), "merge_loop");
+            /// Read the reduced result.
+            auto reduced_result_vreg = program.vreg("reduced_result_record");
+            program.arguments() << program.request_vreg64(reduced_result_vreg)
+                                << program.get_arg3(reduced_result_vreg);
+
+            /// Jump to the emit if there is nothing to reduce.
+            program << program.test(reduced_result_vreg, reduced_result_vreg) << program.jz(is_last_label);
 
-            /// Merge all aggregations from the local result into the global result registers.
+            /// Merge all aggregations from the reduced result into the local result.
             for (auto aggregation_id = 0U; aggregation_id < this->_aggregations.size(); ++aggregation_id)
             {
                 const auto &aggregation = this->_aggregations[aggregation_id];
-                auto aggregation_register = this->_finalize_aggregation_result_registers[aggregation_id];
-
                 const auto index = this->_aggregation_schema.index(aggregation->result().value());
                 if (index.has_value())
                 {
-                    /// The local result for this aggregation is stored here.
-                    auto local_result_aggregation_address =
-                        program.mem(local_result_vreg, this->_aggregation_schema.row_offset(index.value()),
-                                    this->_aggregation_schema.type(index.value()).register_width());
+                    const auto offset = this->_aggregation_schema.row_offset(index.value());
+                    const auto width = this->_aggregation_schema.type(index.value()).register_width();
+                    auto local_result_address = program.mem(local_result_vreg, offset, width);
+                    auto reduced_result_address = program.mem(reduced_result_vreg, offset, width);
+
+                    auto merge_vreg = program.vreg(fmt::format("reduced_aggregation_{}", aggregation_id));
+                    program << program.request_vreg(merge_vreg, width);
 
                     if (aggregation->id() == expression::Operation::Id::Count ||
                         aggregation->id() == expression::Operation::Id::Sum ||
                         aggregation->id() == expression::Operation::Id::Average)
                     {
                         /// Merge.
-                        program << program.add(aggregation_register, local_result_aggregation_address);
+                        program << program.mov(merge_vreg, reduced_result_address)
+                                << program.add(local_result_address, merge_vreg);
                     }
                     else if (aggregation->id() == expression::Operation::Id::Min)
                     {
-                        program << program.cmp(local_result_aggregation_address, aggregation_register)
-                                << program.cmovle(aggregation_register, local_result_aggregation_address);
+                        program << program.mov(merge_vreg, local_result_address)
+                                << program.cmp(reduced_result_address, merge_vreg)
+                                << program.cmovle(merge_vreg, reduced_result_address)
+                                << program.mov(local_result_address, merge_vreg);
                     }
                     else if (aggregation->id() == expression::Operation::Id::Max)
                     {
-                        program << program.cmp(local_result_aggregation_address, aggregation_register)
-                                << program.cmovge(aggregation_register, local_result_aggregation_address);
+                        program << program.mov(merge_vreg, local_result_address)
+                                << program.cmp(reduced_result_address, merge_vreg)
+                                << program.cmovge(merge_vreg, reduced_result_address)
+                                << program.mov(local_result_address, merge_vreg);
                     }
+
+                    program << program.clear(merge_vreg);
                 }
             }
+            program << program.clear(reduced_result_vreg) << program.jmp(finalization_finished_label);
+        }
+
+        /// Emit the (last) local result.
+        program << program.section(is_last_label);
+
+        /// Request registers for the result and load it from the local result.
+        auto registers = AbstractAggregationOperator::make_aggregation_registers(
+            program, this->_aggregation_schema, this->_aggregations, std::nullopt, false);
+        for (auto aggregation_id = 0U; aggregation_id < registers.size(); ++aggregation_id)
+        {
+            auto vreg = std::get<0>(registers[aggregation_id]);
+            this->_finalize_aggregation_result_registers.emplace_back(vreg);
+            program.header() << program.request_vreg(vreg, std::get<1>(registers[aggregation_id]).register_width());
+
+            const auto index =
+                this->_aggregation_schema.index(this->_aggregations[aggregation_id]->result().value()).value();
+            auto local_result_address =
+                RowMaterializer::access(program, local_result_vreg, this->_aggregation_schema, index);
+            program << program.mov(vreg, local_result_address);
         }
-        program << program.clear(local_result_vreg) << program.clear(local_result_end_vreg);
 
         /// Write the values of aggregation merge to the result record.
         for (auto aggregation_id = 0U; aggregation_id < this->_aggregations.size(); ++aggregation_id)
@@ -208,6 +219,8 @@ void AggregationOperator::produce(const GenerationPhase phase, flounder::Program
         {
             program << program.clear(aggregation_vreg);
         }
+
+        program << program.section(finalization_finished_label) << program.clear(local_result_vreg);
     }
     else if (phase == GenerationPhase::prefetching)
     {
@@ -48,8 +48,18 @@ public:
         std::pair<mx::tasking::dataflow::annotation<RecordSet>::FinalizationType, std::vector<mx::resource::ptr>>>
     finalization_data() noexcept override
     {
-        return std::make_pair(mx::tasking::dataflow::annotation<RecordSet>::FinalizationType::sequential,
-                              std::vector<mx::resource::ptr>{});
+        /// Every worker aggregates into its own result record; reduce the
+        /// records pairwise on the workers owning them.
+        auto data = std::vector<mx::resource::ptr>{};
+        data.reserve(this->_local_results->size());
+        for (auto worker_id = std::uint16_t(0U); worker_id < this->_local_results->size(); ++worker_id)
+        {
+            data.emplace_back(
+                mx::resource::ptr{this->_local_results->at(worker_id).data(),
+                                  mx::resource::information{worker_id, mx::synchronization::primitive::None}});
+        }
+
+        return std::make_pair(mx::tasking::dataflow::annotation<RecordSet>::FinalizationType::reduce, std::move(data));
     }
 
     [[nodiscard]] std::unique_ptr<OutputProviderInterface> output_provider(GenerationPhase phase) override;
@@ -86,7 +96,7 @@ private:
     /// List of registers that are used during aggregation when consuming the incoming records.
     std::vector<flounder::Register> _consume_aggregation_result_registers;
 
-    /// List of registers that are used when merging different local results.
+    /// List of registers holding the (reduced) result when emitting it.
     std::vector<flounder::Register> _finalize_aggregation_result_registers;
 
     void merge_results_into_core_local(flounder::Program &program, CompilationContext &context);
@@ -22,6 +22,21 @@ public:
     {
         for (const auto hash_table : _hash_tables)
         {
+            /// Hash tables of the query arena are released with the arena.
+            if (auto *ht = hash_table.template get<hashtable::AbstractTable>(); ht->is_arena_allocated())
+            {
+                ht->~AbstractTable();
+                continue;
+            }
+
+            /// Tables allocated outside of the arena were charged to the budget of the query.
+            if (auto *budget = hash_table.template get<hashtable::AbstractTable>()->charged_budget();
+                budget != nullptr)
+            {
+                budget->release(
+                    hashtable::TableProxy::size(hash_table.template get<hashtable::AbstractTable>()->descriptor()));
+            }
+
             // TODO: This case differentation is because RH-HashTables are allocated as
             //  squads for Radix Join and by default global heap for grouped aggregation.
             //  Maybe this can be aligned for both cases (e.g., use resource allocator either way).
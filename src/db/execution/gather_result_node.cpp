@@ -2,21 +2,79 @@
 #include "memory_tracing_node.h"
 #include <db/plan/physical/compilation_graph.h>
 #include <fmt/core.h>
+#include <memory>
 
 using namespace db::execution;
 
 GatherQueryResultNode::GatherQueryResultNode(const std::uint32_t client_id,
                                              std::shared_ptr<db::util::Chronometer> &&chronometer,
-                                             const db::topology::PhysicalSchema &schema)
-    : _client_id(client_id), _chronometer(std::move(chronometer)), _schema(schema)
+                                             const db::topology::PhysicalSchema &schema,
+                                             mx::memory::slab::Arena *slab_arena)
+    : _client_id(client_id), _chronometer(std::move(chronometer)), _schema(schema),
+      _count_workers(mx::tasking::runtime::workers())
 {
-    const auto count_cores = mx::tasking::runtime::workers();
-    this->_worker_local_results =
-        new mx::util::aligned_t<std::vector<std::pair<std::uint64_t, RecordToken>>>[count_cores];
-    for (auto worker_id = 0U; worker_id < count_cores; ++worker_id)
+    using worker_local_results_t = mx::util::aligned_t<std::vector<std::pair<std::uint64_t, RecordToken>>>;
+
+    if (const auto local_worker_id = mx::tasking::runtime::worker_id();
+        slab_arena != nullptr && local_worker_id < this->_count_workers)
+    {
+        auto *results = slab_arena->allocate_block(local_worker_id, mx::tasking::runtime::numa_node_id(local_worker_id),
+                                                   sizeof(worker_local_results_t) * this->_count_workers);
+        this->_worker_local_results = static_cast<worker_local_results_t *>(results);
+        if (this->_worker_local_results != nullptr)
+        {
+            std::uninitialized_default_construct_n(this->_worker_local_results, this->_count_workers);
+            this->_is_arena_allocated = true;
+        }
+    }
+
+    if (this->_worker_local_results == nullptr)
+    {
+        this->_worker_local_results = new worker_local_results_t[this->_count_workers];
+    }
+
+    for (auto worker_id = 0U; worker_id < this->_count_workers; ++worker_id)
     {
         this->_worker_local_results[worker_id].value().reserve(1U << 8U);
     }
+
+    if constexpr (config::is_stream_query_results())
+    {
+        this->_stream = std::make_shared<io::QueryResultStream>(
+            client_id, this->_schema, config::streamed_result_chunk_records(), config::max_sealed_result_chunks());
+    }
+}
+
+GatherQueryResultNode::~GatherQueryResultNode() noexcept
+{
+    using worker_local_results_t = mx::util::aligned_t<std::vector<std::pair<std::uint64_t, RecordToken>>>;
+
+    if (this->_is_arena_allocated)
+    {
+        /// The memory of the array is released with the arena.
+        std::destroy_n(this->_worker_local_results, this->_count_workers);
+    }
+    else
+    {
+        delete[] this->_worker_local_results;
+    }
+}
+
+void GatherQueryResultNode::stream(const std::uint16_t worker_id,
+                                   mx::tasking::dataflow::EmitterInterface<RecordSet> &graph, RecordToken &&data)
+{
+    const auto &slab_arena = static_cast<mx::tasking::dataflow::Graph<RecordSet> &>(graph).shared_slab_arena();
+    if (this->_stream->add(std::move(data.data()), slab_arena, &graph))
+    {
+        this->send_stream(worker_id, graph.priority());
+    }
+}
+
+void GatherQueryResultNode::send_stream(const std::uint16_t worker_id, const mx::tasking::priority priority)
+{
+    auto *send_task = mx::tasking::runtime::new_task<io::SendQueryResultStreamTask>(worker_id, this->_stream);
+    send_task->annotate(priority);
+    mx::tasking::runtime::spawn(*send_task, worker_id);
 }
 
 void GatherQueryResultNode::in_completed(const std::uint16_t worker_id,
@@ -25,29 +83,99 @@ void GatherQueryResultNode::in_completed(const std::uint16_t worker_id,
 {
     this->_chronometer->stop(util::Chronometer::Id::Executing);
 
-    /// Merge results.
-    auto tokens = std::vector<std::pair<std::uint64_t, RecordToken>>{};
-    for (auto local_worker_id = 0U; local_worker_id < mx::tasking::runtime::workers(); ++local_worker_id)
+    /// The graph stopped producing when the query exceeded its memory limit; the result is incomplete.
+    if (const auto *slab_arena = graph.slab_arena(); slab_arena != nullptr && slab_arena->budget().is_exceeded())
+        [[unlikely]]
     {
-        std::move(this->_worker_local_results[local_worker_id].value().begin(),
-                  this->_worker_local_results[local_worker_id].value().end(), std::back_inserter(tokens));
+        auto error = fmt::format("The query exceeded the memory limit of {} bytes (peak: {} bytes).",
+                                 slab_arena->budget().limit(), slab_arena->budget().peak());
+
+        /// Chunks sent before are followed by the error; the error has to be sent by the sender of the stream.
+        if (this->_stream != nullptr)
+        {
+            if (this->_stream->fail(std::move(error)))
+            {
+                this->send_stream(worker_id, graph.priority());
+            }
+        }
+        else
+        {
+            auto *error_task = mx::tasking::runtime::new_task<io::SendErrorTask>(worker_id, this->_client_id,
+                                                                                 std::move(error));
+            mx::tasking::runtime::spawn(*error_task, worker_id);
+        }
+
+        graph.finalize(worker_id, this);
+        return;
     }
 
-    /// Sort by their insertion order.
-    std::sort(tokens.begin(), tokens.end(),
-              [](const auto &first, const auto &second) { return std::get<0>(first) < std::get<0>(second); });
+    /// The records were streamed while the query was running; only the last chunk is left.
+    if (this->_stream != nullptr)
+    {
+        const auto &slab_arena = static_cast<mx::tasking::dataflow::Graph<RecordSet> &>(graph).shared_slab_arena();
+        if (this->_stream->close(this->_chronometer->microseconds(), slab_arena))
+        {
+            this->send_stream(worker_id, graph.priority());
+        }
+
+        graph.finalize(worker_id, this);
+        mx::tasking::runtime::defragment();
+        return;
+    }
+
+    /// Merge the results of all workers that gathered any, in parallel.
+    this->_graph = &graph;
+    this->_reduced_worker_ids.clear();
+    for (auto local_worker_id = std::uint16_t(0U); local_worker_id < this->_count_workers; ++local_worker_id)
+    {
+        if (this->_worker_local_results[local_worker_id].value().empty() == false)
+        {
+            this->_reduced_worker_ids.emplace_back(local_worker_id);
+        }
+    }
+
+    if (this->_reduced_worker_ids.empty())
+    {
+        this->_reduced_worker_ids.emplace_back(worker_id);
+    }
+
+    mx::tasking::dataflow::Reduction::start(worker_id, std::vector<std::uint16_t>{this->_reduced_worker_ids}, *this,
+                                            graph.priority());
+}
+
+void GatherQueryResultNode::reduce(const std::uint16_t /*worker_id*/, const std::size_t target,
+                                   const std::size_t source)
+{
+    auto &target_results = this->_worker_local_results[this->_reduced_worker_ids[target]].value();
+    auto &source_results = this->_worker_local_results[this->_reduced_worker_ids[source]].value();
+
+    /// Results of every worker are ordered by their insertion order; merging keeps the order.
+    const auto count_target_results = target_results.size();
+    std::move(source_results.begin(), source_results.end(), std::back_inserter(target_results));
+    source_results.clear();
+    std::inplace_merge(
+        target_results.begin(), target_results.begin() + count_target_results, target_results.end(),
+        [](const auto &first, const auto &second) { return std::get<0>(first) < std::get<0>(second); });
+}
+
+void GatherQueryResultNode::reduced(const std::uint16_t worker_id, const std::size_t root)
+{
+    auto &tokens = this->_worker_local_results[this->_reduced_worker_ids[root]].value();
 
     auto query_result = std::make_unique<io::QueryResult>(std::move(this->_schema));
+    query_result->slab_arena(
+        static_cast<mx::tasking::dataflow::Graph<RecordSet> *>(this->_graph)->shared_slab_arena());
     for (auto &token : tokens)
     {
         query_result->add(std::move(std::get<1>(token).data()));
     }
+    tokens.clear();
 
     auto *result_task = mx::tasking::runtime::new_task<io::SendQueryResultTask>(
         worker_id, this->_client_id, this->_chronometer->microseconds(), std::move(query_result));
     mx::tasking::runtime::spawn(*result_task, worker_id);
 
-    graph.finalize(worker_id, this);
+    this->_graph->finalize(worker_id, this);
     mx::tasking::runtime::defragment();
 }
 
@@ -96,8 +224,29 @@ void GatherPerformanceCounterNode::in_completed(const std::uint16_t worker_id,
                                                 mx::tasking::dataflow::NodeInterface<RecordSet> & /*in_node*/)
 {
     this->_chronometer->stop(util::Chronometer::Id::Executing);
+
+    /// Memory of the query, taken before the graph (and its arena) is released.
+    auto memory_usage = std::optional<mx::memory::Budget::Usage>{std::nullopt};
+    if (const auto *slab_arena = graph.slab_arena(); slab_arena != nullptr)
+    {
+        /// The graph stopped producing when the query exceeded its memory limit.
+        if (slab_arena->budget().is_exceeded()) [[unlikely]]
+        {
+            auto *error_task = mx::tasking::runtime::new_task<io::SendErrorTask>(
+                worker_id, this->_client_id,
+                fmt::format("The query exceeded the memory limit of {} bytes (peak: {} bytes).",
+                            slab_arena->budget().limit(), slab_arena->budget().peak()));
+            mx::tasking::runtime::spawn(*error_task, worker_id);
+
+            graph.finalize(worker_id, this);
+            return;
+        }
+
+        memory_usage = slab_arena->budget().usage();
+    }
+
     auto *result_task = mx::tasking::runtime::new_task<io::SendPerformanceCounterTask>(
-        worker_id, this->_client_id, this->_count_records.load(), std::move(this->_chronometer));
+        worker_id, this->_client_id, this->_count_records.load(), std::move(this->_chronometer), memory_usage);
     mx::tasking::runtime::spawn(*result_task, worker_id);
 
     graph.finalize(worker_id, this);
@@ -395,4 +544,53 @@ void GatherTimesNode::in_completed(const std::uint16_t worker_id,
 
     graph.finalize(worker_id, this);
     mx::tasking::runtime::defragment();
-}
\ No newline at end of file
+}
+
+void GatherTaskCyclesNode::in_completed(const std::uint16_t worker_id,
+                                        mx::tasking::dataflow::EmitterInterface<RecordSet> &graph,
+                                        mx::tasking::dataflow::NodeInterface<RecordSet> & /*in_node*/)
+{
+    this->_chronometer->stop(util::Chronometer::Id::Executing);
+
+    /// Workers publish their accounted runs once per task buffer; the runs of the
+    /// query's last tasks may not be published, yet.
+    const auto count_workers = mx::tasking::runtime::workers();
+    this->_count_flushing_workers.store(count_workers);
+    for (auto target_worker_id = std::uint16_t(0U); target_worker_id < count_workers; ++target_worker_id)
+    {
+        auto *flush_task = mx::tasking::runtime::new_task<FlushTaskCyclesTask>(worker_id, *this, graph);
+        flush_task->annotate(target_worker_id);
+        flush_task->annotate(mx::tasking::annotation::bound);
+        flush_task->annotate(graph.priority());
+        mx::tasking::runtime::spawn(*flush_task, worker_id);
+    }
+}
+
+void GatherTaskCyclesNode::flushed(const std::uint16_t worker_id,
+                                   mx::tasking::dataflow::EmitterInterface<RecordSet> &graph)
+{
+    if (this->_count_flushing_workers.fetch_sub(1U) != 1U)
+    {
+        return;
+    }
+
+    auto *data_flow_graph = reinterpret_cast<plan::physical::DataFlowGraph *>(&graph);
+
+    /// Attribute the accounted cycles to the nodes of this query.
+    const auto task_cycles = mx::tasking::runtime::task_cycles(data_flow_graph->trace_ids());
+    auto node_cycles = std::vector<std::pair<std::string, mx::tasking::profiling::TaskCycles>>{};
+    data_flow_graph->for_each_node([&task_cycles, &node_cycles](auto *node) {
+        if (auto iterator = task_cycles.find(node->trace_id()); iterator != task_cycles.end())
+        {
+            node_cycles.emplace_back(node->to_string(), iterator->second);
+        }
+    });
+
+    auto *result_task = mx::tasking::runtime::new_task<io::SendTaskCyclesTask>(
+        worker_id, this->_client_id, this->_chronometer->microseconds(), this->_count_records.load(),
+        std::move(node_cycles));
+    mx::tasking::runtime::spawn(*result_task, worker_id);
+
+    graph.finalize(worker_id, this);
+    mx::tasking::runtime::defragment();
+}
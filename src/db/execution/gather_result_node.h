@@ -4,8 +4,10 @@
 #include <atomic>
 #include <cstdint>
 #include <db/execution/compilation/compilation_node.h>
+#include <db/config.h>
 #include <db/execution/record_token.h>
 #include <db/io/query_result.h>
+#include <db/io/query_result_stream.h>
 #include <db/io/task/send_result_task.h>
 #include <db/topology/database.h>
 #include <db/topology/physical_schema.h>
@@ -16,29 +18,58 @@
 #include <mx/synchronization/spinlock.h>
 #include <mx/system/cache.h>
 #include <mx/tasking/dataflow/node.h>
+#include <mx/tasking/dataflow/reduction.h>
 #include <mx/tasking/runtime.h>
 #include <mx/util/aligned_t.h>
 #include <perf/imc/dram_bandwidth_monitor.h>
 #include <vector>
 
 namespace db::execution {
-class GatherQueryResultNode final : public mx::tasking::dataflow::NodeInterface<RecordSet>
+/**
+ * Gathers the result of a query in worker-local lists. When the query completed,
+ * the lists are concatenated (ordered by their arrival) along a reduction tree
+ * and sent to the client.
+ * When results are streamed (see config::is_stream_query_results()), the records
+ * are cut into chunks by their arrival instead and sent while the query is running;
+ * chunks waiting for the client count as pending tokens of the node and congest
+ * the node (throttling the producers) when too many are waiting.
+ */
+class GatherQueryResultNode final : public mx::tasking::dataflow::NodeInterface<RecordSet>,
+                                    public mx::tasking::dataflow::ReducerInterface
 {
 public:
     GatherQueryResultNode(std::uint32_t client_id, std::shared_ptr<util::Chronometer> &&chronometer,
-                          const topology::PhysicalSchema &schema);
+                          const topology::PhysicalSchema &schema, mx::memory::slab::Arena *slab_arena = nullptr);
 
-    ~GatherQueryResultNode() noexcept override { delete[] _worker_local_results; }
+    ~GatherQueryResultNode() noexcept override;
 
-    void consume(const std::uint16_t worker_id, mx::tasking::dataflow::EmitterInterface<RecordSet> & /*graph*/,
+    void consume(const std::uint16_t worker_id, mx::tasking::dataflow::EmitterInterface<RecordSet> &graph,
                  RecordToken &&data) override
     {
-        _worker_local_results[worker_id].value().emplace_back(_result_id.fetch_add(1U), std::move(data));
+        if constexpr (config::is_stream_query_results())
+        {
+            this->stream(worker_id, graph, std::move(data));
+        }
+        else
+        {
+            _worker_local_results[worker_id].value().emplace_back(_result_id.fetch_add(1U), std::move(data));
+        }
     }
 
     void in_completed(std::uint16_t worker_id, mx::tasking::dataflow::EmitterInterface<RecordSet> &graph,
                       mx::tasking::dataflow::NodeInterface<RecordSet> &in_node) override;
 
+    void reduce(std::uint16_t worker_id, std::size_t target, std::size_t source) override;
+
+    void reduced(std::uint16_t worker_id, std::size_t root) override;
+
+    [[nodiscard]] std::uint64_t count_pending_tokens() const noexcept override
+    {
+        return _stream != nullptr ? _stream->count_pending_tiles() : 0U;
+    }
+
+    [[nodiscard]] bool is_congested() const noexcept override { return _stream != nullptr && _stream->is_congested(); }
+
     [[nodiscard]] std::string to_string() const noexcept override { return "Result"; }
 
 private:
@@ -46,7 +77,40 @@ private:
     std::shared_ptr<util::Chronometer> _chronometer;
     topology::PhysicalSchema _schema;
     mx::util::aligned_t<std::vector<std::pair<std::uint64_t, RecordToken>>> *_worker_local_results{nullptr};
+
+    /// Number of workers the worker-local results were allocated for.
+    const std::uint16_t _count_workers;
+
+    /// Graph of the node, set when the results are reduced.
+    mx::tasking::dataflow::EmitterInterface<RecordSet> *_graph{nullptr};
+
+    /// Workers holding results, participating in the reduction.
+    std::vector<std::uint16_t> _reduced_worker_ids;
+
+    /// Chunks of the result sent while the query is running; shared with the task sending them.
+    std::shared_ptr<io::QueryResultStream> _stream{nullptr};
+
+    /// The worker-local results are allocated from the arena of the query, if any.
+    bool _is_arena_allocated{false};
     alignas(mx::system::cache::line_size()) std::atomic_uint64_t _result_id{0U};
+
+    /**
+     * Appends the records to the stream and starts sending sealed chunks.
+     *
+     * @param worker_id Worker consuming the records.
+     * @param graph Graph of the node.
+     * @param data Records to append.
+     */
+    void stream(std::uint16_t worker_id, mx::tasking::dataflow::EmitterInterface<RecordSet> &graph,
+                RecordToken &&data);
+
+    /**
+     * Spawns the task sending the sealed chunks of the stream.
+     *
+     * @param worker_id Worker spawning the task.
+     * @param priority Priority of the query; the sender must not fall behind its producers.
+     */
+    void send_stream(std::uint16_t worker_id, mx::tasking::priority priority);
 };
 
 class GatherPerformanceCounterNode final : public mx::tasking::dataflow::NodeInterface<RecordSet>
@@ -321,4 +385,77 @@ private:
     std::shared_ptr<util::Chronometer> _chronometer;
     std::atomic<std::uint64_t> _count_records{0U};
 };
+
+/**
+ * Collects the cycles the runtime accounted for the tasks of every node of the graph.
+ * The node acquires the task cycle accounting for the lifetime of the query, in case
+ * it is switched off. Before the cycles are collected, every worker publishes the
+ * cycles it accounted so far.
+ */
+class GatherTaskCyclesNode final : public mx::tasking::dataflow::NodeInterface<RecordSet>
+{
+public:
+    GatherTaskCyclesNode(const std::uint32_t client_id, std::shared_ptr<util::Chronometer> &&chronometer) noexcept
+        : _client_id(client_id), _chronometer(std::move(chronometer))
+    {
+        mx::tasking::runtime::acquire_task_cycle_accounting();
+    }
+
+    ~GatherTaskCyclesNode() noexcept override { mx::tasking::runtime::release_task_cycle_accounting(); }
+
+    void consume(const std::uint16_t /*worker_id*/, mx::tasking::dataflow::EmitterInterface<RecordSet> & /*graph*/,
+                 RecordToken &&data) override
+    {
+        /// Results are hidden, only number of records is gathered.
+        _count_records.fetch_add(data.data().tile().get<data::PaxTile>()->size());
+    }
+
+    void in_completed(std::uint16_t worker_id, mx::tasking::dataflow::EmitterInterface<RecordSet> &graph,
+                      mx::tasking::dataflow::NodeInterface<RecordSet> &in_node) override;
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "Task Cycles"; }
+
+    /**
+     * Called on every worker after publishing its accounted cycles; the
+     * last worker sends the cycles of the nodes to the client.
+     *
+     * @param worker_id Worker that published its cycles.
+     * @param graph Graph of the node.
+     */
+    void flushed(std::uint16_t worker_id, mx::tasking::dataflow::EmitterInterface<RecordSet> &graph);
+
+private:
+    const std::uint32_t _client_id;
+    std::shared_ptr<util::Chronometer> _chronometer;
+    std::atomic<std::uint64_t> _count_records{0U};
+
+    /// Workers that did not publish their accounted cycles, yet.
+    std::atomic_uint16_t _count_flushing_workers{0U};
+};
+
+/**
+ * Publishes the task cycles accounted by the executing worker, before
+ * the GatherTaskCyclesNode collects the cycles of all workers.
+ */
+class FlushTaskCyclesTask final : public mx::tasking::TaskInterface
+{
+public:
+    FlushTaskCyclesTask(GatherTaskCyclesNode &node, mx::tasking::dataflow::EmitterInterface<RecordSet> &graph) noexcept
+        : _node(node), _graph(graph)
+    {
+    }
+
+    ~FlushTaskCyclesTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(const std::uint16_t worker_id) override
+    {
+        mx::tasking::runtime::flush_task_cycles(worker_id);
+        _node.flushed(worker_id, _graph);
+        return mx::tasking::TaskResult::make_remove();
+    }
+
+private:
+    GatherTaskCyclesNode &_node;
+    mx::tasking::dataflow::EmitterInterface<RecordSet> &_graph;
+};
 } // namespace db::execution
\ No newline at end of file
@@ -21,7 +21,7 @@ void CopyNode::consume(const std::uint16_t worker_id, mx::tasking::dataflow::Emi
     record_sets.reserve(1U << 6U);
 
     /// Make a first set.
-    record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id));
+    record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id, graph.slab_arena()));
 
     /// Scan the file line by line.
     std::string line;
@@ -43,7 +43,7 @@ void CopyNode::consume(const std::uint16_t worker_id, mx::tasking::dataflow::Emi
         {
             if (record_sets.back().tile().get<data::PaxTile>()->full())
             {
-                record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id));
+                record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id, graph.slab_arena()));
             }
 
             auto pax_record_view = record_sets.back().tile().get<data::PaxTile>()->allocate();
@@ -14,8 +14,10 @@ namespace db::execution::interpretation {
 class CreateTableNode final : public mx::tasking::dataflow::ProducingNodeInterface<RecordSet>, public OperatorInterface
 {
 public:
-    CreateTableNode(topology::Database &database, std::string &&table_name, topology::PhysicalSchema &&schema) noexcept
-        : _database(database), _table_name(std::move(table_name)), _table_schema(std::move(schema))
+    CreateTableNode(topology::Database &database, std::string &&table_name, topology::PhysicalSchema &&schema,
+                    const topology::Placement placement) noexcept
+        : _database(database), _table_name(std::move(table_name)), _table_schema(std::move(schema)),
+          _placement(placement)
     {
         NodeInterface<RecordSet>::annotation().produces(std::make_unique<DisponsableGenerator>());
     }
@@ -27,7 +29,7 @@ public:
     {
         if (this->_database.is_table(this->_table_name) == false)
         {
-            this->_database.insert(std::move(this->_table_name), std::move(this->_table_schema));
+            this->_database.insert(std::move(this->_table_name), std::move(this->_table_schema), this->_placement);
         }
     }
 
@@ -47,5 +49,8 @@ private:
 
     /// Schema of the table.
     topology::PhysicalSchema _table_schema;
+
+    /// Placement of the tiles of the table.
+    const topology::Placement _placement;
 };
 } // namespace db::execution::interpretation
\ No newline at end of file
@@ -11,14 +11,14 @@ void DeliverNode::consume(const std::uint16_t worker_id, mx::tasking::dataflow::
     record_sets.reserve(1U << 6U);
 
     /// Make a first set.
-    record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id));
+    record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id, graph.slab_arena()));
 
     /// Build a record of each line.
     for (auto &values : this->_data_lists)
     {
         if (record_sets.back().tile().get<data::PaxTile>()->full())
         {
-            record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id));
+            record_sets.emplace_back(RecordSet::make_record_set(this->_schema, worker_id, graph.slab_arena()));
         }
 
         auto record = record_sets.back().tile().get<data::PaxTile>()->allocate();
@@ -35,7 +35,7 @@ public:
     {
         /// Build a record set with size equal to number of attributes.
         // TODO: Bug when number of columns > config::tuples_per_tile().
-        auto records = RecordSet::make_record_set(_schema, worker_id);
+        auto records = RecordSet::make_record_set(_schema, worker_id, graph.slab_arena());
 
         /// Build a record for each attribute in the schema.
         for (auto index = 0U; index < _table.schema().size(); ++index)
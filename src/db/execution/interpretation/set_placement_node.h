@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <db/execution/operator_interface.h>
+#include <db/execution/record_token.h>
+#include <db/execution/scan_generator.h>
+#include <db/topology/physical_schema.h>
+#include <db/topology/placement.h>
+#include <db/topology/table.h>
+#include <mx/tasking/dataflow/node.h>
+#include <string>
+
+namespace db::execution::interpretation {
+class SetPlacementNode final : public mx::tasking::dataflow::ProducingNodeInterface<RecordSet>, public OperatorInterface
+{
+public:
+    SetPlacementNode(topology::Table &table, const topology::Placement placement) noexcept
+        : _table(table), _placement(placement)
+    {
+        NodeInterface<RecordSet>::annotation().produces(std::make_unique<DisponsableGenerator>());
+    }
+
+    ~SetPlacementNode() noexcept override = default;
+
+    void consume(const std::uint16_t /*worker_id*/, mx::tasking::dataflow::EmitterInterface<RecordSet> & /*graph*/,
+                 RecordToken && /*token*/) override
+    {
+        this->_table.placement(this->_placement);
+    }
+
+    [[nodiscard]] const topology::PhysicalSchema &schema() const override { return _schema; }
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "Set Placement"; }
+
+private:
+    /// Schema of this operator which is empty, since this operator yields not records.
+    const topology::PhysicalSchema _schema;
+
+    /// Table to move.
+    topology::Table &_table;
+
+    /// New placement of the table.
+    const topology::Placement _placement;
+};
+} // namespace db::execution::interpretation
@@ -0,0 +1,108 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+#include <db/execution/operator_interface.h>
+#include <db/execution/record_token.h>
+#include <db/execution/scan_generator.h>
+#include <db/topology/physical_schema.h>
+#include <db/type/type.h>
+#include <mx/memory/allocator_statistics.h>
+#include <mx/memory/config.h>
+#include <mx/tasking/dataflow/node.h>
+#include <mx/tasking/runtime.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace db::execution::interpretation {
+/**
+ * Shows the memory held by the allocators of the runtime: One record for every
+ * worker and NUMA node of the resource heaps, one summarizing record per NUMA
+ * node, and one record per NUMA node of the task allocator.
+ */
+class ShowMemoryNode final : public mx::tasking::dataflow::ProducingNodeInterface<RecordSet>, public OperatorInterface
+{
+public:
+    ShowMemoryNode() noexcept
+    {
+        _schema.emplace_back(expression::Term::make_attribute("Allocator"), type::Type::make_char(16U));
+        _schema.emplace_back(expression::Term::make_attribute("Worker"), type::Type::make_char(8U));
+        _schema.emplace_back(expression::Term::make_attribute("NUMA"), type::Type::make_int());
+        _schema.emplace_back(expression::Term::make_attribute("In Use (Byte)"), type::Type::make_bigint());
+        _schema.emplace_back(expression::Term::make_attribute("Cached (Byte)"), type::Type::make_bigint());
+        _schema.emplace_back(expression::Term::make_attribute("#Blocks"), type::Type::make_bigint());
+        _schema.emplace_back(expression::Term::make_attribute("#Remote Frees"), type::Type::make_bigint());
+        _schema.emplace_back(expression::Term::make_attribute("Largest Free (Byte)"), type::Type::make_bigint());
+        _schema.emplace_back(expression::Term::make_attribute("Fragmentation (%)"), type::Type::make_int());
+
+        NodeInterface<RecordSet>::annotation().produces(std::make_unique<DisponsableGenerator>());
+    }
+
+    ~ShowMemoryNode() noexcept override = default;
+
+    void consume(const std::uint16_t worker_id, mx::tasking::dataflow::EmitterInterface<RecordSet> &graph,
+                 RecordToken && /*data*/) override
+    {
+        auto records = RecordSet::make_record_set(_schema, worker_id, graph.slab_arena());
+        auto *tile = records.tile().get<data::PaxTile>();
+
+        /// Summary of all workers per NUMA node.
+        auto numa_statistics = std::vector<std::optional<mx::memory::AllocatorStatistics>>{};
+        numa_statistics.resize(mx::memory::config::max_numa_nodes());
+
+        for (const auto &statistics : mx::tasking::runtime::allocator_statistics())
+        {
+            if (statistics.worker_id() != mx::memory::AllocatorStatistics::all_workers())
+            {
+                auto &numa_node_statistics = numa_statistics[statistics.numa_node_id()];
+                if (numa_node_statistics.has_value() == false)
+                {
+                    numa_node_statistics.emplace(statistics.allocator(), mx::memory::AllocatorStatistics::all_workers(),
+                                                 statistics.numa_node_id());
+                }
+                numa_node_statistics.value() += statistics;
+            }
+
+            ShowMemoryNode::emplace_back(tile, statistics);
+        }
+
+        for (const auto &statistics : numa_statistics)
+        {
+            if (statistics.has_value())
+            {
+                ShowMemoryNode::emplace_back(tile, statistics.value());
+            }
+        }
+
+        graph.emit(worker_id, this, RecordToken{std::move(records)});
+    }
+
+    [[nodiscard]] const topology::PhysicalSchema &schema() const override { return _schema; }
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "Show Memory"; }
+
+private:
+    /// Schema of this operator, one attribute per statistic.
+    topology::PhysicalSchema _schema;
+
+    static void emplace_back(data::PaxTile *tile, const mx::memory::AllocatorStatistics &statistics)
+    {
+        auto record = tile->allocate();
+        if (record.has_value() == false) [[unlikely]]
+        {
+            return;
+        }
+
+        const auto is_all_workers = statistics.worker_id() == mx::memory::AllocatorStatistics::all_workers();
+        record->set(0U, std::string{statistics.allocator()});
+        record->set(1U, is_all_workers ? std::string{"all"} : std::to_string(statistics.worker_id()));
+        record->set(2U, type::underlying<type::INT>::value(statistics.numa_node_id()));
+        record->set(3U, type::underlying<type::BIGINT>::value(statistics.in_use_bytes()));
+        record->set(4U, type::underlying<type::BIGINT>::value(statistics.cached_bytes()));
+        record->set(5U, type::underlying<type::BIGINT>::value(statistics.count_blocks()));
+        record->set(6U, type::underlying<type::BIGINT>::value(statistics.count_remote_frees()));
+        record->set(7U, type::underlying<type::BIGINT>::value(statistics.largest_free_block()));
+        record->set(8U, type::underlying<type::INT>::value(std::lround(statistics.fragmentation() * 100.0)));
+    }
+};
+} // namespace db::execution::interpretation
@@ -20,6 +20,7 @@ public:
         _schema.emplace_back(expression::Term::make_attribute("Table"), type::Type::make_char(64U));
         _schema.emplace_back(expression::Term::make_attribute("#Tiles"), type::Type::make_bigint());
         _schema.emplace_back(expression::Term::make_attribute("#Records"), type::Type::make_bigint());
+        _schema.emplace_back(expression::Term::make_attribute("Placement"), type::Type::make_char(16U));
 
         NodeInterface<RecordSet>::annotation().produces(std::make_unique<DisponsableGenerator>());
     }
@@ -31,7 +32,7 @@ public:
     {
         /// Create a temporary tile in the record set for number of tables "records".
         // TODO: Bug when number of tables > config::tuples_per_tile().
-        auto records = RecordSet::make_record_set(_schema, worker_id);
+        auto records = RecordSet::make_record_set(_schema, worker_id, graph.slab_arena());
 
         /// Allocate a record for each table and set the name.
         for (const auto &[name, table] : _database.tables())
@@ -42,6 +43,7 @@ public:
 
             auto count_records = table.statistics().count_rows();
             record_view->set(2U, type::underlying<type::BIGINT>::value(count_records));
+            record_view->set(3U, topology::to_string(table.placement()));
         }
 
         graph.emit(worker_id, this, RecordToken{std::move(records)});
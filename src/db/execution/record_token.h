@@ -19,6 +19,20 @@ public:
         return RecordSet{data::PaxTile::make(schema, true, worker_id)};
     }
 
+    /**
+     * Creates a record set whose tile is allocated from the given arena.
+     *
+     * @param schema Schema of the records.
+     * @param worker_id Worker the tile is mapped to.
+     * @param arena Arena of the graph (see EmitterInterface::slab_arena()), may be nullptr.
+     * @return The record set.
+     */
+    [[nodiscard]] static RecordSet make_record_set(const topology::PhysicalSchema &schema,
+                                                   const std::uint16_t worker_id, mx::memory::slab::Arena *arena)
+    {
+        return RecordSet{data::PaxTile::make(schema, true, worker_id, arena)};
+    }
+
     [[nodiscard]] static RecordSet make_empty() { return RecordSet{}; }
 
     [[nodiscard]] static RecordSet make_client_record_set(const topology::PhysicalSchema &schema)
@@ -43,7 +57,7 @@ public:
             }
             else if (_tile.get<data::PaxTile>()->is_temporary())
             {
-                mx::tasking::runtime::delete_resource<data::PaxTile>(_tile);
+                data::PaxTile::release(_tile);
             }
         }
     }
@@ -1,25 +1,46 @@
 #pragma once
 
 #include "record_token.h"
+#include <db/config.h>
 #include <db/data/row_tile.h>
 #include <db/topology/table.h>
+#include <mutex>
+#include <mx/system/cpu.h>
 #include <mx/tasking/annotation.h>
+#include <mx/tasking/config.h>
+#include <mx/tasking/dataflow/morsel.h>
 #include <mx/tasking/dataflow/token_generator.h>
 #include <mx/tasking/prefetch_descriptor.h>
+#include <mx/tasking/runtime.h>
+#include <optional>
 #include <ranges>
 
 namespace db::execution {
+/**
+ * Generates a token for every tile of the scanned table. Either, every worker
+ * receives the tiles mapped to it, or (when morsel-driven) workers pull morsels
+ * of tiles, preferring tiles on their NUMA node. The generator pins the scanned
+ * table, tiles replaced by a new placement stay valid while the graph exists.
+ */
 class ScanGenerator final : public mx::tasking::dataflow::TokenGenerator<RecordSet>
 {
 public:
-    constexpr explicit ScanGenerator(const topology::Table &table) noexcept : _scanned_table(table) {}
+    explicit ScanGenerator(const topology::Table &table,
+                           const bool is_morsel_driven = config::is_use_morsel_driven_scans()) noexcept
+        : _scanned_table(table), _is_morsel_driven(is_morsel_driven)
+    {
+        _scanned_table.pin();
+    }
 
-    constexpr ScanGenerator(const topology::Table &table, mx::tasking::PrefetchDescriptor prefetch_descriptor) noexcept
-        : _prefetch_descriptor(prefetch_descriptor), _scanned_table(table)
+    ScanGenerator(const topology::Table &table, mx::tasking::PrefetchDescriptor prefetch_descriptor,
+                  const bool is_morsel_driven = config::is_use_morsel_driven_scans()) noexcept
+        : _prefetch_descriptor(prefetch_descriptor), _scanned_table(table), _is_morsel_driven(is_morsel_driven)
     {
+        _scanned_table.pin();
     }
 
-    ~ScanGenerator() noexcept override = default;
+    /// The tiles are read until the graph (owning the generator) is released.
+    ~ScanGenerator() noexcept override { _scanned_table.unpin(); }
 
     void prefetch(const mx::tasking::PrefetchDescriptor descriptor) noexcept
     {
@@ -30,32 +51,90 @@ public:
     {
         auto tokens = std::vector<RecordToken>{};
 
-        const auto &tile_index = _scanned_table.tiles_index();
-        if (auto iterator = tile_index.find(worker_id); iterator != tile_index.end())
-        {
-            const auto &tiles = iterator->second;
-            tokens.reserve(tiles.size());
+        tokens.reserve(_scanned_table.count_tiles(worker_id));
 
-            for (const auto tile : tiles)
-            {
-                const auto annotation = mx::tasking::annotation{mx::tasking::annotation::access_intention::readonly,
-                                                                tile, _prefetch_descriptor};
+        _scanned_table.for_each_tile(worker_id, [&tokens, this](const mx::resource::ptr tile) {
+            const auto annotation = mx::tasking::annotation{mx::tasking::annotation::access_intention::readonly, tile,
+                                                            _prefetch_descriptor};
 
-                /// For compilation, we do not need the initial tile size.
-                tokens.emplace_back(RecordSet{tile}, annotation);
-            }
-        }
+            /// For compilation, we do not need the initial tile size.
+            tokens.emplace_back(RecordSet{tile}, annotation);
+        });
 
         return tokens;
     }
 
     [[nodiscard]] std::uint64_t count() override { return _scanned_table.tiles().size(); }
 
+    [[nodiscard]] bool is_morsel_driven() const noexcept override { return _is_morsel_driven; }
+
+    /**
+     * Chooses between pulling morsels and scanning the tiles mapped to every worker;
+     * has to be set before the graph is started.
+     */
+    void is_morsel_driven(const bool is_morsel_driven) noexcept { _is_morsel_driven = is_morsel_driven; }
+
+    [[nodiscard]] std::vector<RecordToken> next_morsel(const std::uint16_t worker_id) override
+    {
+        /// The cursor is built by the first pulling worker, when the graph is executed.
+        std::call_once(_morsel_cursor_flag, [this] { this->make_morsel_cursor(); });
+
+        const auto morsel =
+            _morsel_cursor->next(mx::tasking::runtime::numa_node_id(worker_id), _morsel_size.get());
+
+        auto tokens = std::vector<RecordToken>{};
+        tokens.reserve(morsel.size());
+        for (const auto tile : morsel)
+        {
+            const auto annotation = mx::tasking::annotation{mx::tasking::annotation::access_intention::readonly, tile,
+                                                            _prefetch_descriptor};
+            tokens.emplace_back(RecordSet{tile}, annotation);
+        }
+
+        return tokens;
+    }
+
+    void processed_morsel(const std::uint16_t /*worker_id*/, const std::uint64_t count_tokens,
+                          const std::chrono::nanoseconds duration) override
+    {
+        _morsel_size.update(count_tokens, duration);
+    }
+
     //    [[nodiscard]] mx::tasking::PrefetchMask &prefetch_mask() noexcept { return _prefetch_mask; }
 
 private:
     mx::tasking::PrefetchDescriptor _prefetch_descriptor;
     const topology::Table &_scanned_table;
+
+    /// Pull morsels of tiles instead of generating the tiles of a worker at once.
+    bool _is_morsel_driven;
+
+    /// Tiles of the table, partitioned by the NUMA node of the worker they are mapped to.
+    std::optional<mx::tasking::dataflow::MorselCursor<mx::resource::ptr>> _morsel_cursor{std::nullopt};
+    std::once_flag _morsel_cursor_flag;
+
+    /// Number of tiles per morsel.
+    mx::tasking::dataflow::MorselSize _morsel_size{
+        config::initial_tiles_per_morsel(), config::initial_tiles_per_morsel(),
+        std::chrono::microseconds{mx::tasking::config::morsel_duration()}};
+
+    void make_morsel_cursor()
+    {
+        const auto count_workers = mx::tasking::runtime::workers();
+
+        auto tiles = std::vector<std::vector<mx::resource::ptr>>(mx::system::cpu::max_node_id() + 1U);
+        for (auto worker_id = std::uint16_t(0U); worker_id < count_workers; ++worker_id)
+        {
+            auto &numa_node_tiles = tiles[mx::tasking::runtime::numa_node_id(worker_id)];
+            _scanned_table.for_each_tile(worker_id,
+                                         [&numa_node_tiles](const auto tile) { numa_node_tiles.emplace_back(tile); });
+        }
+
+        _morsel_cursor.emplace(std::move(tiles));
+
+        /// Keep a few morsels per worker to balance the load at the end of the scan.
+        _morsel_size.limit(_morsel_cursor->size() / (count_workers * 4U));
+    }
 };
 
 class DisponsableGenerator final : public mx::tasking::dataflow::TokenGenerator<RecordSet>
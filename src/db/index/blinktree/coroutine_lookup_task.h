@@ -0,0 +1,132 @@
+#pragma once
+
+#include "config.h"
+#include "node.h"
+#include "task.h"
+#include <mx/tasking/coroutine_task.h>
+#include <optional>
+
+namespace db::index::blinktree {
+/**
+ * Lookup that traverses the tree within a single coroutine. Before accessing
+ * a node, the coroutine prefetches the node and suspends; the worker interleaves
+ * many lookups instead of stalling on every cache miss.
+ * Nodes are read optimistically, the lookup is only valid for trees whose
+ * nodes are synchronized by an optimistic protocol (ScheduleWriter or OLFIT).
+ * While suspended, writers may modify the tree: After resuming, the lookup
+ * re-validates the node it read the pointer from and reads that node again
+ * when it changed.
+ */
+template <typename K, typename V, class L> class CoroutineLookupTask final : public mx::tasking::CoroutineTask
+{
+public:
+    CoroutineLookupTask(const K key, const mx::resource::ptr root, L &listener) noexcept
+        : _listener(listener), _key(key), _root(root)
+    {
+    }
+
+    ~CoroutineLookupTask() override { this->_listener.found(_worker_id, this->_key, _value); }
+
+    [[nodiscard]] std::uint64_t trace_id() const noexcept override
+    {
+        return Task<K, V, L>::TRACE_ID | 1U << 9U;
+    }
+
+    [[nodiscard]] static bool is_supported(const mx::synchronization::primitive primitive) noexcept
+    {
+        return primitive == mx::synchronization::primitive::ScheduleWriter ||
+               primitive == mx::synchronization::primitive::OLFIT;
+    }
+
+protected:
+    mx::tasking::Coroutine run(std::uint16_t worker_id) override;
+
+private:
+    L &_listener;
+    const K _key;
+    const mx::resource::ptr _root;
+    V _value;
+    std::uint16_t _worker_id{0U};
+};
+
+template <typename K, typename V, typename L>
+mx::tasking::Coroutine CoroutineLookupTask<K, V, L>::run(const std::uint16_t worker_id)
+{
+    /// Like the task-based lookup, we prefetch a quarter of each node.
+    constexpr auto prefetch_size = config::node_size() / 4U;
+
+    /// We do not prefetch the root, since the root will be likely in the cache.
+    auto node_ptr = this->_root;
+    auto is_prefetch = false;
+
+    /// Node the pointer to the next node was read from, and its version at that time.
+    auto parent_ptr = mx::resource::ptr{};
+    auto parent_version = mx::synchronization::OptimisticLock::version_t{};
+
+    while (true)
+    {
+        auto *node = node_ptr.template get<Node<K, V>>();
+        if (is_prefetch)
+        {
+            co_await CoroutineTask::prefetch(node, prefetch_size);
+
+            /// Writers may have split or replaced the node while suspended; the pointer
+            /// is only valid while the node it was read from is unchanged.
+            if (parent_ptr.template get<Node<K, V>>()->is_version_valid(parent_version) == false)
+            {
+                node_ptr = parent_ptr;
+                is_prefetch = false;
+                continue;
+            }
+        }
+
+        const auto version = node->version();
+
+        // Is the node related to the key? If not, follow the right sibling;
+        // for inner nodes, pick the next related child.
+        auto next_node_ptr = mx::resource::ptr{};
+        auto value = std::optional<V>{std::nullopt};
+        if (node->high_key() <= this->_key)
+        {
+            next_node_ptr = node->right_sibling();
+        }
+        else if (node->is_inner())
+        {
+            next_node_ptr = node->child(this->_key);
+        }
+        else
+        {
+            // We are accessing the correct leaf.
+            const auto index = node->index(this->_key);
+            if (node->leaf_key(index) == this->_key)
+            {
+                value = node->value(index);
+            }
+        }
+
+        /// A writer modified the node while reading, read the node again.
+        if (node->is_version_valid(version) == false)
+        {
+            is_prefetch = false;
+            continue;
+        }
+
+        if (next_node_ptr == nullptr)
+        {
+            if (value.has_value())
+            {
+                this->_value = value.value();
+            }
+            break;
+        }
+
+        parent_ptr = node_ptr;
+        parent_version = version;
+        node_ptr = next_node_ptr;
+        is_prefetch = true;
+    }
+
+    this->_worker_id = worker_id;
+    co_return mx::tasking::TaskResult::make_remove();
+}
+} // namespace db::index::blinktree
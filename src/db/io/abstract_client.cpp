@@ -45,9 +45,17 @@ void AbstractClient::execute(std::string &&query)
     }
 
     /// Send the response to the server.
-    const auto response = this->_network_client.send(query);
+    auto response = this->_network_client.send(query);
     const auto *server_response = reinterpret_cast<const network::ServerResponse *>(response.data());
 
+    /// Results of queries may be streamed in chunks, followed by the final response.
+    while (server_response->type() == network::ServerResponse::Type::QueryResultChunk)
+    {
+        this->handle(reinterpret_cast<const network::QueryResultChunkResponse *>(server_response));
+        response = this->_network_client.receive();
+        server_response = reinterpret_cast<const network::ServerResponse *>(response.data());
+    }
+
     /// Process the response to the client.
     switch (server_response->type())
     {
@@ -108,5 +116,10 @@ void AbstractClient::execute(std::string &&query)
     case network::ServerResponse::Type::Times:
         this->handle(reinterpret_cast<const network::TimesResponse *>(server_response));
         break;
+    case network::ServerResponse::Type::TaskCycles:
+        this->handle(reinterpret_cast<const network::TaskCyclesResponse *>(server_response));
+        break;
+    case network::ServerResponse::Type::QueryResultChunk:
+        break;
     }
 }
\ No newline at end of file
@@ -29,6 +29,7 @@ protected:
     virtual void handle(const network::LogicalPlanResponse *response) = 0;
     virtual void handle(const network::TaskGraphResponse *response) = 0;
     virtual void handle(const network::QueryResultResponse *response) = 0;
+    virtual void handle(const network::QueryResultChunkResponse *response) = 0;
     virtual void handle(const network::PerformanceCounterResponse *response) = 0;
     virtual void handle(const network::SampleAssemblyResponse *response) = 0;
     virtual void handle(const network::SampleOperatorsResponse *response) = 0;
@@ -41,6 +42,7 @@ protected:
     virtual void handle(const network::DRAMBandwidthResponse *response) = 0;
     virtual void handle(const network::DataflowGraphResponse *response) = 0;
     virtual void handle(const network::TimesResponse *response) = 0;
+    virtual void handle(const network::TaskCyclesResponse *response) = 0;
 
 private:
     network::Client _network_client;
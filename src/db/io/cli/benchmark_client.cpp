@@ -27,6 +27,12 @@ void BenchmarkClient::handle(const network::TimesResponse *response)
     this->_results.emplace_back(run_id, response->time(), nlohmann::json::parse(response->data()));
 }
 
+void BenchmarkClient::handle(const network::TaskCyclesResponse *response)
+{
+    const auto run_id = this->_results.size();
+    this->_results.emplace_back(run_id, response->time(), nlohmann::json::parse(response->data()));
+}
+
 void BenchmarkClient::handle(const network::SampleMemoryResponse *response)
 {
     const auto run_id = this->_results.size();
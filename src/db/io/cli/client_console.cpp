@@ -1,6 +1,7 @@
 #include "client_console.h"
 #include "command_line_interface.h"
 #include "serialized_plan.h"
+#include <algorithm>
 #include <db/config.h>
 #include <fmt/core.h>
 #include <iostream>
@@ -54,6 +55,18 @@ void ClientConsole::handle(const network::GetConfigurationResponse *response)
     auto table = util::TextTable{{"Configuration", "Value"}};
 
     table.emplace_back({"Number of cores", fmt::format(" {}", configuration_json["cores"].get<std::uint16_t>())});
+    if (configuration_json.contains("task-cycles"))
+    {
+        table.emplace_back(
+            {"Task cycle accounting", configuration_json["task-cycles"].get<bool>() ? " enabled" : " disabled"});
+    }
+    if (configuration_json.contains("tasking"))
+    {
+        for (const auto &[name, value] : configuration_json["tasking"].items())
+        {
+            table.emplace_back({fmt::format("Tasking: {}", name), fmt::format(" {}", value.dump())});
+        }
+    }
 
     std::cout << table << std::flush;
 }
@@ -81,12 +94,25 @@ void ClientConsole::handle(const network::TaskGraphResponse *response)
 void ClientConsole::handle(const network::QueryResultResponse *response)
 {
     const auto query_result = QueryResult::deserialize(response->data());
-    std::cout << query_result.to_string() << "Fetched \033[1;32m" << response->count_rows() << "\033[0m row"
+
+    /// The last chunk of a streamed result may be empty; the records were printed before.
+    if (query_result.empty() == false || response->count_rows() == 0U)
+    {
+        std::cout << query_result.to_string();
+    }
+
+    std::cout << "Fetched \033[1;32m" << response->count_rows() << "\033[0m row"
               << (response->count_rows() == 1U ? "" : "s") << " in \033[1;33m"
               << fmt::format("{:.3f}", response->time().count() / 1000.0) << "\033[0m ms.\n"
               << std::flush;
 }
 
+void ClientConsole::handle(const network::QueryResultChunkResponse *response)
+{
+    const auto query_result = QueryResult::deserialize(response->data());
+    std::cout << query_result.to_string() << std::flush;
+}
+
 void ClientConsole::handle(const network::PerformanceCounterResponse *response)
 {
     auto text_table =
@@ -145,9 +171,38 @@ void ClientConsole::handle(const network::SampleMemoryHistoryResponse *response)
     std::cout << fmt::format("Wrote {} traces to '{}'.", samples.size(), output_file) << std::endl;
 }
 
-void ClientConsole::handle(const network::TaskLoadResponse * /*response*/)
+void ClientConsole::handle(const network::TaskLoadResponse *response)
 {
-    std::cout << "Can not handle task load." << std::endl;
+    auto data = std::string{reinterpret_cast<const char *>(response->data())};
+    auto task_load = nlohmann::json::parse(data);
+
+    /// Summarize the idle time that was spent spinning and parking.
+    auto parked_time = std::uint64_t(0U);
+    auto count_parks = std::uint64_t(0U);
+    auto max_wake_up_latency = std::uint64_t(0U);
+    for (const auto &parking_times : task_load["parking"])
+    {
+        parked_time += parking_times["parked"].get<std::uint64_t>();
+        count_parks += parking_times["count-parks"].get<std::uint64_t>();
+        max_wake_up_latency = std::max(max_wake_up_latency, parking_times["max-wake-up-latency"].get<std::uint64_t>());
+    }
+    std::cout << fmt::format("Idle (spinning) \033[1;33m{:.3f}\033[0m ms, parked \033[1;33m{:.3f}\033[0m ms "
+                             "({} parks, max. wake-up latency {:.3f} us).",
+                             task_load["busy-idle"].get<std::int64_t>() / 1000000.0, parked_time / 1000000.0,
+                             count_parks, max_wake_up_latency / 1000.0)
+              << std::endl;
+
+    std::cout << "Fetched \033[1;32m" << response->count_rows() << "\033[0m row"
+              << (response->count_rows() == 1U ? "" : "s") << " in \033[1;33m"
+              << fmt::format("{:.3f}", response->time().count() / 1000.0) << "\033[0m ms.\n"
+              << std::flush;
+
+    if (this->_output_file.has_value())
+    {
+        auto out_stream = std::ofstream{this->_output_file.value()};
+        out_stream << task_load.dump() << std::flush;
+        std::cout << fmt::format("Wrote task load to '{}'.", this->_output_file.value()) << std::endl;
+    }
 }
 
 void ClientConsole::handle(const network::TaskTraceResponse *response)
@@ -211,6 +266,20 @@ void ClientConsole::handle(const network::TimesResponse *response)
               << std::flush;
 }
 
+void ClientConsole::handle(const network::TaskCyclesResponse *response)
+{
+    auto text_table = util::TextTable::from_json({"Node", "Tasks", "Cycles", "Cycles/Task"},
+                                                 {"node", "tasks", "cycles", "cycles-per-task"},
+                                                 nlohmann::json::parse(response->data()));
+
+    std::cout << text_table << std::flush;
+
+    const auto count_records = response->count_records().value_or(0UL);
+    std::cout << "Fetched \033[1;32m" << count_records << "\033[0m row" << (count_records == 1U ? "" : "s")
+              << " in \033[1;33m" << fmt::format("{:.3f}", response->time().count() / 1000.0) << "\033[0m ms.\n"
+              << std::flush;
+}
+
 void ClientConsole::listen()
 {
     const auto quit_regex = std::regex{"q|quit", std::regex_constants::icase};
@@ -243,6 +312,8 @@ void ClientConsole::listen()
                 << "    .table <name>         List all columns of a specific table.\n"
                 << "    .config               Show the configuration of the system.\n"
                 << "    .set cores <count>    Use <count> cores for query execution.\n"
+                << "    .set task cycles true|false\n"
+                << "                          Switches the accounting of task cycles per operator on or off.\n"
                 << "    <query>               Executes a query.\n"
                 << "    compile <query>       Compiles the given query using flounder and executes it.\n"
                 << "    explain <query>       Shows the logical plan of a query.\n"
@@ -253,6 +324,8 @@ void ClientConsole::listen()
                 << "    explain asm <query>   Shows the generated assembly for the specified query.\n"
                 << "    explain performance [compile] <query>\n"
                 << "                          Executes the query and shows the performance.\n"
+                << "    explain task cycles <query>\n"
+                << "                          Executes the query and shows the cycles spent per operator.\n"
                 << "    sample <counter> compile <query>\n"
                 << "                          Records hardware events by the given counter and samples\n"
                 << "                          instructions. The jitted assembly code will be shown with\n"
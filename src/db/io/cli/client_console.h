@@ -43,6 +43,7 @@ protected:
     void handle(const network::LogicalPlanResponse *response) override;
     void handle(const network::TaskGraphResponse *response) override;
     void handle(const network::QueryResultResponse *response) override;
+    void handle(const network::QueryResultChunkResponse *response) override;
     void handle(const network::PerformanceCounterResponse *response) override;
     void handle(const network::SampleAssemblyResponse *response) override;
     void handle(const network::SampleOperatorsResponse *response) override;
@@ -55,6 +56,7 @@ protected:
     void handle(const network::DRAMBandwidthResponse *response) override;
     void handle(const network::DataflowGraphResponse *response) override;
     void handle(const network::TimesResponse *response) override;
+    void handle(const network::TaskCyclesResponse *response) override;
 
 private:
     bool _is_running{true};
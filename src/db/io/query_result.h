@@ -3,6 +3,7 @@
 #include <db/execution/record_token.h>
 #include <db/topology/physical_schema.h>
 #include <memory>
+#include <mx/memory/slab_allocator.h>
 #include <nlohmann/json.hpp>
 #include <utility>
 #include <vector>
@@ -32,6 +33,16 @@ public:
         std::move(records.begin(), records.end(), std::back_inserter(_records));
     }
 
+    /**
+     * Keeps the arena the result tiles were allocated from alive until the result is freed.
+     *
+     * @param slab_arena Arena of the query.
+     */
+    void slab_arena(std::shared_ptr<mx::memory::slab::Arena> slab_arena) noexcept
+    {
+        _slab_arena = std::move(slab_arena);
+    }
+
     [[nodiscard]] const topology::PhysicalSchema &schema() const noexcept { return _schema; }
     [[nodiscard]] const std::vector<execution::RecordSet> &records() const noexcept { return _records; }
     [[nodiscard]] std::uint64_t count_records() const noexcept { return _count_records; }
@@ -46,6 +57,10 @@ public:
 
 private:
     topology::PhysicalSchema _schema;
+
+    /// Arena of the query; has to be freed after the records.
+    std::shared_ptr<mx::memory::slab::Arena> _slab_arena{nullptr};
+
     std::vector<execution::RecordSet> _records;
     std::uint64_t _count_records{0U};
 };
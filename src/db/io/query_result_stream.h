@@ -0,0 +1,262 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <db/execution/record_token.h>
+#include <db/io/query_result.h>
+#include <db/topology/physical_schema.h>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <mx/memory/slab_allocator.h>
+#include <mx/synchronization/spinlock.h>
+#include <mx/tasking/dataflow/producer.h>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace db::io {
+/**
+ * Result of a query that is sent to the client in chunks while the query
+ * is still running. Records are cut into chunks in the order they arrive;
+ * sealed chunks wait in a queue until a single sender writes them to the
+ * client socket, keeping the chunks in order.
+ */
+class QueryResultStream
+{
+public:
+    /**
+     * A sealed chunk; the last chunk of a stream completes the result
+     * or carries the error that aborted the query.
+     */
+    class Chunk
+    {
+    public:
+        Chunk(std::unique_ptr<QueryResult> &&result, const bool is_last) noexcept
+            : _result(std::move(result)), _is_last(is_last)
+        {
+        }
+        explicit Chunk(std::string &&error) noexcept : _is_last(true), _error(std::move(error)) {}
+        Chunk(Chunk &&) noexcept = default;
+        ~Chunk() noexcept = default;
+
+        [[nodiscard]] std::unique_ptr<QueryResult> &result() noexcept { return _result; }
+        [[nodiscard]] bool is_last() const noexcept { return _is_last; }
+        [[nodiscard]] std::optional<std::string> &error() noexcept { return _error; }
+
+    private:
+        std::unique_ptr<QueryResult> _result{nullptr};
+        bool _is_last;
+        std::optional<std::string> _error{std::nullopt};
+    };
+
+    /**
+     * @param client_id Client the result is sent to.
+     * @param schema Schema of the result.
+     * @param chunk_records Number of records that seal a chunk.
+     * @param max_sealed_chunks Number of sealed chunks that congest the stream.
+     */
+    QueryResultStream(const std::uint32_t client_id, const topology::PhysicalSchema &schema,
+                      const std::uint64_t chunk_records, const std::uint64_t max_sealed_chunks) noexcept
+        : _client_id(client_id), _schema(schema), _chunk_records(chunk_records), _max_sealed_chunks(max_sealed_chunks)
+    {
+    }
+
+    ~QueryResultStream() noexcept = default;
+
+    [[nodiscard]] std::uint32_t client_id() const noexcept { return _client_id; }
+
+    /**
+     * Appends records to the open chunk and seals the chunk when it is full.
+     *
+     * @param records Records to append.
+     * @param slab_arena Arena the records were allocated from.
+     * @param producers Graph producing the records; its producers paused by the congested
+     *  stream are resumed by the sender.
+     * @return True, if a chunk was sealed and the caller has to start a sender.
+     */
+    [[nodiscard]] bool add(execution::RecordSet &&records, const std::shared_ptr<mx::memory::slab::Arena> &slab_arena,
+                           mx::tasking::dataflow::EmitterInterface<execution::RecordSet> *producers = nullptr)
+    {
+        const auto count_records = records.tile().get<data::PaxTile>()->size();
+
+        std::unique_lock lock{_latch};
+        _producers = producers;
+        _open_records.emplace_back(std::move(records));
+        _count_open_records += count_records;
+        _count_records += count_records;
+        _count_pending_tiles.fetch_add(1U, std::memory_order_relaxed);
+
+        if (_count_open_records < _chunk_records)
+        {
+            return false;
+        }
+
+        this->seal(slab_arena, false);
+        return this->acquire_sender();
+    }
+
+    /**
+     * Seals the open chunk as the last one; no records can be added afterwards.
+     *
+     * @param time Time the query took.
+     * @param slab_arena Arena the records were allocated from.
+     * @return True, if the caller has to start a sender.
+     */
+    [[nodiscard]] bool close(const std::chrono::microseconds time,
+                             const std::shared_ptr<mx::memory::slab::Arena> &slab_arena)
+    {
+        std::unique_lock lock{_latch};
+        _time = time;
+        _producers = nullptr;
+        this->seal(slab_arena, true);
+        return this->acquire_sender();
+    }
+
+    /**
+     * Hands the next sealed chunk to the sender. When no chunk is waiting,
+     * the sender is released and has to stop.
+     *
+     * @return The next chunk, if any.
+     */
+    [[nodiscard]] std::optional<Chunk> next()
+    {
+        std::unique_lock lock{_latch};
+        if (_sealed_chunks.empty())
+        {
+            _is_sending = false;
+            return std::nullopt;
+        }
+
+        auto chunk = std::move(_sealed_chunks.front());
+        _sealed_chunks.pop_front();
+        _count_sealed_chunks.store(_sealed_chunks.size());
+        if (chunk.result() != nullptr)
+        {
+            _count_pending_tiles.fetch_sub(chunk.result()->records().size(), std::memory_order_relaxed);
+        }
+        return std::make_optional(std::move(chunk));
+    }
+
+    /**
+     * Resumes the producers that paused while the stream was congested;
+     * called by the sender after it took chunks.
+     *
+     * @param worker_id Worker of the sender.
+     */
+    void resume_producers(const std::uint16_t worker_id)
+    {
+        std::unique_lock lock{_latch};
+        if (_producers != nullptr)
+        {
+            _producers->resume_producers(worker_id);
+        }
+    }
+
+    /**
+     * Discards all records that were not sent and closes the stream with an error.
+     *
+     * @param error Error that aborted the query.
+     * @return True, if the caller has to start a sender.
+     */
+    [[nodiscard]] bool fail(std::string &&error)
+    {
+        std::unique_lock lock{_latch};
+        _producers = nullptr;
+        _open_records.clear();
+        _sealed_chunks.clear();
+        _count_open_records = 0U;
+        _count_pending_tiles.store(0U, std::memory_order_relaxed);
+        _sealed_chunks.emplace_back(std::move(error));
+        _count_sealed_chunks.store(_sealed_chunks.size(), std::memory_order_relaxed);
+        return this->acquire_sender();
+    }
+
+    /**
+     * @return Number of records of all chunks, sent or not; read by the sender of the last chunk.
+     */
+    [[nodiscard]] std::uint64_t count_records() const noexcept { return _count_records; }
+
+    /**
+     * @return Time the query took; known when the stream was closed.
+     */
+    [[nodiscard]] std::chrono::microseconds time() const noexcept { return _time; }
+
+    /**
+     * @return Number of tiles that were added but not handed to the sender, yet.
+     */
+    [[nodiscard]] std::uint64_t count_pending_tiles() const noexcept
+    {
+        return _count_pending_tiles.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return True, if the maximal number of sealed chunks waits for the client;
+     *  producers should pause until the sender caught up.
+     */
+    [[nodiscard]] bool is_congested() const noexcept
+    {
+        return _count_sealed_chunks.load(std::memory_order_relaxed) >= _max_sealed_chunks;
+    }
+
+private:
+    const std::uint32_t _client_id;
+    const topology::PhysicalSchema _schema;
+
+    /// Number of records that seal a chunk.
+    const std::uint64_t _chunk_records;
+
+    /// Number of sealed chunks that congest the stream.
+    const std::uint64_t _max_sealed_chunks;
+
+    /// Protects the open and sealed chunks.
+    mx::synchronization::Spinlock _latch{};
+
+    /// Records of the chunk that is not full, yet.
+    std::vector<execution::RecordSet> _open_records;
+    std::uint64_t _count_open_records{0U};
+
+    /// Full chunks, waiting for the sender.
+    std::deque<Chunk> _sealed_chunks;
+
+    /// True, while a sender is writing the sealed chunks to the client.
+    bool _is_sending{false};
+
+    /// Graph producing the records, until the stream is closed; the stream may outlive the graph.
+    mx::tasking::dataflow::EmitterInterface<execution::RecordSet> *_producers{nullptr};
+
+    /// Number of records of all chunks; complete when the stream was closed.
+    std::uint64_t _count_records{0U};
+
+    /// Number of tiles not handed to the sender; read by producers without the latch.
+    std::atomic_uint64_t _count_pending_tiles{0U};
+
+    /// Number of sealed chunks; read by producers without the latch.
+    std::atomic_uint64_t _count_sealed_chunks{0U};
+
+    std::chrono::microseconds _time{0U};
+
+    void seal(const std::shared_ptr<mx::memory::slab::Arena> &slab_arena, const bool is_last)
+    {
+        auto result = std::make_unique<QueryResult>(_schema);
+        result->slab_arena(slab_arena);
+        result->add(std::move(_open_records));
+        _open_records.clear();
+        _count_open_records = 0U;
+        _sealed_chunks.emplace_back(std::move(result), is_last);
+        _count_sealed_chunks.store(_sealed_chunks.size(), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool acquire_sender() noexcept
+    {
+        if (_is_sending)
+        {
+            return false;
+        }
+
+        _is_sending = true;
+        return true;
+    }
+};
+} // namespace db::io
@@ -1,6 +1,9 @@
 #include "planning_task.h"
 #include "load_file_task.h"
 #include "send_result_task.h"
+#include <algorithm>
+#include <cctype>
+#include <db/exception/execution_exception.h>
 #include <db/exception/parser_exception.h>
 #include <db/network/protocol/server_response.h>
 #include <db/parser/sql_parser.h>
@@ -9,6 +12,7 @@
 #include <db/plan/physical/compilation_plan.h>
 #include <db/plan/physical/interpretation_graph.h>
 #include <db/storage/serializer.h>
+#include <fmt/core.h>
 #include <mx/tasking/runtime.h>
 
 using namespace db::io;
@@ -108,13 +112,14 @@ mx::tasking::TaskResult PlanningTask::execute(const std::uint16_t worker_id)
         const auto is_explain_task_traces = logical_plan.is_explain_task_traces();
         const auto is_explain_dram_bandwidth = logical_plan.is_explain_dram_bandwidth();
         const auto is_explain_times = logical_plan.is_explain_times();
+        const auto is_explain_task_cycles = logical_plan.is_explain_task_cycles();
 
         if (is_explain_task_traces) [[unlikely]]
         {
-            if constexpr (mx::tasking::config::is_collect_task_traces() == false)
+            if (mx::tasking::runtime::configuration().is_collect_task_traces() == false)
             {
                 throw db::exception::ExecutionException{
-                    "Collecting Task Traces is disabled. Plase enable first (in src/mx/tasking/config.h)."};
+                    "Collecting Task Traces is disabled. Plase enable first (.SET task_traces TRUE)."};
             }
         }
 
@@ -127,7 +132,8 @@ mx::tasking::TaskResult PlanningTask::execute(const std::uint16_t worker_id)
             const auto is_explain_assembly = logical_plan.is_explain_assembly();
 
             /// Map logical nodes to physical operators.
-            auto compilation_plan = plan::physical::CompilationPlan::build(this->_database, std::move(logical_plan));
+            auto compilation_plan = plan::physical::CompilationPlan::build(this->_database, std::move(logical_plan),
+                                                                           this->_configuration.memory_limit());
 
             /// Create tags for memory, if recording memory traces.
             if (logical_plan.sample_type().has_value() &&
@@ -162,10 +168,13 @@ mx::tasking::TaskResult PlanningTask::execute(const std::uint16_t worker_id)
                 this->_database, chronometer, std::move(compilation_plan), this->_client_id, is_explain_performance,
                 is_explain_task_load, is_explain_task_traces, is_explain_flounder, is_explain_assembly,
                 is_explain_dram_bandwidth, is_explain_task_graph, is_explain_data_flow_graph, is_explain_times,
-                logical_plan.sample_type(), this->_database.profiling_counter());
+                is_explain_task_cycles, logical_plan.sample_type(), this->_database.profiling_counter());
             chronometer->lap(util::Chronometer::Id::GeneratingFlounder);
 
             auto *compilation_graph = reinterpret_cast<plan::physical::CompilationGraph *>(dataflow_graph);
+
+            /// Scans pull morsels only when switched on (.set morsel_scans).
+            compilation_graph->use_morsel_driven_scans(this->_configuration.is_use_morsel_driven_scans());
             if (is_explain_task_graph == false) [[likely]]
             {
                 if (is_explain_flounder) [[unlikely]]
@@ -231,6 +240,9 @@ mx::tasking::TaskResult PlanningTask::execute(const std::uint16_t worker_id)
             mx::tasking::runtime::start_tracing();
         }
 
+        /// All tasks of the query run with the priority chosen for queries (.set query_priority).
+        dataflow_graph->priority(this->_configuration.query_priority());
+
         /// Start the perf counter and/or perf sample, if any.
         chronometer->start_perf();
 
@@ -268,10 +280,196 @@ mx::tasking::TaskResult PlanningTask::handle_configuration_request(const std::ui
     if (typeid(*root) == typeid(plan::logical::SetCoresNode))
     {
         auto *set_cores_node = reinterpret_cast<plan::logical::SetCoresNode *>(root.get());
-        this->_configuration.count_cores(set_cores_node->count_cores());
+        const auto count_cores = set_cores_node->count_cores();
+
+        /// Resize the set of workers without restarting the runtime, when possible.
+        if constexpr (mx::tasking::config::is_allow_resizing_workers())
+        {
+            if (count_cores > 0U && count_cores <= mx::tasking::runtime::max_workers())
+            {
+                /// Running queries partitioned their work by the number of workers; the workers are resized
+                /// (and the tiles re-homed) once they completed, before the next query starts.
+                mx::tasking::runtime::resize(count_cores, [&database = this->_database](const auto count_workers) {
+                    database.rebalance_tiles(count_workers);
+                });
+                this->_configuration.count_cores(count_cores);
+                mx::tasking::runtime::send_message(this->_client_id, network::SuccessResponse::to_string());
+                return mx::tasking::TaskResult::make_remove();
+            }
+        }
+
+        this->_configuration.count_cores(count_cores);
+        mx::tasking::runtime::send_message(this->_client_id, network::SuccessResponse::to_string());
+        return mx::tasking::TaskResult::make_stop(worker_id, false);
+    }
+
+    if (typeid(*root) == typeid(plan::logical::SetTaskCyclesNode))
+    {
+        auto *set_task_cycles_node = reinterpret_cast<plan::logical::SetTaskCyclesNode *>(root.get());
+        mx::tasking::runtime::account_task_cycles(set_task_cycles_node->is_enabled());
+        mx::tasking::runtime::send_message(this->_client_id, network::SuccessResponse::to_string());
+        return mx::tasking::TaskResult::make_remove();
+    }
+
+    if (typeid(*root) == typeid(plan::logical::SetTaskingNode))
+    {
+        auto *set_tasking_node = reinterpret_cast<plan::logical::SetTaskingNode *>(root.get());
+
+        /// The memory limit, the priority, and morsel scans apply to following queries, the runtime keeps running.
+        auto name = set_tasking_node->name();
+        std::transform(name.begin(), name.end(), name.begin(), [](const auto c) { return std::tolower(c); });
+        if (name == "memory_limit")
+        {
+            this->_configuration.memory_limit(std::stoull(set_tasking_node->value()));
+            mx::tasking::runtime::send_message(this->_client_id, network::SuccessResponse::to_string());
+            return mx::tasking::TaskResult::make_remove();
+        }
+
+        if (name == "query_priority")
+        {
+            this->_configuration.query_priority(PlanningTask::to_priority(set_tasking_node->value()));
+            mx::tasking::runtime::send_message(this->_client_id, network::SuccessResponse::to_string());
+            return mx::tasking::TaskResult::make_remove();
+        }
+
+        if (name == "morsel_scans")
+        {
+            auto value = set_tasking_node->value();
+            std::transform(value.begin(), value.end(), value.begin(), [](const auto c) { return std::tolower(c); });
+            if (value != "true" && value != "false")
+            {
+                throw exception::ExecutionException{"Setting 'morsel_scans' expects TRUE or FALSE."};
+            }
+
+            this->_configuration.is_use_morsel_driven_scans(value == "true");
+            mx::tasking::runtime::send_message(this->_client_id, network::SuccessResponse::to_string());
+            return mx::tasking::TaskResult::make_remove();
+        }
+
+        auto tasking_config = this->_configuration.tasking();
+        PlanningTask::apply_tasking_setting(tasking_config, set_tasking_node->name(), set_tasking_node->value());
+
+        /// The runtime is restarted with the new settings (like changing the number of cores).
+        this->_configuration.tasking() = tasking_config;
         mx::tasking::runtime::send_message(this->_client_id, network::SuccessResponse::to_string());
         return mx::tasking::TaskResult::make_stop(worker_id, false);
     }
 
     throw exception::ExecutionException{"Configuration not implemented."};
+}
+
+mx::tasking::priority PlanningTask::to_priority(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(), [](const auto c) { return std::tolower(c); });
+    if (value == "low")
+    {
+        return mx::tasking::priority::low;
+    }
+    if (value == "normal")
+    {
+        return mx::tasking::priority::normal;
+    }
+    if (value == "high")
+    {
+        return mx::tasking::priority::high;
+    }
+    if (value == "critical")
+    {
+        return mx::tasking::priority::critical;
+    }
+
+    throw exception::ExecutionException{"Setting 'query_priority' expects 'low', 'normal', 'high', or 'critical'."};
+}
+
+void PlanningTask::apply_tasking_setting(mx::tasking::runtime_config &tasking_config, std::string name,
+                                         std::string value)
+{
+    /// Like keywords, names and values are case insensitive.
+    const auto to_lower = [](std::string &text) {
+        std::transform(text.begin(), text.end(), text.begin(), [](const auto c) { return std::tolower(c); });
+    };
+    to_lower(name);
+    to_lower(value);
+
+    const auto to_bool = [&name, &value]() {
+        if (value == "true" || value == "false")
+        {
+            return value == "true";
+        }
+        throw exception::ExecutionException{fmt::format("Setting '{}' expects TRUE or FALSE.", name)};
+    };
+
+    if (name == "task_buffer_size")
+    {
+        const auto size = std::stoul(value);
+        if (size == 0U || size > mx::tasking::config::task_buffer_size())
+        {
+            throw exception::ExecutionException{fmt::format("Setting '{}' expects a value between 1 and {}.", name,
+                                                            mx::tasking::config::task_buffer_size())};
+        }
+        tasking_config.task_buffer_size(std::uint16_t(size));
+    }
+    else if (name == "queue")
+    {
+        if (value == "numa_shared")
+        {
+            tasking_config.queue(mx::tasking::config::queue_backend::NUMAShared);
+        }
+        else if (value == "worker")
+        {
+            tasking_config.queue(mx::tasking::config::queue());
+        }
+        else
+        {
+            throw exception::ExecutionException{"Setting 'queue' expects 'worker' or 'numa_shared'."};
+        }
+    }
+    else if (name == "memory_reclamation")
+    {
+        if (value == "none")
+        {
+            tasking_config.memory_reclamation(mx::tasking::config::None);
+        }
+        else if (value == "read")
+        {
+            tasking_config.memory_reclamation(mx::tasking::config::UpdateEpochOnRead);
+        }
+        else if (value == "periodic")
+        {
+            tasking_config.memory_reclamation(mx::tasking::config::UpdateEpochPeriodically);
+        }
+        else if (value == "qsbr")
+        {
+            tasking_config.memory_reclamation(mx::tasking::config::QuiescentStateBased);
+        }
+        else
+        {
+            throw exception::ExecutionException{
+                "Setting 'memory_reclamation' expects 'none', 'read', 'periodic', or 'qsbr'."};
+        }
+    }
+    else if (name == "memory_compaction_interval")
+    {
+        tasking_config.memory_compaction_interval(std::uint32_t(std::stoul(value)));
+    }
+    else if (name == "task_counter")
+    {
+        tasking_config.use_task_counter(to_bool());
+    }
+    else if (name == "task_traces")
+    {
+        tasking_config.collect_task_traces(to_bool());
+    }
+    else if (name == "graph_times")
+    {
+        tasking_config.record_graph_times(to_bool());
+    }
+    else if (name == "resource_bound_workers")
+    {
+        tasking_config.consider_resource_bound_workers(to_bool());
+    }
+    else
+    {
+        throw exception::ExecutionException{fmt::format("Unknown setting '{}'.", name)};
+    }
 }
\ No newline at end of file
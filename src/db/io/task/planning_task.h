@@ -5,6 +5,7 @@
 #include <db/topology/database.h>
 #include <db/util/chronometer.h>
 #include <memory>
+#include <mx/tasking/runtime_config.h>
 #include <mx/tasking/task.h>
 #include <string>
 
@@ -32,6 +33,26 @@ private:
 
     [[nodiscard]] mx::tasking::TaskResult handle_configuration_request(std::uint16_t worker_id,
                                                                        plan::logical::Plan &&logical_plan);
+
+    /**
+     * Applies a single setting of the tasking runtime (e.g., "task_buffer_size" = "32").
+     * Throws an exception, if the setting or the value is unknown.
+     *
+     * @param tasking_config Settings to change.
+     * @param name Name of the setting.
+     * @param value Value of the setting.
+     */
+    static void apply_tasking_setting(mx::tasking::runtime_config &tasking_config, std::string name,
+                                      std::string value);
+
+    /**
+     * Parses the priority of queries ("low", "normal", "high", or "critical").
+     * Throws an exception, if the value is unknown.
+     *
+     * @param value Name of the priority.
+     * @return The priority.
+     */
+    [[nodiscard]] static mx::tasking::priority to_priority(std::string value);
 };
 
 class RunQueryTask final : public mx::tasking::TaskInterface
@@ -1,4 +1,6 @@
 #include "send_result_task.h"
+#include <algorithm>
+#include <array>
 #include <db/config.h>
 #include <db/network/protocol/server_response.h>
 #include <fmt/core.h>
@@ -24,6 +26,62 @@ mx::tasking::TaskResult SendQueryResultTask::execute(const std::uint16_t /*worke
     return mx::tasking::TaskResult::make_remove();
 }
 
+mx::tasking::TaskResult SendQueryResultStreamTask::execute(const std::uint16_t worker_id)
+{
+    /// Backing off from a client that did not catch up; checking the socket costs a system call.
+    if (this->_backoff.count() > 0U && std::chrono::steady_clock::now() < this->_retry_time)
+    {
+        return mx::tasking::TaskResult::make_succeed(this);
+    }
+
+    const auto client_id = this->_stream->client_id();
+
+    while (mx::tasking::runtime::count_pending_message_bytes(client_id) < config::max_pending_result_bytes())
+    {
+        auto chunk = this->_stream->next();
+        if (chunk.has_value() == false)
+        {
+            /// Producers will start a new sender with the next sealed chunk.
+            return mx::tasking::TaskResult::make_remove();
+        }
+
+        /// Producers parked by the congested stream can continue.
+        this->_stream->resume_producers(worker_id);
+
+        if (chunk->error().has_value())
+        {
+            mx::tasking::runtime::send_message(client_id,
+                                               network::ErrorResponse::to_string(std::move(chunk->error().value())));
+        }
+        else if (chunk->is_last() == false)
+        {
+            mx::tasking::runtime::send_message(
+                client_id, network::QueryResultChunkResponse::to_string(std::move(*chunk->result())));
+        }
+        else if (chunk->result()->schema().empty())
+        {
+            mx::tasking::runtime::send_message(client_id, network::SuccessResponse::to_string());
+        }
+        else
+        {
+            mx::tasking::runtime::send_message(
+                client_id, network::QueryResultResponse::to_string(
+                               this->_stream->time(), this->_stream->count_records(), std::move(*chunk->result())));
+        }
+
+        this->_backoff = std::chrono::microseconds{0U};
+    }
+
+    /// The client does not keep up; try again later, keeping the sealed chunks in order.
+    /// The sender keeps the priority of the query: Producers waiting for the stream
+    /// are parked until the sender drained it and must not hold the sender back.
+    this->_backoff = std::clamp(this->_backoff * 2U, std::chrono::microseconds{config::min_result_send_backoff()},
+                                std::chrono::microseconds{config::max_result_send_backoff()});
+    this->_retry_time = std::chrono::steady_clock::now() + this->_backoff;
+    this->annotate(worker_id);
+    return mx::tasking::TaskResult::make_succeed(this);
+}
+
 mx::tasking::TaskResult SendErrorTask::execute(const std::uint16_t /*worker_id*/)
 {
     mx::tasking::runtime::send_message(this->_client_id, network::ErrorResponse::to_string(std::move(this->_error)));
@@ -108,6 +166,21 @@ mx::tasking::TaskResult SendPerformanceCounterTask::execute(const std::uint16_t
     performance_result.emplace_back(nlohmann::json{
         {"name", "Total Time (ms)"}, {"result", this->_performance_result->microseconds().count() / 1000.0}});
 
+    /// Memory of the query.
+    if (this->_memory_usage.has_value())
+    {
+        const auto to_mb = [](const std::uint64_t bytes) { return bytes / (1024.0 * 1024.0); };
+        performance_result.emplace_back(
+            nlohmann::json{{"name", "Peak Memory (MB)"}, {"result", to_mb(this->_memory_usage->peak())}});
+        performance_result.emplace_back(
+            nlohmann::json{{"name", "Current Memory (MB)"}, {"result", to_mb(this->_memory_usage->current())}});
+        if (this->_memory_usage->limit() > 0U)
+        {
+            performance_result.emplace_back(
+                nlohmann::json{{"name", "Memory Limit (MB)"}, {"result", to_mb(this->_memory_usage->limit())}});
+        }
+    }
+
     /// Performance Counter.
     for (const auto &[name, value] :
          this->_performance_result->result(util::Chronometer::Id::Executing).performance_counter())
@@ -117,7 +190,7 @@ mx::tasking::TaskResult SendPerformanceCounterTask::execute(const std::uint16_t
     }
 
     /// Executed Tasks.
-    if constexpr (mx::tasking::config::is_use_task_counter())
+    if (mx::tasking::runtime::configuration().is_use_task_counter())
     {
         for (auto worker_id = 0U;
              worker_id < this->_performance_result->result(util::Chronometer::Id::Executing).task_counter().size();
@@ -261,6 +334,26 @@ mx::tasking::TaskResult SendConfigurationTask::execute(const std::uint16_t /*wor
     auto configuration = nlohmann::json{};
     configuration["cores"] = this->_configuration.count_cores();
     configuration["cores-available"] = mx::system::cpu::count_cores();
+    configuration["task-cycles"] = mx::tasking::runtime::is_accounting_task_cycles();
+    configuration["memory-limit"] = this->_configuration.memory_limit();
+    constexpr auto priority_names = std::array<const char *, 4U>{"low", "normal", "high", "critical"};
+    configuration["query-priority"] = priority_names[this->_configuration.query_priority()];
+    configuration["morsel-scans"] = this->_configuration.is_use_morsel_driven_scans();
+
+    const auto &tasking = mx::tasking::runtime::configuration();
+    configuration["tasking"] = nlohmann::json{
+        {"queue", tasking.queue() == mx::tasking::config::queue_backend::NUMAShared ? "numa_shared" : "worker"},
+        {"task_buffer_size", tasking.task_buffer_size()},
+        {"memory_reclamation",
+         tasking.memory_reclamation() == mx::tasking::config::None                      ? "none"
+         : tasking.memory_reclamation() == mx::tasking::config::UpdateEpochOnRead       ? "read"
+         : tasking.memory_reclamation() == mx::tasking::config::UpdateEpochPeriodically ? "periodic"
+                                                                                         : "qsbr"},
+        {"memory_compaction_interval", tasking.memory_compaction_interval()},
+        {"task_counter", tasking.is_use_task_counter()},
+        {"task_traces", tasking.is_collect_task_traces()},
+        {"graph_times", tasking.is_record_graph_times()},
+        {"resource_bound_workers", tasking.is_consider_resource_bound_workers()}};
 
     mx::tasking::runtime::send_message(this->_client_id,
                                        network::GetConfigurationResponse::to_string(configuration.dump()));
@@ -315,5 +408,24 @@ mx::tasking::TaskResult SendTimesTask::execute(const std::uint16_t /*worker_id*/
     mx::tasking::runtime::send_message(
         this->_client_id, network::TimesResponse ::to_string(this->_time, this->_count_records, times.dump()));
 
+    return mx::tasking::TaskResult::make_remove();
+}
+
+mx::tasking::TaskResult SendTaskCyclesTask::execute(const std::uint16_t /*worker_id*/)
+{
+    auto task_cycles = nlohmann::json::array();
+
+    for (auto &[node, cycles] : this->_node_cycles)
+    {
+        task_cycles.emplace_back(nlohmann::json{{"node", std::move(node)},
+                                                {"tasks", cycles.count()},
+                                                {"cycles", cycles.cycles()},
+                                                {"cycles-per-task", cycles.average()}});
+    }
+
+    mx::tasking::runtime::send_message(
+        this->_client_id,
+        network::TaskCyclesResponse::to_string(this->_time, this->_count_records, task_cycles.dump()));
+
     return mx::tasking::TaskResult::make_remove();
 }
\ No newline at end of file
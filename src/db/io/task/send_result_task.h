@@ -1,11 +1,16 @@
 #pragma once
 
+#include <chrono>
 #include <db/io/query_result.h>
+#include <db/io/query_result_stream.h>
 #include <db/topology/configuration.h>
 #include <db/util/chronometer.h>
 #include <memory>
+#include <mx/memory/budget.h>
+#include <mx/tasking/profiling/task_cycle_accounting.h>
 #include <mx/tasking/profiling/time.h>
 #include <mx/tasking/task.h>
+#include <optional>
 #include <perf/imc/dram_bandwidth_monitor.h>
 #include <string>
 
@@ -34,6 +39,34 @@ private:
     std::unique_ptr<QueryResult> _result;
 };
 
+/**
+ * Writes the sealed chunks of a streamed query result to the client, in order.
+ * While the socket of the client holds too many bytes that were not
+ * acknowledged, the task yields instead of blocking the worker. Producers
+ * paused by the congested stream are resumed whenever a chunk was taken.
+ */
+class SendQueryResultStreamTask final : public mx::tasking::TaskInterface
+{
+public:
+    explicit SendQueryResultStreamTask(std::shared_ptr<QueryResultStream> stream) noexcept
+        : _stream(std::move(stream))
+    {
+    }
+
+    ~SendQueryResultStreamTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(std::uint16_t worker_id) override;
+
+private:
+    std::shared_ptr<QueryResultStream> _stream;
+
+    /// Time to wait until the socket is checked again, grows while the client does not catch up.
+    std::chrono::microseconds _backoff{0U};
+
+    /// Time when the socket is checked again.
+    std::chrono::steady_clock::time_point _retry_time;
+};
+
 class SendErrorTask final : public mx::tasking::TaskInterface
 {
 public:
@@ -54,8 +87,10 @@ class SendPerformanceCounterTask final : public mx::tasking::TaskInterface
 {
 public:
     SendPerformanceCounterTask(const std::uint32_t client_id, const std::uint64_t count_records,
-                               std::shared_ptr<util::Chronometer> &&performance_result) noexcept
-        : _client_id(client_id), _count_records(count_records), _performance_result(std::move(performance_result))
+                               std::shared_ptr<util::Chronometer> &&performance_result,
+                               const std::optional<mx::memory::Budget::Usage> memory_usage = std::nullopt) noexcept
+        : _client_id(client_id), _count_records(count_records), _performance_result(std::move(performance_result)),
+          _memory_usage(memory_usage)
     {
     }
 
@@ -68,6 +103,9 @@ private:
     const std::uint64_t _count_records;
     std::shared_ptr<util::Chronometer> _performance_result;
 
+    /// Memory of the query, if accounted.
+    const std::optional<mx::memory::Budget::Usage> _memory_usage;
+
     [[nodiscard]] float time(util::Chronometer::Id lap_id) const;
 };
 
@@ -275,4 +313,24 @@ private:
     const std::uint64_t _count_records;
     std::vector<std::pair<std::string, std::uint64_t>> _node_times;
 };
+
+class SendTaskCyclesTask final : public mx::tasking::TaskInterface
+{
+public:
+    SendTaskCyclesTask(const std::uint32_t client_id, const std::chrono::microseconds time,
+                       const std::uint64_t count_records,
+                       std::vector<std::pair<std::string, mx::tasking::profiling::TaskCycles>> &&node_cycles) noexcept
+        : _client_id(client_id), _time(time), _count_records(count_records), _node_cycles(std::move(node_cycles))
+    {
+    }
+    ~SendTaskCyclesTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(std::uint16_t worker_id) override;
+
+private:
+    const std::uint32_t _client_id;
+    const std::chrono::microseconds _time;
+    const std::uint64_t _count_records;
+    std::vector<std::pair<std::string, mx::tasking::profiling::TaskCycles>> _node_cycles;
+};
 } // namespace db::io
\ No newline at end of file
@@ -137,11 +137,30 @@ void WebRequestClient::handle(const network::QueryResultResponse *response)
 
     auto web_response = nlohmann::json{{"type", "data"}};
     web_response["result"] = query_result.to_json();
+    if (this->_streamed_rows.empty() == false)
+    {
+        auto &rows = web_response["result"]["rows"];
+        for (auto &row : rows)
+        {
+            this->_streamed_rows.emplace_back(std::move(row));
+        }
+        rows = std::move(this->_streamed_rows);
+        this->_streamed_rows = nlohmann::json::array();
+    }
     web_response["count-rows"] = response->count_rows();
     web_response["ms"] = fmt::format("{:.3f}", response->time().count() / 1000.0);
     this->_http_response.set_content(web_response.dump(), "text/json");
 }
 
+void WebRequestClient::handle(const network::QueryResultChunkResponse *response)
+{
+    auto chunk = QueryResult::deserialize(response->data()).to_json();
+    for (auto &row : chunk["rows"])
+    {
+        this->_streamed_rows.emplace_back(std::move(row));
+    }
+}
+
 void WebRequestClient::handle(const network::PerformanceCounterResponse *response)
 {
     auto web_response = nlohmann::json{{"type", "performance"}};
@@ -250,4 +269,13 @@ void WebRequestClient::handle(const network::TimesResponse *response)
     web_response["count-rows"] = response->count_records().value_or(0ULL);
     web_response["ms"] = fmt::format("{0:.3f}", response->time().count() / 1000.0);
     this->_http_response.set_content(web_response.dump(), "text/json");
+}
+
+void WebRequestClient::handle(const network::TaskCyclesResponse *response)
+{
+    auto web_response = nlohmann::json{{"type", "task-cycles"}};
+    web_response["data"] = nlohmann::json::parse(response->data());
+    web_response["count-rows"] = response->count_records().value_or(0ULL);
+    web_response["ms"] = fmt::format("{0:.3f}", response->time().count() / 1000.0);
+    this->_http_response.set_content(web_response.dump(), "text/json");
 }
\ No newline at end of file
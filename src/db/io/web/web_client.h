@@ -4,6 +4,7 @@
 #include <db/network/client.h>
 #include <httplib.h>
 #include <mx/tasking/task.h>
+#include <nlohmann/json.hpp>
 #include <string>
 
 namespace db::io {
@@ -66,6 +67,7 @@ protected:
     void handle(const network::LogicalPlanResponse *response) override;
     void handle(const network::TaskGraphResponse *response) override;
     void handle(const network::QueryResultResponse *response) override;
+    void handle(const network::QueryResultChunkResponse *response) override;
     void handle(const network::PerformanceCounterResponse *response) override;
     void handle(const network::SampleAssemblyResponse *response) override;
     void handle(const network::TaskLoadResponse *response) override;
@@ -78,9 +80,13 @@ protected:
     void handle(const network::DRAMBandwidthResponse *response) override;
     void handle(const network::DataflowGraphResponse *response) override;
     void handle(const network::TimesResponse *response) override;
+    void handle(const network::TaskCyclesResponse *response) override;
 
 private:
     httplib::Response &_http_response;
+
+    /// Rows of a streamed result received before the last chunk; the web response is sent at once.
+    nlohmann::json _streamed_rows = nlohmann::json::array();
 };
 
 } // namespace db::io
\ No newline at end of file
@@ -54,6 +54,11 @@ std::string Client::send(const std::string &message)
         return "Error on sending message.";
     }
 
+    return this->receive();
+}
+
+std::string Client::receive()
+{
     // Read header
     auto header = std::uint64_t(0);
     this->read_into_buffer(sizeof(header), static_cast<void *>(&header));
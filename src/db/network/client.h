@@ -17,6 +17,14 @@ public:
     void disconnect() const;
     std::string send(const std::string &message);
 
+    /**
+     * Reads the next message of the server, e.g., when the server
+     * answers a request with multiple messages.
+     *
+     * @return The message.
+     */
+    std::string receive();
+
     [[nodiscard]] const std::string &server_address() const { return _server_address; }
 
     [[nodiscard]] std::uint16_t port() const { return _port; }
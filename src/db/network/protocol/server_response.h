@@ -30,7 +30,9 @@ public:
         SampleMemoryHistory, /// Memory Traces
         DRAMBandwidth,       /// Sampled DRAM bandwith (needs root)
         Times,               /// Times per node
-        ConnectionClosed
+        TaskCycles,          /// Accounted task cycles per node
+        ConnectionClosed,
+        QueryResultChunk     /// Records of a SELECT query sent while the query is running
     };
 
     constexpr ServerResponse(const Type type) noexcept : _type(type) {}
@@ -151,6 +153,7 @@ using FlounderCodeResponse = ResultStringResponse<ServerResponse::FlounderCode>;
 using AssemblyCodeResponse = ResultStringResponse<ServerResponse::AssemblyCode>;
 using DRAMBandwidthResponse = ResultStringResponse<ServerResponse::DRAMBandwidth>;
 using TimesResponse = ResultStringResponse<ServerResponse::Times>;
+using TaskCyclesResponse = ResultStringResponse<ServerResponse::TaskCycles>;
 using SampleMemoryResponse = ResultStringResponse<ServerResponse::SampleMemory>;
 using SampleMemoryHistoryResponse = ResultStringResponse<ServerResponse::SampleMemoryHistory>;
 
@@ -188,6 +191,36 @@ private:
     const std::uint64_t _count_rows;
 };
 
+class QueryResultChunkResponse final : public ServerResponse
+{
+public:
+    explicit QueryResultChunkResponse(const std::uint64_t count_rows)
+        : ServerResponse(Type::QueryResultChunk), _count_rows(count_rows)
+    {
+    }
+
+    constexpr ~QueryResultChunkResponse() override = default;
+
+    [[nodiscard]] std::uint64_t count_rows() const { return _count_rows; }
+
+    static std::string to_string(io::QueryResult &&result)
+    {
+        const auto serialized_size = result.serialized_size();
+        auto response = std::string(sizeof(QueryResultChunkResponse) + serialized_size, '\0');
+        std::ignore = new (response.data()) QueryResultChunkResponse(result.count_records());
+
+        result.serialize(serialized_size, reinterpret_cast<std::byte *>(
+                                              std::uintptr_t(response.data() + sizeof(QueryResultChunkResponse))));
+
+        return response;
+    }
+
+    [[nodiscard]] const std::byte *data() const { return reinterpret_cast<const std::byte *>(this + 1); }
+
+private:
+    const std::uint64_t _count_rows;
+};
+
 class TaskLoadResponse final : public ServerResponse
 {
 public:
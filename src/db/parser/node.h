@@ -7,6 +7,7 @@
 #include <db/expression/term.h>
 #include <db/plan/logical/table.h>
 #include <db/topology/physical_schema.h>
+#include <db/topology/placement.h>
 #include <memory>
 #include <optional>
 #include <string>
@@ -16,8 +17,10 @@ namespace db::parser {
 class CreateStatement final : public NodeInterface
 {
 public:
-    CreateStatement(std::string &&table_name, const bool if_not_exists, db::topology::PhysicalSchema &&schema) noexcept
-        : _table_name(std::move(table_name)), _if_not_exists(if_not_exists), _schema(std::move(schema))
+    CreateStatement(std::string &&table_name, const bool if_not_exists, db::topology::PhysicalSchema &&schema,
+                    const db::topology::Placement placement) noexcept
+        : _table_name(std::move(table_name)), _if_not_exists(if_not_exists), _schema(std::move(schema)),
+          _placement(placement)
     {
     }
     ~CreateStatement() noexcept override = default;
@@ -25,11 +28,13 @@ public:
     [[nodiscard]] std::string &table_name() noexcept { return _table_name; }
     [[nodiscard]] bool if_not_exists() const noexcept { return _if_not_exists; }
     [[nodiscard]] db::topology::PhysicalSchema &schema() { return _schema; }
+    [[nodiscard]] db::topology::Placement placement() const noexcept { return _placement; }
 
 private:
     std::string _table_name;
     bool _if_not_exists;
     db::topology::PhysicalSchema _schema;
+    db::topology::Placement _placement;
 };
 
 class InsertStatement final : public NodeInterface
@@ -66,7 +71,8 @@ public:
         Flounder,
         Assembly,
         DRAMBandwidth,
-        Times
+        Times,
+        TaskCycles
     };
 
     enum class SampleCounterType : std::uint8_t
@@ -164,6 +170,13 @@ public:
     ~ShowTablesCommand() noexcept override = default;
 };
 
+class ShowMemoryCommand final : public NodeInterface
+{
+public:
+    ShowMemoryCommand() noexcept = default;
+    ~ShowMemoryCommand() noexcept override = default;
+};
+
 class DescribeTableCommand final : public NodeInterface
 {
 public:
@@ -248,6 +261,37 @@ private:
     const std::uint16_t _count_cores;
 };
 
+class SetTaskCyclesCommand final : public NodeInterface
+{
+public:
+    constexpr SetTaskCyclesCommand(const bool is_enabled) noexcept : _is_enabled(is_enabled) {}
+
+    ~SetTaskCyclesCommand() noexcept override = default;
+
+    [[nodiscard]] bool is_enabled() const noexcept { return _is_enabled; }
+
+private:
+    const bool _is_enabled;
+};
+
+class SetTaskingCommand final : public NodeInterface
+{
+public:
+    SetTaskingCommand(std::string &&name, std::string &&value) noexcept
+        : _name(std::move(name)), _value(std::move(value))
+    {
+    }
+
+    ~SetTaskingCommand() noexcept override = default;
+
+    [[nodiscard]] std::string &name() noexcept { return _name; }
+    [[nodiscard]] std::string &value() noexcept { return _value; }
+
+private:
+    std::string _name;
+    std::string _value;
+};
+
 class GetConfigurationCommand final : public NodeInterface
 {
 public:
@@ -266,4 +310,21 @@ public:
 private:
     std::string _table_name;
 };
+
+class SetPlacementCommand final : public NodeInterface
+{
+public:
+    SetPlacementCommand(std::string &&table_name, const db::topology::Placement placement) noexcept
+        : _table_name(std::move(table_name)), _placement(placement)
+    {
+    }
+    ~SetPlacementCommand() noexcept override = default;
+
+    [[nodiscard]] std::string &table_name() noexcept { return _table_name; }
+    [[nodiscard]] db::topology::Placement placement() const noexcept { return _placement; }
+
+private:
+    std::string _table_name;
+    db::topology::Placement _placement;
+};
 } // namespace db::parser
\ No newline at end of file
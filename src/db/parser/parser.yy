@@ -54,11 +54,11 @@
 %token <type::Date> DATE
 %token <bool> BOOL
 %token CREATE_TK INSERT_TK INTO_TK VALUES_TK COPY_TK DELIMITER_TK
-%token TABLE_TK TABLES_TK
+%token TABLE_TK TABLES_TK MEMORY_TK
 %token INT_TK BIGINT_TK DATE_TK DECIMAL_TK CHAR_TK BOOL_TK TRUE_TK FALSE_TK
 %token IF_TK NOT_TK EXISTS_TK NULL_TK PRIMARY_KEY_TK
 %token EXPLAIN_TK EXPLAIN_TASK_GRAPH_TK EXPLAIN_DATA_FLOW_GRAPH_TK EXPLAIN_PERFORMANCE_TK EXPLAIN_TASK_LOAD_TK EXPLAIN_TASK_TRACES_TK
-%token EXPLAIN_FLOUNDER_TK EXPLAIN_ASSEMBLY_TK EXPLAIN_DRAM_BANDWIDTH_TK EXPLAIN_TIMES_TK
+%token EXPLAIN_FLOUNDER_TK EXPLAIN_ASSEMBLY_TK EXPLAIN_DRAM_BANDWIDTH_TK EXPLAIN_TIMES_TK EXPLAIN_TASK_CYCLES_TK
 %token SAMPLE_ASSEMBLY_TK SAMPLE_OPERATORS_TK SAMPLE_MEMORY_TK SAMPLE_HISTORICAL_MEMORY_TK WITH_FREQ_TK
 %token BRANCHES_TK BRANCH_MISSES_TK BACLEARS_ANY_TK CYCLES_TK INSTRUCTIONS_TK CACHE_MISSES_TK CACHE_REFERENCES_TK
 %token STALLS_MEM_ANY_TK STALLS_L3_MISS_TK STALLS_L2_MISS_TK STALLS_L1D_MISS_TK CYCLES_L3_MISS_TK DTLB_MISS_TK L3_MISS_REMOTE_TK
@@ -75,9 +75,9 @@
 %token LOAD_FILE_TK IMPORT_CSV_TK SEPARATED_BY_TK
 %token STORE_TK RESTORE_TK
 %token STOP_TK
-%token CONFIGURATION_TK SET_TK CORES_TK
+%token CONFIGURATION_TK SET_TK CORES_TK TASK_CYCLES_TK
 %token INTERVAL_TK YEAR_TK MONTH_TK DAY_TK
-%token UPDATE_STATISTICS_TK
+%token UPDATE_STATISTICS_TK PLACEMENT_TK
 
 %type <std::unique_ptr<NodeInterface>> query
 %type <std::unique_ptr<NodeInterface>> command
@@ -88,14 +88,20 @@
 %type <std::string> optional_copy_delimiter
 %type <std::unique_ptr<StopCommand>> stop_command
 %type <std::unique_ptr<ShowTablesCommand>> show_tables_command
+%type <std::unique_ptr<ShowMemoryCommand>> show_memory_command
 %type <std::unique_ptr<DescribeTableCommand>> describe_table_command
 %type <std::unique_ptr<LoadFileCommand>> load_file_command
 %type <std::unique_ptr<CopyStatement>> import_csv_command
 %type <std::unique_ptr<StoreCommand>> store_command
 %type <std::unique_ptr<RestoreCommand>> restore_command
 %type <std::unique_ptr<SetCoresCommand>> set_cores_command
+%type <std::unique_ptr<SetTaskCyclesCommand>> set_task_cycles_command
+%type <std::unique_ptr<SetTaskingCommand>> set_tasking_command
 %type <std::unique_ptr<GetConfigurationCommand>> get_configuration_command
 %type <std::unique_ptr<UpdateStatisticsCommand>> update_statistics_command
+%type <std::unique_ptr<SetPlacementCommand>> set_placement_command
+%type <topology::Placement> optional_placement
+%type <topology::Placement> placement
 %type <std::tuple<expression::Term, type::Type, bool, bool>> column_description
 %type <topology::PhysicalSchema> column_description_list
 %type <type::Type> type_description
@@ -165,8 +171,25 @@ statement:
 
 /** CREATE **/
 create_statement:
-    CREATE_TK TABLE_TK optional_if_not_exists REFERENCE LEFT_PARENTHESIS_TK column_description_list RIGHT_PARENTHESIS_TK {
-        $$ = std::make_unique<CreateStatement>(std::move($4), $3, std::move($6));
+    CREATE_TK TABLE_TK optional_if_not_exists REFERENCE LEFT_PARENTHESIS_TK column_description_list RIGHT_PARENTHESIS_TK optional_placement {
+        $$ = std::make_unique<CreateStatement>(std::move($4), $3, std::move($6), $8);
+    }
+
+optional_placement:
+    PLACEMENT_TK placement { $$ = $2; }
+    | { $$ = topology::Placement::Local; }
+
+placement:
+    REFERENCE
+    {
+        if (auto placement = topology::placement_from_string($1); placement.has_value())
+        {
+            $$ = placement.value();
+        }
+        else
+        {
+            error(@1, "Unknown placement '" + $1 + "', use local, interleaved, or replicated.");
+        }
     }
 
 column_description:
@@ -274,6 +297,7 @@ explain:
     | EXPLAIN_ASSEMBLY_TK { $$ = SelectQuery::ExplainLevel::Assembly; }
     | EXPLAIN_DRAM_BANDWIDTH_TK { $$ = SelectQuery::ExplainLevel::DRAMBandwidth; }
     | EXPLAIN_TIMES_TK { $$ = SelectQuery::ExplainLevel::Times; }
+    | EXPLAIN_TASK_CYCLES_TK { $$ = SelectQuery::ExplainLevel::TaskCycles; }
     | EXPLAIN_TK { $$ = SelectQuery::ExplainLevel::Plan; }
 
 sample:
@@ -461,6 +485,7 @@ else:
 command:
     stop_command { $$ = std::move($1); }
     | show_tables_command { $$ = std::move($1); }
+    | show_memory_command { $$ = std::move($1); }
     | describe_table_command { $$ = std::move($1); }
     | load_file_command { $$ = std::move($1); }
     | import_csv_command { $$ = std::move($1); }
@@ -468,12 +493,17 @@ command:
     | restore_command { $$ = std::move($1); }
     | get_configuration_command { $$ = std::move($1); }
     | set_cores_command { $$ = std::move($1); }
+    | set_task_cycles_command { $$ = std::move($1); }
+    | set_tasking_command { $$ = std::move($1); }
     | update_statistics_command { $$ = std::move($1); }
+    | set_placement_command { $$ = std::move($1); }
 
 stop_command: DOT_TK STOP_TK { $$ = std::make_unique<StopCommand>(); }
 
 show_tables_command: DOT_TK TABLES_TK { $$ = std::make_unique<ShowTablesCommand>(); }
 
+show_memory_command: DOT_TK MEMORY_TK { $$ = std::make_unique<ShowMemoryCommand>(); }
+
 describe_table_command:
     DOT_TK TABLE_TK REFERENCE { $$ = std::make_unique<DescribeTableCommand>(std::move($3)); }
 
@@ -497,12 +527,42 @@ set_cores_command:
         $$ = std::make_unique<SetCoresCommand>($4);
     }
 
+set_task_cycles_command:
+    DOT_TK SET_TK TASK_CYCLES_TK BOOL
+    {
+        $$ = std::make_unique<SetTaskCyclesCommand>($4);
+    }
+
+set_tasking_command:
+    DOT_TK SET_TK REFERENCE UNSIGNED_INTEGER
+    {
+        $$ = std::make_unique<SetTaskingCommand>(std::move($3), std::to_string($4));
+    }
+    | DOT_TK SET_TK REFERENCE BOOL
+    {
+        $$ = std::make_unique<SetTaskingCommand>(std::move($3), $4 ? "true" : "false");
+    }
+    | DOT_TK SET_TK REFERENCE REFERENCE
+    {
+        $$ = std::make_unique<SetTaskingCommand>(std::move($3), std::move($4));
+    }
+    | DOT_TK SET_TK REFERENCE STRING
+    {
+        $$ = std::make_unique<SetTaskingCommand>(std::move($3), std::move($4));
+    }
+
 update_statistics_command:
     DOT_TK UPDATE_STATISTICS_TK REFERENCE
     {
         $$ = std::make_unique<UpdateStatisticsCommand>(std::move($3));
     }
 
+set_placement_command:
+    DOT_TK PLACEMENT_TK REFERENCE placement
+    {
+        $$ = std::make_unique<SetPlacementCommand>(std::move($3), $4);
+    }
+
 optional_separated_by:
     SEPARATED_BY_TK STRING { $$ = $2; }
     | { $$ = ","; }
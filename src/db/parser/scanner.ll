@@ -30,6 +30,7 @@ COPY                                { return Parser::make_COPY_TK(loc); }
 DELIMITER                           { return Parser::make_DELIMITER_TK(loc); }
 TABLE                               { return Parser::make_TABLE_TK(loc); }
 TABLES                              { return Parser::make_TABLES_TK(loc); }
+MEMORY                              { return Parser::make_MEMORY_TK(loc); }
 IF                                  { return Parser::make_IF_TK(loc); }
 NOT                                 { return Parser::make_NOT_TK(loc); }
 EXISTS                              { return Parser::make_EXISTS_TK(loc); }
@@ -54,6 +55,7 @@ EXPLAIN                             { return Parser::make_EXPLAIN_TK(loc); }
 "EXPLAIN ASM"                       { return Parser::make_EXPLAIN_ASSEMBLY_TK(loc); }
 "EXPLAIN DRAM BANDWIDTH"            { return Parser::make_EXPLAIN_DRAM_BANDWIDTH_TK(loc); }
 "EXPLAIN TIMES"                     { return Parser::make_EXPLAIN_TIMES_TK(loc); }
+"EXPLAIN TASK CYCLES"               { return Parser::make_EXPLAIN_TASK_CYCLES_TK(loc); }
 "SAMPLE ASSEMBLY"                   { return Parser::make_SAMPLE_ASSEMBLY_TK(loc); }
 "SAMPLE OPERATORS"                  { return Parser::make_SAMPLE_OPERATORS_TK(loc); }
 "SAMPLE MEMORY"                     { return Parser::make_SAMPLE_MEMORY_TK(loc); }
@@ -106,7 +108,9 @@ STOP                                { return Parser::make_STOP_TK(loc); }
 SET                                 { return Parser::make_SET_TK(loc); }
 CONFIGURATION|CONFIG                { return Parser::make_CONFIGURATION_TK(loc); }
 CORES                               { return Parser::make_CORES_TK(loc); }
+"TASK CYCLES"                       { return Parser::make_TASK_CYCLES_TK(loc); }
 "UPDATE STATISTICS"                 { return Parser::make_UPDATE_STATISTICS_TK(loc); }
+PLACEMENT                           { return Parser::make_PLACEMENT_TK(loc); }
 \(						            { return Parser::make_LEFT_PARENTHESIS_TK(loc); }
 \)						            { return Parser::make_RIGHT_PARENTHESIS_TK(loc); }
 \,                                  { return Parser::make_COMMA_TK(loc); }
@@ -2,6 +2,7 @@
 
 #include "node_interface.h"
 #include <db/exception/plan_exception.h>
+#include <db/topology/placement.h>
 #include <string>
 
 namespace db::plan::logical {
@@ -23,6 +24,15 @@ public:
     [[nodiscard]] QueryType query_type() const noexcept override { return NodeInterface::QueryType::COMMAND; }
 };
 
+class ShowMemoryNode final : public NotSchematizedNode
+{
+public:
+    ShowMemoryNode() : NotSchematizedNode("Show Memory") {}
+    ~ShowMemoryNode() override = default;
+
+    [[nodiscard]] QueryType query_type() const noexcept override { return NodeInterface::QueryType::COMMAND; }
+};
+
 class DescribeTableNode final : public NotSchematizedNode
 {
 public:
@@ -115,6 +125,37 @@ private:
     const std::uint16_t _count_cores;
 };
 
+class SetTaskCyclesNode final : public NotSchematizedNode
+{
+public:
+    SetTaskCyclesNode(const bool is_enabled) : NotSchematizedNode("Set Task Cycles"), _is_enabled(is_enabled) {}
+    ~SetTaskCyclesNode() override = default;
+
+    [[nodiscard]] QueryType query_type() const noexcept override { return NodeInterface::QueryType::CONFIGURATION; }
+    [[nodiscard]] bool is_enabled() const noexcept { return _is_enabled; }
+
+private:
+    const bool _is_enabled;
+};
+
+class SetTaskingNode final : public NotSchematizedNode
+{
+public:
+    SetTaskingNode(std::string &&name, std::string &&value)
+        : NotSchematizedNode("Set Tasking"), _name(std::move(name)), _value(std::move(value))
+    {
+    }
+    ~SetTaskingNode() override = default;
+
+    [[nodiscard]] QueryType query_type() const noexcept override { return NodeInterface::QueryType::CONFIGURATION; }
+    [[nodiscard]] const std::string &name() const noexcept { return _name; }
+    [[nodiscard]] const std::string &value() const noexcept { return _value; }
+
+private:
+    const std::string _name;
+    const std::string _value;
+};
+
 class UpdateStatisticsNode final : public NotSchematizedNode
 {
 public:
@@ -141,4 +182,32 @@ private:
     std::string _table_name;
 };
 
+class SetPlacementNode final : public NotSchematizedNode
+{
+public:
+    SetPlacementNode(std::string &&table_name, const topology::Placement placement)
+        : NotSchematizedNode("Set Placement"), _table_name(std::move(table_name)), _placement(placement)
+    {
+    }
+    ~SetPlacementNode() override = default;
+
+    [[nodiscard]] QueryType query_type() const noexcept override { return NodeInterface::QueryType::COMMAND; }
+    [[nodiscard]] std::string &table_name() noexcept { return _table_name; }
+    [[nodiscard]] topology::Placement placement() const noexcept { return _placement; }
+
+    [[nodiscard]] topology::LogicalSchema schema(const topology::Database &database) const override
+    {
+        if (database.is_table(_table_name) == false)
+        {
+            throw exception::TableNotFoundException{_table_name};
+        }
+
+        return NotSchematizedNode::schema(database);
+    }
+
+private:
+    std::string _table_name;
+    const topology::Placement _placement;
+};
+
 } // namespace db::plan::logical
\ No newline at end of file
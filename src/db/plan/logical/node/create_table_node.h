@@ -4,14 +4,16 @@
 #include <db/exception/plan_exception.h>
 #include <db/topology/database.h>
 #include <db/topology/physical_schema.h>
+#include <db/topology/placement.h>
 
 namespace db::plan::logical {
 class CreateTableNode final : public NotSchematizedNode
 {
 public:
-    CreateTableNode(std::string &&table_name, topology::PhysicalSchema &&physical_schema, const bool if_not_exists)
+    CreateTableNode(std::string &&table_name, topology::PhysicalSchema &&physical_schema, const bool if_not_exists,
+                    const topology::Placement placement)
         : NotSchematizedNode("Create Table"), _table_name(std::move(table_name)),
-          _physical_schema(std::move(physical_schema)), _if_not_exists(if_not_exists)
+          _physical_schema(std::move(physical_schema)), _if_not_exists(if_not_exists), _placement(placement)
     {
     }
     ~CreateTableNode() override = default;
@@ -22,6 +24,8 @@ public:
 
     [[nodiscard]] topology::PhysicalSchema &physical_schema() noexcept { return _physical_schema; }
 
+    [[nodiscard]] topology::Placement placement() const noexcept { return _placement; }
+
     [[nodiscard]] topology::LogicalSchema schema(const topology::Database &database) const override
     {
         if (database.is_table(_table_name) && _if_not_exists == false)
@@ -36,5 +40,6 @@ private:
     std::string _table_name;
     topology::PhysicalSchema _physical_schema;
     const bool _if_not_exists;
+    const topology::Placement _placement;
 };
 } // namespace db::plan::logical
\ No newline at end of file
@@ -17,6 +17,7 @@ public:
         Assembly,
         DRAMBandwidth,
         Times,
+        TaskCycles,
     };
 
     explicit ExplainNode(const Level level) : UnaryNode("Explain"), _level(level) {}
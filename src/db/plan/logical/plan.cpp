@@ -74,7 +74,7 @@ std::unique_ptr<NodeInterface> Plan::build_node(std::unique_ptr<parser::NodeInte
         auto *create_statement = reinterpret_cast<parser::CreateStatement *>(node);
         return std::make_unique<CreateTableNode>(std::move(create_statement->table_name()),
                                                  std::move(create_statement->schema()),
-                                                 create_statement->if_not_exists());
+                                                 create_statement->if_not_exists(), create_statement->placement());
     }
 
     if (typeid(*node) == typeid(parser::InsertStatement))
@@ -107,6 +107,11 @@ std::unique_ptr<NodeInterface> Plan::build_node(std::unique_ptr<parser::NodeInte
         return std::make_unique<ShowTablesNode>();
     }
 
+    if (typeid(*node) == typeid(parser::ShowMemoryCommand))
+    {
+        return std::make_unique<ShowMemoryNode>();
+    }
+
     if (typeid(*node) == typeid(parser::DescribeTableCommand))
     {
         auto *describe_table_command = reinterpret_cast<parser::DescribeTableCommand *>(node);
@@ -142,12 +147,32 @@ std::unique_ptr<NodeInterface> Plan::build_node(std::unique_ptr<parser::NodeInte
         return std::make_unique<SetCoresNode>(set_cores_command->count_cores());
     }
 
+    if (typeid(*node) == typeid(parser::SetTaskCyclesCommand))
+    {
+        auto *set_task_cycles_command = reinterpret_cast<parser::SetTaskCyclesCommand *>(node);
+        return std::make_unique<SetTaskCyclesNode>(set_task_cycles_command->is_enabled());
+    }
+
+    if (typeid(*node) == typeid(parser::SetTaskingCommand))
+    {
+        auto *set_tasking_command = reinterpret_cast<parser::SetTaskingCommand *>(node);
+        return std::make_unique<SetTaskingNode>(std::move(set_tasking_command->name()),
+                                                std::move(set_tasking_command->value()));
+    }
+
     if (typeid(*node) == typeid(parser::UpdateStatisticsCommand))
     {
         auto *update_statistics_command = reinterpret_cast<parser::UpdateStatisticsCommand *>(node);
         return std::make_unique<UpdateStatisticsNode>(std::move(update_statistics_command->table_name()));
     }
 
+    if (typeid(*node) == typeid(parser::SetPlacementCommand))
+    {
+        auto *set_placement_command = reinterpret_cast<parser::SetPlacementCommand *>(node);
+        return std::make_unique<SetPlacementNode>(std::move(set_placement_command->table_name()),
+                                                  set_placement_command->placement());
+    }
+
     throw exception::PlanningException{"Logical Builder can not build plan / unknown node in AST."};
 }
 
@@ -535,6 +560,8 @@ ExplainNode::Level Plan::extract_explain_level(const parser::SelectQuery::Explai
         return ExplainNode::Level::DRAMBandwidth;
     case parser::SelectQuery::ExplainLevel::Times:
         return ExplainNode::Level::Times;
+    case parser::SelectQuery::ExplainLevel::TaskCycles:
+        return ExplainNode::Level::TaskCycles;
     }
 }
 
@@ -70,6 +70,10 @@ public:
     {
         return Plan::is_explain<ExplainNode::Level::Times>(_root_node);
     }
+    [[nodiscard]] bool is_explain_task_cycles() const noexcept
+    {
+        return Plan::is_explain<ExplainNode::Level::TaskCycles>(_root_node);
+    }
 
     [[nodiscard]] bool is_sample() const noexcept { return sample_type().has_value(); }
 
@@ -18,28 +18,32 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> JoinPlanner::buil
     std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
     topology::LogicalSchema &&logical_probe_schema,
     std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-    const std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks)
+    const std::uint64_t expected_build_cardinality,
+    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena)
 {
     if (logical_join_node->method() == logical::JoinNode::RadixJoin ||
         logical_join_node->method() == logical::JoinNode::FilteredRadixJoin)
     {
         return JoinPlanner::build_radix_join(database, logical_join_node, std::move(logical_build_schema),
                                              std::move(build_child), std::move(logical_probe_schema),
-                                             std::move(probe_child), expected_build_cardinality, preparatory_tasks);
+                                             std::move(probe_child), expected_build_cardinality, preparatory_tasks,
+                                             slab_arena);
     }
 
     if (logical_join_node->method() == logical::JoinNode::HashJoin)
     {
         return JoinPlanner::build_hash_join(database, logical_join_node, std::move(logical_build_schema),
                                             std::move(build_child), std::move(logical_probe_schema),
-                                            std::move(probe_child), expected_build_cardinality, preparatory_tasks);
+                                            std::move(probe_child), expected_build_cardinality, preparatory_tasks,
+                                            slab_arena);
     }
 
     if (logical_join_node->method() == logical::JoinNode::NestedLoopsJoin)
     {
         return JoinPlanner::build_nested_loops_join(
             database, logical_join_node, std::move(logical_build_schema), std::move(build_child),
-            std::move(logical_probe_schema), std::move(probe_child), expected_build_cardinality, preparatory_tasks);
+            std::move(logical_probe_schema), std::move(probe_child), expected_build_cardinality, preparatory_tasks,
+            slab_arena);
     }
 
     return nullptr;
@@ -51,7 +55,8 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> JoinPlanner::buil
     std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
     topology::LogicalSchema &&logical_probe_schema,
     std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-    const std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks)
+    const std::uint64_t expected_build_cardinality,
+    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena)
 {
     const auto count_worker = mx::tasking::runtime::workers();
     const auto is_filter = logical_join_node->method() == logical::JoinNode::Method::FilteredRadixJoin;
@@ -98,8 +103,8 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> JoinPlanner::buil
     auto hash_table_descriptor = execution::compilation::hashtable::Descriptor{
         JoinPlanner::HASH_TABLE_TYPE,  capacity_per_table,     build_key_schema.row_size(),
         build_entry_schema.row_size(), is_key_unique == false, entries_per_hashtable_slot};
-    auto hash_tables =
-        JoinPlanner::create_hash_tables(count_partitions, count_worker, hash_table_descriptor, preparatory_tasks);
+    auto hash_tables = JoinPlanner::create_hash_tables(count_partitions, count_worker, hash_table_descriptor,
+                                                       preparatory_tasks, slab_arena);
 
     /** Build Side **/
     /// Build the left side partitioning (left -> |partition -> build|).
@@ -276,7 +281,8 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> JoinPlanner::buil
     std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
     topology::LogicalSchema && /*logical_probe_schema*/,
     std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-    const std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks)
+    const std::uint64_t expected_build_cardinality,
+    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena)
 {
     const auto hash_table_buckets = execution::compilation::hashtable::TableProxy::allocation_capacity(
         expected_build_cardinality, JoinPlanner::HASH_TABLE_TYPE);
@@ -307,18 +313,7 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> JoinPlanner::buil
     const auto hash_table_size = execution::compilation::hashtable::TableProxy::size(hash_table_descriptor);
     const auto local_worker_id = mx::tasking::runtime::worker_id();
 
-    auto hash_table = mx::resource::ptr{};
-
-    if (hash_table_descriptor.table_type() == execution::compilation::hashtable::Descriptor::LinearProbing)
-    {
-        hash_table = mx::tasking::runtime::new_squad<execution::compilation::hashtable::LinearProbingTable>(
-            hash_table_size, 0U, hash_table_descriptor);
-    }
-    else if (hash_table_descriptor.table_type() == execution::compilation::hashtable::Descriptor::Chained)
-    {
-        hash_table = mx::tasking::runtime::new_squad<execution::compilation::hashtable::ChainedTable>(
-            hash_table_size, 0U, hash_table_descriptor);
-    }
+    auto hash_table = JoinPlanner::create_hash_table(hash_table_size, 0U, hash_table_descriptor, slab_arena);
 
     auto *zero_out_task = mx::tasking::runtime::new_task<execution::compilation::hashtable::InitializeTableTask>(
         local_worker_id, hash_table.get<execution::compilation::hashtable::AbstractTable>());
@@ -347,7 +342,8 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> JoinPlanner::buil
     std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
     topology::LogicalSchema && /*logical_probe_schema*/,
     std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-    const std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> & /*preparatory_tasks*/)
+    const std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> & /*preparatory_tasks*/,
+    mx::memory::slab::Arena * /*slab_arena*/)
 {
     auto build_schema = topology::PhysicalSchema::from_logical(logical_build_schema);
     auto *buffer = execution::compilation::RowRecordBuffer::make(
@@ -558,7 +554,7 @@ std::uint64_t JoinPlanner::calculate_bloom_filter_blocks_per_partition(const std
 std::vector<mx::resource::ptr> JoinPlanner::create_hash_tables(
     const std::uint32_t count_partitions, const std::uint16_t count_worker,
     const execution::compilation::hashtable::Descriptor &hash_table_descriptor,
-    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks)
+    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena)
 {
     const auto hash_table_size = execution::compilation::hashtable::TableProxy::size(hash_table_descriptor);
 
@@ -571,18 +567,8 @@ std::vector<mx::resource::ptr> JoinPlanner::create_hash_tables(
     {
         const auto mapped_worker_id = hash_table_id % count_worker;
 
-        auto hash_table = mx::resource::ptr{};
-
-        if (hash_table_descriptor.table_type() == execution::compilation::hashtable::Descriptor::Type::LinearProbing)
-        {
-            hash_table = mx::tasking::runtime::new_squad<execution::compilation::hashtable::LinearProbingTable>(
-                hash_table_size, mapped_worker_id, hash_table_descriptor);
-        }
-        else if (hash_table_descriptor.table_type() == execution::compilation::hashtable::Descriptor::Chained)
-        {
-            hash_table = mx::tasking::runtime::new_squad<execution::compilation::hashtable::ChainedTable>(
-                hash_table_size, mapped_worker_id, hash_table_descriptor);
-        }
+        auto hash_table =
+            JoinPlanner::create_hash_table(hash_table_size, mapped_worker_id, hash_table_descriptor, slab_arena);
         hash_tables.emplace_back(hash_table);
 
         auto *zero_out_task = mx::tasking::runtime::new_task<execution::compilation::hashtable::InitializeTableTask>(
@@ -594,6 +580,49 @@ std::vector<mx::resource::ptr> JoinPlanner::create_hash_tables(
     return hash_tables;
 }
 
+mx::resource::ptr JoinPlanner::create_hash_table(
+    const std::size_t hash_table_size, const std::uint16_t mapped_worker_id,
+    const execution::compilation::hashtable::Descriptor &hash_table_descriptor, mx::memory::slab::Arena *slab_arena)
+{
+    using namespace execution::compilation::hashtable;
+
+    /// Allocate the hash table from the arena of the query, on the NUMA node of the mapped worker.
+    if (slab_arena != nullptr)
+    {
+        auto *hash_table_data = slab_arena->allocate_block(
+            mx::tasking::runtime::worker_id(), mx::tasking::runtime::numa_node_id(mapped_worker_id), hash_table_size);
+        if (hash_table_data != nullptr)
+        {
+            auto annotation =
+                mx::resource::annotation{mapped_worker_id, mx::synchronization::isolation_level::Exclusive,
+                                         mx::synchronization::protocol::Batched};
+            if (hash_table_descriptor.table_type() == Descriptor::LinearProbing)
+            {
+                return mx::tasking::runtime::to_resource<LinearProbingTable>(
+                    new (hash_table_data) LinearProbingTable(hash_table_descriptor, slab_arena), std::move(annotation));
+            }
+
+            return mx::tasking::runtime::to_resource<ChainedTable>(
+                new (hash_table_data) ChainedTable(hash_table_descriptor, slab_arena), std::move(annotation));
+        }
+    }
+
+    auto hash_table =
+        hash_table_descriptor.table_type() == Descriptor::LinearProbing
+            ? mx::tasking::runtime::new_squad<LinearProbingTable>(hash_table_size, mapped_worker_id,
+                                                                  hash_table_descriptor)
+            : mx::tasking::runtime::new_squad<ChainedTable>(hash_table_size, mapped_worker_id, hash_table_descriptor);
+
+    /// Hash tables allocated from the resource allocator count for the query, too; released when the table is freed.
+    if (slab_arena != nullptr)
+    {
+        slab_arena->budget().charge(hash_table_size);
+        hash_table.get<AbstractTable>()->charged_budget(&slab_arena->budget());
+    }
+
+    return hash_table;
+}
+
 std::vector<mx::resource::ptr> JoinPlanner::create_partitions(const std::vector<std::uint8_t> &radix_bits,
                                                               const std::uint8_t pass, const std::uint16_t count_worker)
 {
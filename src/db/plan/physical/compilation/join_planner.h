@@ -5,6 +5,7 @@
 #include <db/plan/logical/node/join_node.h>
 #include <db/topology/database.h>
 #include <memory>
+#include <mx/memory/slab_allocator.h>
 #include <mx/tasking/task.h>
 #include <vector>
 
@@ -18,7 +19,8 @@ public:
         std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
         topology::LogicalSchema &&logical_probe_schema,
         std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks);
+        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks,
+        mx::memory::slab::Arena *slab_arena);
 
     /**
      * Builds a set of hash tables according to the given radix partition bits.
@@ -28,13 +30,14 @@ public:
      * @param count_worker Number of worker.
      * @param hash_table_descriptor Descriptor of the hash table.
      * @param preparatory_tasks List to add zero-out tasks.
+     * @param slab_arena Arena of the query to allocate the hash tables from, may be nullptr.
      *
      * @return List of hash tables.
      */
     [[nodiscard]] static std::vector<mx::resource::ptr> create_hash_tables(
         std::uint32_t count_partitions, std::uint16_t count_worker,
         const execution::compilation::hashtable::Descriptor &hash_table_descriptor,
-        std::vector<mx::tasking::TaskInterface *> &preparatory_tasks);
+        std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena);
 
 private:
     constexpr auto inline static HASH_TABLE_TYPE = execution::compilation::hashtable::Descriptor::Type::Chained;
@@ -47,21 +50,39 @@ private:
         std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
         topology::LogicalSchema &&logical_probe_schema,
         std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks);
+        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks,
+        mx::memory::slab::Arena *slab_arena);
     [[nodiscard]] static std::unique_ptr<execution::compilation::OperatorInterface> build_hash_join(
         const topology::Database &database, logical::JoinNode *logical_join_node,
         topology::LogicalSchema &&logical_build_schema,
         std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
         topology::LogicalSchema &&logical_probe_schema,
         std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks);
+        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks,
+        mx::memory::slab::Arena *slab_arena);
     [[nodiscard]] static std::unique_ptr<execution::compilation::OperatorInterface> build_nested_loops_join(
         const topology::Database &database, logical::JoinNode *logical_join_node,
         topology::LogicalSchema &&logical_build_schema,
         std::unique_ptr<execution::compilation::OperatorInterface> &&build_child,
         topology::LogicalSchema &&logical_probe_schema,
         std::unique_ptr<execution::compilation::OperatorInterface> &&probe_child,
-        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks);
+        std::uint64_t expected_build_cardinality, std::vector<mx::tasking::TaskInterface *> &preparatory_tasks,
+        mx::memory::slab::Arena *slab_arena);
+
+    /**
+     * Creates a hash table mapped to the given worker. The hash table is allocated
+     * from the arena of the query or, without arena, from the resource allocator.
+     *
+     * @param hash_table_size Size of the hash table in bytes.
+     * @param mapped_worker_id Worker the hash table is mapped to.
+     * @param hash_table_descriptor Descriptor of the hash table.
+     * @param slab_arena Arena of the query, may be nullptr.
+     * @return The hash table.
+     */
+    [[nodiscard]] static mx::resource::ptr create_hash_table(
+        std::size_t hash_table_size, std::uint16_t mapped_worker_id,
+        const execution::compilation::hashtable::Descriptor &hash_table_descriptor,
+        mx::memory::slab::Arena *slab_arena);
 
     /**
      * Extract the join predicate terms (build or probe side) fromt the given predicate.
@@ -13,14 +13,14 @@ CompilationGraph *CompilationGraph::build(
     CompilationPlan &&compilation_plan, const std::uint32_t client_id, const bool is_record_performance,
     const bool is_record_task_load, const bool is_record_task_traces, bool is_explain_flounder,
     const bool is_explain_assembly, const bool is_explain_dram_bandwidth, const bool is_explain_task_graph,
-    const bool is_explain_data_flow_graph, const bool is_explain_times,
+    const bool is_explain_data_flow_graph, const bool is_explain_times, const bool is_explain_task_cycles,
     const std::optional<
         std::tuple<logical::SampleNode::Level, logical::SampleNode::CounterType, std::optional<std::uint64_t>>>
         sample_type,
     const perf::Counter &profiling_counter)
 {
-    auto *graph =
-        new CompilationGraph{sample_type.has_value(), is_explain_assembly || sample_type.has_value(), is_explain_times};
+    auto *graph = new CompilationGraph{sample_type.has_value(), is_explain_assembly || sample_type.has_value(),
+                                       is_explain_times, compilation_plan.slab_arena()};
     graph->add(std::move(compilation_plan.preparatory_tasks()));
 
     /// Build operators/nodes according to the logical plan.
@@ -145,10 +145,19 @@ CompilationGraph *CompilationGraph::build(
         return graph;
     }
 
+    /// The user requested the cycles spent per node.
+    if (is_explain_task_cycles) [[unlikely]]
+    {
+        auto *gather_task_cycles_node = new execution::GatherTaskCyclesNode{client_id, std::move(chronometer)};
+        graph->make_edge(dynamic_cast<mx::tasking::dataflow::NodeInterface<execution::RecordSet> *>(last_operator_node),
+                         gather_task_cycles_node);
+        return graph;
+    }
+
     /// (Normal) user requests will be answered by the gather result node,
     /// which collects the results and send them to the user.
-    auto *gather_results_node =
-        new execution::GatherQueryResultNode{client_id, std::move(chronometer), last_operator_node->schema()};
+    auto *gather_results_node = new execution::GatherQueryResultNode{client_id, std::move(chronometer),
+                                                                     last_operator_node->schema(), graph->slab_arena()};
     graph->make_edge(dynamic_cast<mx::tasking::dataflow::NodeInterface<execution::RecordSet> *>(last_operator_node),
                      gather_results_node);
     return graph;
@@ -278,8 +287,8 @@ db::execution::compilation::CompilationNode *CompilationGraph::build(
 
         compilation_node = producing_node;
 
-        if constexpr (mx::tasking::config::is_collect_task_traces() ||
-                      mx::tasking::config::is_monitor_task_cycles_for_prefetching())
+        if (mx::tasking::runtime::configuration().is_collect_task_traces() ||
+            mx::tasking::config::is_monitor_task_cycles_for_prefetching())
         {
             mx::tasking::runtime::register_task_for_trace(producing_node->trace_id(), producing_node->name());
         }
@@ -310,8 +319,8 @@ db::execution::compilation::CompilationNode *CompilationGraph::build(
 
         compilation_node = consuming_node;
 
-        if constexpr (mx::tasking::config::is_collect_task_traces() ||
-                      mx::tasking::config::is_monitor_task_cycles_for_prefetching())
+        if (mx::tasking::runtime::configuration().is_collect_task_traces() ||
+            mx::tasking::config::is_monitor_task_cycles_for_prefetching())
         {
             mx::tasking::runtime::register_task_for_trace(consuming_node->trace_id(), std::move(node_name));
         }
@@ -363,6 +372,21 @@ db::execution::compilation::CompilationNode *CompilationGraph::build(
     return compilation_node;
 }
 
+void CompilationGraph::use_morsel_driven_scans(const bool is_morsel_driven)
+{
+    this->for_each_node([is_morsel_driven](auto *node) {
+        if (typeid(*node) == typeid(execution::compilation::ProducingNode))
+        {
+            auto &token_generator = node->annotation().token_generator();
+            if (auto *scan_generator = dynamic_cast<execution::ScanGenerator *>(token_generator.get());
+                scan_generator != nullptr)
+            {
+                scan_generator->is_morsel_driven(is_morsel_driven);
+            }
+        }
+    });
+}
+
 void CompilationGraph::compile(const bool make_visible_to_perf, const bool make_visible_to_vtune)
 {
     auto perf_jit_map = flounder::PerfJitMap{};
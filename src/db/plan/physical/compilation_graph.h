@@ -19,8 +19,9 @@ namespace db::plan::physical {
 class CompilationGraph final : public DataFlowGraph
 {
 public:
-    CompilationGraph(const bool is_profile, const bool is_keep_compiled_code, const bool is_explain_times)
-        : DataFlowGraph(is_explain_times), _compiler(is_profile, is_keep_compiled_code)
+    CompilationGraph(const bool is_profile, const bool is_keep_compiled_code, const bool is_explain_times,
+                     std::shared_ptr<mx::memory::slab::Arena> slab_arena)
+        : DataFlowGraph(is_explain_times, std::move(slab_arena)), _compiler(is_profile, is_keep_compiled_code)
     {
     }
 
@@ -31,7 +32,7 @@ public:
         CompilationPlan &&compilation_plan, std::uint32_t client_id, bool is_record_performance,
         bool is_record_task_load, bool is_record_task_traces, bool is_explain_flounder, bool is_explain_assembly,
         bool is_explain_dram_bandwidth, bool is_explain_task_graph, bool is_explain_data_flow_graph,
-        bool is_explain_times,
+        bool is_explain_times, bool is_explain_task_cycles,
         std::optional<
             std::tuple<logical::SampleNode::Level, logical::SampleNode::CounterType, std::optional<std::uint64_t>>>
             sample_type,
@@ -39,6 +40,14 @@ public:
 
     void compile(bool make_visible_to_perf, bool make_visible_to_vtune);
 
+    /**
+     * Lets all table scans of the graph pull morsels of tiles (or scan the tiles
+     * mapped to every worker). Has to be called before the graph is started.
+     *
+     * @param is_morsel_driven True, if the scans should pull morsels.
+     */
+    void use_morsel_driven_scans(bool is_morsel_driven);
+
     [[nodiscard]] nlohmann::json to_flounder() const { return CompilationGraph::to_code(false, std::nullopt); }
     [[nodiscard]] nlohmann::json to_assembly() const { return CompilationGraph::to_code(true, std::nullopt); }
     [[nodiscard]] nlohmann::json to_assembly(const perf::AggregatedSamples &samples) const
@@ -29,48 +29,74 @@
 #include <db/plan/logical/node/table_selection_node.h>
 #include <db/plan/logical/node/user_defined_node.h>
 #include <db/plan/physical/compilation/join_planner.h>
+#include <fmt/core.h>
 
 using namespace db::plan::physical;
 
-CompilationPlan CompilationPlan::build(const topology::Database &database, logical::Plan &&logical_plan)
+CompilationPlan CompilationPlan::build(const topology::Database &database, logical::Plan &&logical_plan,
+                                       const std::uint64_t memory_limit)
 {
     auto preparatory_tasks = std::vector<mx::tasking::TaskInterface *>{};
     preparatory_tasks.reserve(1024U);
 
-    auto root_operator =
-        CompilationPlan::build_operator(database, std::move(logical_plan.root_node()), preparatory_tasks);
+    /// Memory of the query (e.g., hash tables), released at once when the query finished.
+    auto slab_arena = std::shared_ptr<mx::memory::slab::Arena>{nullptr};
+    if constexpr (mx::tasking::config::is_use_dataflow_slab_arena())
+    {
+        slab_arena = mx::tasking::runtime::new_slab_arena(memory_limit);
+    }
+
+    auto root_operator = CompilationPlan::build_operator(database, std::move(logical_plan.root_node()),
+                                                         preparatory_tasks, slab_arena.get());
+
+    /// Even the most frugal operators (e.g., their hash tables) exceed the limit.
+    if (slab_arena != nullptr && slab_arena->budget().is_exceeded()) [[unlikely]]
+    {
+        for (auto *task : preparatory_tasks)
+        {
+            mx::tasking::runtime::delete_task(mx::tasking::runtime::worker_id(), task);
+        }
+
+        throw exception::ExecutionException{
+            fmt::format("The query needs {} bytes of memory, exceeding the memory limit of {} bytes.",
+                        slab_arena->budget().peak(), memory_limit)};
+    }
 
-    return CompilationPlan{std::move(root_operator), std::move(preparatory_tasks)};
+    return CompilationPlan{std::move(root_operator), std::move(preparatory_tasks), std::move(slab_arena)};
 }
 
 std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::build_operator(
     const topology::Database &database, std::unique_ptr<logical::NodeInterface> &&logical_node,
-    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks)
+    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena)
 {
     auto *node = logical_node.get();
 
     if (typeid(*node) == typeid(logical::ExplainNode))
     {
         return CompilationPlan::build_operator(
-            database, std::move(reinterpret_cast<logical::ExplainNode *>(node)->child()), preparatory_tasks);
+            database, std::move(reinterpret_cast<logical::ExplainNode *>(node)->child()), preparatory_tasks,
+            slab_arena);
     }
 
     if (typeid(*node) == typeid(logical::SampleNode))
     {
         return CompilationPlan::build_operator(
-            database, std::move(reinterpret_cast<logical::SampleNode *>(node)->child()), preparatory_tasks);
+            database, std::move(reinterpret_cast<logical::SampleNode *>(node)->child()), preparatory_tasks,
+            slab_arena);
     }
 
     if (typeid(*node) == typeid(logical::ProjectionNode))
     {
         return CompilationPlan::build_operator(
-            database, std::move(reinterpret_cast<logical::ProjectionNode *>(node)->child()), preparatory_tasks);
+            database, std::move(reinterpret_cast<logical::ProjectionNode *>(node)->child()), preparatory_tasks,
+            slab_arena);
     }
 
     if (typeid(*node) == typeid(logical::MaterializeNode))
     {
         auto child = CompilationPlan::build_operator(
-            database, std::move(reinterpret_cast<logical::MaterializeNode *>(node)->child()), preparatory_tasks);
+            database, std::move(reinterpret_cast<logical::MaterializeNode *>(node)->child()), preparatory_tasks,
+            slab_arena);
         auto materialize_operator = std::make_unique<execution::compilation::MaterializeOperator>(
             topology::PhysicalSchema::from_logical(node->relation().schema()));
         materialize_operator->child(std::move(child));
@@ -104,20 +130,37 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
         auto left_child_schema = join_node->left_child()->relation().schema();
         auto right_child_schema = join_node->right_child()->relation().schema();
 
-        auto build_child =
-            CompilationPlan::build_operator(database, std::move(join_node->left_child()), preparatory_tasks);
-        auto probe_child =
-            CompilationPlan::build_operator(database, std::move(join_node->right_child()), preparatory_tasks);
+        /// Radix joins materialize both sides into partitions, the hash join materializes the
+        /// build side only (into the hash table); the hash join is the frugal one.
+        if (join_node->method() == logical::JoinNode::Method::RadixJoin ||
+            join_node->method() == logical::JoinNode::Method::FilteredRadixJoin)
+        {
+            const auto partitions_size =
+                expected_build_cardinality * topology::PhysicalSchema::from_logical(left_child_schema).row_size() +
+                join_node->right_child()->relation().cardinality() *
+                    topology::PhysicalSchema::from_logical(right_child_schema).row_size();
+            if (CompilationPlan::is_fitting(slab_arena, partitions_size) == false)
+            {
+                join_node->method(logical::JoinNode::Method::HashJoin);
+            }
+        }
+
+        auto build_child = CompilationPlan::build_operator(database, std::move(join_node->left_child()),
+                                                           preparatory_tasks, slab_arena);
+        auto probe_child = CompilationPlan::build_operator(database, std::move(join_node->right_child()),
+                                                           preparatory_tasks, slab_arena);
 
         return compilation::JoinPlanner::build(database, join_node, std::move(left_child_schema),
                                                std::move(build_child), std::move(right_child_schema),
-                                               std::move(probe_child), expected_build_cardinality, preparatory_tasks);
+                                               std::move(probe_child), expected_build_cardinality, preparatory_tasks,
+                                               slab_arena);
     }
 
     if (typeid(*node) == typeid(logical::SelectionNode))
     {
         auto *selection_node = reinterpret_cast<logical::SelectionNode *>(node);
-        auto child = CompilationPlan::build_operator(database, std::move(selection_node->child()), preparatory_tasks);
+        auto child = CompilationPlan::build_operator(database, std::move(selection_node->child()), preparatory_tasks,
+                                                     slab_arena);
 
         auto selection_operator = std::make_unique<execution::compilation::SelectionOperator>(
             topology::PhysicalSchema::from_logical(node->relation().schema()), std::move(selection_node->predicate()));
@@ -130,7 +173,8 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
     {
         auto *arithmetic_node = reinterpret_cast<logical::ArithmeticNode *>(node);
 
-        auto child = CompilationPlan::build_operator(database, std::move(arithmetic_node->child()), preparatory_tasks);
+        auto child = CompilationPlan::build_operator(database, std::move(arithmetic_node->child()), preparatory_tasks,
+                                                     slab_arena);
 
         auto arithmetic_operator = std::make_unique<execution::compilation::ArithmeticOperator>(
             topology::PhysicalSchema::from_logical(arithmetic_node->relation().schema()),
@@ -145,7 +189,8 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
     {
         auto *aggregation_node = reinterpret_cast<logical::AggregationNode *>(node);
         auto child = CompilationPlan::build_operator(
-            database, std::move(reinterpret_cast<logical::AggregationNode *>(node)->child()), preparatory_tasks);
+            database, std::move(reinterpret_cast<logical::AggregationNode *>(node)->child()), preparatory_tasks,
+            slab_arena);
 
         /// Full schema of the operator.
         auto schema = topology::PhysicalSchema::from_logical(aggregation_node->relation().schema());
@@ -165,9 +210,23 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
             /// Type of the hash table.
             const auto hash_table_type = execution::compilation::hashtable::Descriptor::Type::LinearProbing;
 
+            /// Worker-local hash tables for the hash aggregation.
+            const auto local_hash_table_capacity = execution::compilation::hashtable::TableProxy::allocation_capacity(
+                expected_cardinality, hash_table_type);
+            auto local_hash_table_descriptor =
+                execution::compilation::hashtable::Descriptor{hash_table_type, local_hash_table_capacity,
+                                                              group_schema.row_size(), aggregation_schema.row_size()};
+
+            /// Worker-local hash tables hold every group once per worker, the partitioned hash tables
+            /// of the radix aggregation only once; prefer the radix aggregation when memory is limited.
+            const auto is_local_hash_tables_fitting = CompilationPlan::is_fitting(
+                slab_arena,
+                count_workers * execution::compilation::hashtable::TableProxy::size(local_hash_table_descriptor));
+
             /// Use radix aggregation to build small hash tables.
             //            if (expected_cardinality > 1000U)
-            if (aggregation_node->method() == logical::AggregationNode::Method::RadixAggregation)
+            if (aggregation_node->method() == logical::AggregationNode::Method::RadixAggregation ||
+                is_local_hash_tables_fitting == false)
             {
                 /// Create radix bits.
                 auto radix_bits = RadixBitCalculator::calculate(hash_table_type, count_workers, expected_cardinality,
@@ -183,7 +242,7 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
 
                 /// Hash tables are shared partitions.
                 auto hash_tables = compilation::JoinPlanner::create_hash_tables(
-                    count_partitions, count_workers, hash_table_descriptor, preparatory_tasks);
+                    count_partitions, count_workers, hash_table_descriptor, preparatory_tasks, slab_arena);
 
                 /// Create partitions.
                 const auto &incoming_schema = child->schema();
@@ -237,17 +296,13 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
 
             /// Let all workers aggregate locally and merge afterwards.
             /// Build hash tables for every worker.
-            const auto hash_table_capacity = execution::compilation::hashtable::TableProxy::allocation_capacity(
-                expected_cardinality, hash_table_type);
-
-            auto hash_table_descriptor = execution::compilation::hashtable::Descriptor{
-                hash_table_type, hash_table_capacity, group_schema.row_size(), aggregation_schema.row_size()};
-            auto hash_tables =
-                CompilationPlan::build_aggregation_hash_tables(count_workers, hash_table_descriptor, preparatory_tasks);
+            auto hash_tables = CompilationPlan::build_aggregation_hash_tables(
+                count_workers, local_hash_table_descriptor, preparatory_tasks, slab_arena);
 
             auto aggregation_operator = std::make_unique<execution::compilation::GroupedAggregationOperator>(
                 std::move(schema), std::move(group_schema), std::move(aggregation_schema), child->schema(),
-                std::move(aggregation_node->aggregation_operations()), std::move(hash_tables), hash_table_descriptor);
+                std::move(aggregation_node->aggregation_operations()), std::move(hash_tables),
+                local_hash_table_descriptor);
             aggregation_operator->child(std::move(child));
 
             return aggregation_operator;
@@ -265,7 +320,8 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
     if (typeid(*node) == typeid(logical::LimitNode))
     {
         auto *limit_node = reinterpret_cast<logical::LimitNode *>(node);
-        auto child = CompilationPlan::build_operator(database, std::move(limit_node->child()), preparatory_tasks);
+        auto child =
+            CompilationPlan::build_operator(database, std::move(limit_node->child()), preparatory_tasks, slab_arena);
 
         auto limit_operator = std::make_unique<execution::compilation::LimitOperator>(
             topology::PhysicalSchema::from_logical(node->relation().schema()), limit_node->limit());
@@ -278,7 +334,7 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
     {
         auto *user_defined_function_node = reinterpret_cast<logical::UserDefinedNode *>(node);
         auto child = CompilationPlan::build_operator(database, std::move(user_defined_function_node->child()),
-                                                     preparatory_tasks);
+                                                     preparatory_tasks, slab_arena);
 
         auto user_defined_function_operator = std::make_unique<execution::compilation::UserDefinedOperator>(
             topology::PhysicalSchema::from_logical(node->relation().schema()),
@@ -294,7 +350,7 @@ std::unique_ptr<db::execution::compilation::OperatorInterface> CompilationPlan::
 
 std::vector<db::execution::compilation::hashtable::AbstractTable *> CompilationPlan::build_aggregation_hash_tables(
     const std::uint16_t count_partitions, const execution::compilation::hashtable::Descriptor &hash_table_descriptor,
-    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks)
+    std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena)
 {
     /// Create the hash tables.
     auto hash_tables = std::vector<db::execution::compilation::hashtable::AbstractTable *>{};
@@ -304,19 +360,36 @@ std::vector<db::execution::compilation::hashtable::AbstractTable *> CompilationP
     const auto worker_local_ht_size = execution::compilation::hashtable::TableProxy::size(hash_table_descriptor);
     for (auto worker_id = 0U; worker_id < count_partitions; ++worker_id)
     {
-        auto *hash_table_data =
-            mx::memory::GlobalHeap::allocate(mx::tasking::runtime::numa_node_id(worker_id), worker_local_ht_size);
+        const auto numa_node_id = mx::tasking::runtime::numa_node_id(worker_id);
+
+        /// Hash tables are allocated from the arena of the query, if any; otherwise from the global heap.
+        auto *hash_table_data = slab_arena != nullptr
+                                    ? slab_arena->allocate_block(local_worker_id, numa_node_id, worker_local_ht_size)
+                                    : nullptr;
+        auto *table_arena = hash_table_data != nullptr ? slab_arena : nullptr;
+        if (hash_table_data == nullptr)
+        {
+            hash_table_data = mx::memory::GlobalHeap::allocate(numa_node_id, worker_local_ht_size);
+        }
 
         execution::compilation::hashtable::AbstractTable *hash_table;
 
         if (hash_table_descriptor.table_type() == execution::compilation::hashtable::Descriptor::LinearProbing)
         {
-            hash_table =
-                new (hash_table_data) execution::compilation::hashtable::LinearProbingTable(hash_table_descriptor);
+            hash_table = new (hash_table_data)
+                execution::compilation::hashtable::LinearProbingTable(hash_table_descriptor, table_arena);
         }
         else if (hash_table_descriptor.table_type() == execution::compilation::hashtable::Descriptor::Chained)
         {
-            hash_table = new (hash_table_data) execution::compilation::hashtable::ChainedTable(hash_table_descriptor);
+            hash_table = new (hash_table_data)
+                execution::compilation::hashtable::ChainedTable(hash_table_descriptor, table_arena);
+        }
+
+        /// Tables that did not fit into the arena count for the query, too; released when the table is freed.
+        if (slab_arena != nullptr && table_arena == nullptr)
+        {
+            slab_arena->budget().charge(worker_local_ht_size);
+            hash_table->charged_budget(&slab_arena->budget());
         }
 
         hash_tables.emplace_back(hash_table);
@@ -6,17 +6,29 @@
 #include <db/plan/logical/plan.h>
 #include <db/topology/database.h>
 #include <memory>
+#include <mx/memory/slab_allocator.h>
 #include <nlohmann/json.hpp>
 
 namespace db::plan::physical {
 class CompilationPlan
 {
 public:
-    [[nodiscard]] static CompilationPlan build(const topology::Database &database, logical::Plan &&logical_plan);
+    /**
+     * Builds the physical operators for the given logical plan.
+     *
+     * @param database Database.
+     * @param logical_plan Logical plan.
+     * @param memory_limit Memory the query may use (in bytes); zero for no limit.
+     * @return The compilation plan.
+     */
+    [[nodiscard]] static CompilationPlan build(const topology::Database &database, logical::Plan &&logical_plan,
+                                               std::uint64_t memory_limit = 0U);
 
     explicit CompilationPlan(std::unique_ptr<execution::compilation::OperatorInterface> &&root_operator,
-                             std::vector<mx::tasking::TaskInterface *> &&preparatory_tasks) noexcept
-        : _root_operator(std::move(root_operator)), _preparatory_tasks(std::move(preparatory_tasks))
+                             std::vector<mx::tasking::TaskInterface *> &&preparatory_tasks,
+                             std::shared_ptr<mx::memory::slab::Arena> &&slab_arena) noexcept
+        : _slab_arena(std::move(slab_arena)), _root_operator(std::move(root_operator)),
+          _preparatory_tasks(std::move(preparatory_tasks))
     {
     }
 
@@ -34,6 +46,12 @@ public:
 
     [[nodiscard]] std::vector<mx::tasking::TaskInterface *> &preparatory_tasks() noexcept { return _preparatory_tasks; }
 
+    /**
+     * @return Arena holding the memory of the query (e.g., hash tables), that is
+     *  handed to the dataflow graph executing the query.
+     */
+    [[nodiscard]] const std::shared_ptr<mx::memory::slab::Arena> &slab_arena() const noexcept { return _slab_arena; }
+
     [[nodiscard]] std::unordered_map<std::string, std::vector<std::pair<std::uintptr_t, std::uintptr_t>>> memory_tags()
         const
     {
@@ -46,6 +64,9 @@ public:
     }
 
 private:
+    /// Arena of the query; has to be released after the operators.
+    std::shared_ptr<mx::memory::slab::Arena> _slab_arena;
+
     std::unique_ptr<execution::compilation::OperatorInterface> _root_operator;
     std::vector<mx::tasking::TaskInterface *> _preparatory_tasks;
 
@@ -55,11 +76,13 @@ private:
      *
      * @param database Database.
      * @param logical_node Logical plan node to translate.
+     * @param preparatory_tasks List to add tasks that prepare the execution.
+     * @param slab_arena Arena for memory of the query, may be nullptr.
      * @return Translated physical operator.
      */
     [[nodiscard]] static std::unique_ptr<execution::compilation::OperatorInterface> build_operator(
         const topology::Database &database, std::unique_ptr<logical::NodeInterface> &&logical_node,
-        std::vector<mx::tasking::TaskInterface *> &preparatory_tasks);
+        std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena);
 
     /**
      * Builds a set of hash tables for grouped aggregation.
@@ -68,11 +91,12 @@ private:
      * @param count_partitions Number of partitions.
      * @param hash_table_descriptor Descriptor of the hash table.
      * @param preparatory_tasks
+     * @param slab_arena Arena to allocate the hash tables from, may be nullptr.
      * @return List of hash tables.
      */
     [[nodiscard]] static std::vector<execution::compilation::hashtable::AbstractTable *> build_aggregation_hash_tables(
         std::uint16_t count_partitions, const execution::compilation::hashtable::Descriptor &hash_table_descriptor,
-        std::vector<mx::tasking::TaskInterface *> &preparatory_tasks);
+        std::vector<mx::tasking::TaskInterface *> &preparatory_tasks, mx::memory::slab::Arena *slab_arena);
 
     /**
      *
@@ -83,5 +107,17 @@ private:
      */
     [[nodiscard]] static std::vector<mx::resource::ptr> build_radix_partitions(
         const std::vector<std::uint8_t> &radix_bits, std::uint8_t pass, std::uint16_t count_worker);
+
+    /**
+     * Checks whether memory of the given size fits into the limit of the query.
+     *
+     * @param slab_arena Arena of the query, may be nullptr.
+     * @param size Size of the memory.
+     * @return True, if the query has no limit or the memory fits.
+     */
+    [[nodiscard]] static bool is_fitting(const mx::memory::slab::Arena *slab_arena, const std::uint64_t size) noexcept
+    {
+        return slab_arena == nullptr || slab_arena->budget().is_fitting(size);
+    }
 };
 } // namespace db::plan::physical
\ No newline at end of file
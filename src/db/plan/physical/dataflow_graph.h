@@ -7,8 +7,10 @@ namespace db::plan::physical {
 class DataFlowGraph : public mx::tasking::dataflow::Graph<execution::RecordSet>
 {
 public:
-    explicit DataFlowGraph(const bool is_record_times = false)
-        : mx::tasking::dataflow::Graph<execution::RecordSet>(is_record_times)
+    explicit DataFlowGraph(const bool is_record_times = false,
+                           std::shared_ptr<mx::memory::slab::Arena> slab_arena = nullptr)
+        : mx::tasking::dataflow::Graph<execution::RecordSet>(is_record_times, mx::tasking::priority::normal,
+                                                             std::move(slab_arena))
     {
     }
     ~DataFlowGraph() override = default;
@@ -5,6 +5,8 @@
 #include <db/execution/interpretation/deliver_node.h>
 #include <db/execution/interpretation/describe_table_node.h>
 #include <db/execution/interpretation/insert_node.h>
+#include <db/execution/interpretation/set_placement_node.h>
+#include <db/execution/interpretation/show_memory_node.h>
 #include <db/execution/interpretation/show_tables_node.h>
 #include <db/execution/interpretation/update_statistics_node.h>
 #include <db/plan/logical/node/command_nodes.h>
@@ -67,8 +69,8 @@ DataFlowGraph *InterpretationGraph::build(topology::Database &database,
 
     /// (Normal) user requests will be answered by the gather result node,
     /// which collects the results and send them to the user.
-    auto *gather_results_node =
-        new execution::GatherQueryResultNode{client_id, std::move(chronometer), last_operator_node->schema()};
+    auto *gather_results_node = new execution::GatherQueryResultNode{client_id, std::move(chronometer),
+                                                                     last_operator_node->schema(), graph->slab_arena()};
     graph->make_edge(dynamic_cast<mx::tasking::dataflow::NodeInterface<execution::RecordSet> *>(last_operator_node),
                      gather_results_node);
     return graph;
@@ -97,7 +99,8 @@ db::execution::OperatorInterface *InterpretationGraph::build(topology::Database
     {
         auto *create_table_node = reinterpret_cast<logical::CreateTableNode *>(node);
         return new execution::interpretation::CreateTableNode(database, std::move(create_table_node->table_name()),
-                                                              std::move(create_table_node->physical_schema()));
+                                                              std::move(create_table_node->physical_schema()),
+                                                              create_table_node->placement());
     }
 
     if (typeid(*node) == typeid(logical::InsertNode))
@@ -121,6 +124,11 @@ db::execution::OperatorInterface *InterpretationGraph::build(topology::Database
         return new execution::interpretation::ShowTablesNode{database};
     }
 
+    if (typeid(*node) == typeid(logical::ShowMemoryNode))
+    {
+        return new execution::interpretation::ShowMemoryNode{};
+    }
+
     if (typeid(*node) == typeid(logical::DescribeTableNode))
     {
         const auto &table_name = reinterpret_cast<logical::DescribeTableNode *>(node)->table_name();
@@ -133,6 +141,13 @@ db::execution::OperatorInterface *InterpretationGraph::build(topology::Database
         return new execution::interpretation::UpdateStatisticsNode{database[table_name]};
     }
 
+    if (typeid(*node) == typeid(logical::SetPlacementNode))
+    {
+        auto *set_placement_node = reinterpret_cast<logical::SetPlacementNode *>(node);
+        return new execution::interpretation::SetPlacementNode{database[set_placement_node->table_name()],
+                                                               set_placement_node->placement()};
+    }
+
     if (typeid(*node) == typeid(logical::CopyNode))
     {
         auto *copy_node = reinterpret_cast<logical::CopyNode *>(node);
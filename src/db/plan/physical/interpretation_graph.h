@@ -28,7 +28,7 @@ private:
 
     template <class T> static void register_for_tracing(T *node)
     {
-        if constexpr (mx::tasking::config::is_collect_task_traces())
+        if (mx::tasking::runtime::configuration().is_collect_task_traces())
         {
             const auto trace_id = node->trace_id();
             if (trace_id > 0U)
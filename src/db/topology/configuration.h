@@ -1,6 +1,9 @@
 #pragma once
 
 #include <cstdint>
+#include <db/config.h>
+#include <mx/tasking/priority.h>
+#include <mx/tasking/runtime_config.h>
 #include <mx/util/core_set.h>
 
 namespace db::topology {
@@ -16,8 +19,38 @@ public:
     [[nodiscard]] std::uint16_t count_cores() const noexcept { return _count_cores; }
     [[nodiscard]] mx::util::core_set::Order cores_order() const noexcept { return _cores_order; }
 
+    /**
+     * Limit of the memory every query may use (in bytes); zero for no limit.
+     * Unlike the tasking settings, the limit applies without restarting the runtime.
+     */
+    void memory_limit(const std::uint64_t memory_limit) noexcept { _memory_limit = memory_limit; }
+    [[nodiscard]] std::uint64_t memory_limit() const noexcept { return _memory_limit; }
+
+    /**
+     * Priority of the tasks of following queries; applies without restarting the runtime.
+     */
+    void query_priority(const mx::tasking::priority priority) noexcept { _query_priority = priority; }
+    [[nodiscard]] mx::tasking::priority query_priority() const noexcept { return _query_priority; }
+
+    /**
+     * Scan tables by morsels pulled by the workers (see config::is_use_morsel_driven_scans())
+     * in following queries; applies without restarting the runtime.
+     */
+    void is_use_morsel_driven_scans(const bool is_use) noexcept { _is_use_morsel_driven_scans = is_use; }
+    [[nodiscard]] bool is_use_morsel_driven_scans() const noexcept { return _is_use_morsel_driven_scans; }
+
+    /**
+     * Settings the tasking runtime is (re-)started with.
+     */
+    [[nodiscard]] mx::tasking::runtime_config &tasking() noexcept { return _tasking; }
+    [[nodiscard]] const mx::tasking::runtime_config &tasking() const noexcept { return _tasking; }
+
 private:
     std::uint16_t _count_cores{0U};
     mx::util::core_set::Order _cores_order{mx::util::core_set::Order::NUMAAware};
+    std::uint64_t _memory_limit{0U};
+    mx::tasking::priority _query_priority{mx::tasking::priority::normal};
+    bool _is_use_morsel_driven_scans{config::is_use_morsel_driven_scans()};
+    mx::tasking::runtime_config _tasking;
 };
 } // namespace db::topology
\ No newline at end of file
@@ -33,9 +33,10 @@ public:
     const Table &operator[](const std::string &table_name) const { return _tables.at(table_name); }
     Table &operator[](const std::string &table_name) { return _tables.at(table_name); }
 
-    Table &insert(std::string &&table_name, PhysicalSchema &&schema) noexcept
+    Table &insert(std::string &&table_name, PhysicalSchema &&schema,
+                  const Placement placement = Placement::Local) noexcept
     {
-        auto table = Table{std::string(table_name), std::move(schema)};
+        auto table = Table{std::string(table_name), std::move(schema), placement};
         auto [table_iterator, _] = _tables.insert(std::make_pair(std::move(table_name), std::move(table)));
 
         /// Add the first storage tile.
@@ -65,6 +66,14 @@ public:
         }
     }
 
+    void rebalance_tiles(const std::uint16_t count_workers)
+    {
+        for (auto &[_, table] : _tables)
+        {
+            table.rebalance_tiles(count_workers);
+        }
+    }
+
     [[nodiscard]] std::unordered_map<std::string, util::TileSample> map_to_tiles(
         const perf::AggregatedSamples &samples) const
     {
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace db::topology {
+/**
+ * Placement of the tiles of a table within the NUMA regions.
+ */
+enum class Placement : std::uint8_t
+{
+    Local,       /// Every tile lives on the NUMA node of the worker it is mapped to.
+    Interleaved, /// The pages of every tile are interleaved over all NUMA nodes.
+    Replicated   /// Every NUMA node holds a copy of every tile; workers scan the copy of their node.
+};
+
+[[nodiscard]] inline std::string to_string(const Placement placement)
+{
+    switch (placement)
+    {
+    case Placement::Interleaved:
+        return "interleaved";
+    case Placement::Replicated:
+        return "replicated";
+    default:
+        return "local";
+    }
+}
+
+/**
+ * @param name Name of the placement (case insensitive).
+ * @return The placement or std::nullopt, if the name is unknown.
+ */
+[[nodiscard]] inline std::optional<Placement> placement_from_string(std::string name)
+{
+    std::transform(name.begin(), name.end(), name.begin(), [](const auto character) { return std::tolower(character); });
+
+    if (name == "local")
+    {
+        return Placement::Local;
+    }
+
+    if (name == "interleaved")
+    {
+        return Placement::Interleaved;
+    }
+
+    if (name == "replicated")
+    {
+        return Placement::Replicated;
+    }
+
+    return std::nullopt;
+}
+} // namespace db::topology
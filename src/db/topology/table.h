@@ -1,29 +1,47 @@
 #pragma once
 #include "physical_schema.h"
+#include "placement.h"
 #include <db/config.h>
 #include <db/data/pax_tile.h>
 #include <db/statistic/statistics.h>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mx/memory/global_heap.h>
+#include <mx/synchronization/rw_spinlock.h>
 #include <mx/system/cache.h>
+#include <mx/system/cpu.h>
 #include <mx/tasking/runtime.h>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace db::topology {
+/**
+ * The table stores its records in tiles that are mapped round robin to the workers.
+ * Where the tiles live depends on the placement of the table: Local tiles live on the
+ * NUMA node of their worker; interleaved tiles spread their pages over all nodes; and
+ * replicated tables keep a copy of every tile on every node, scans read the copy that
+ * is local to the scanning worker. Replicas are updated when records are inserted.
+ */
 class Table
 {
 public:
-    Table(std::string &&name, PhysicalSchema &&schema) noexcept
-        : _name(std::move(name)), _schema(std::move(schema)), _statistics(_schema.size())
+    Table(std::string &&name, PhysicalSchema &&schema, const Placement placement = Placement::Local) noexcept
+        : _name(std::move(name)), _schema(std::move(schema)), _statistics(_schema.size()), _placement(placement)
     {
+        _tile_index_latch.initialize();
     }
 
     Table(Table &&other) noexcept
         : _name(std::move(other._name)), _schema(std::move(other._schema)), _statistics(std::move(other._statistics)),
-          _tiles(std::move(other._tiles)), _tile_index(std::move(other._tile_index)),
-          _next_worker_id(other._next_worker_id.load())
+          _placement(other._placement), _tiles(std::move(other._tiles)), _replicas(std::move(other._replicas)),
+          _tile_index(std::move(other._tile_index)), _retired_tiles(std::move(other._retired_tiles)),
+          _retired_replicas(std::move(other._retired_replicas)), _next_worker_id(other._next_worker_id.load())
     {
+        _tile_index_latch.initialize();
     }
 
     Table(const Table &) = delete;
@@ -36,21 +54,144 @@ public:
     [[nodiscard]] const statistic::Statistics &statistics() const noexcept { return _statistics; }
     [[nodiscard]] statistic::Statistics &statistics() noexcept { return _statistics; }
 
+    [[nodiscard]] Placement placement() const noexcept { return _placement; }
+
+    /**
+     * Moves the tiles of the table to the given placement. Tiles are copied when
+     * their memory changes (e.g., from local to interleaved memory), replicas are
+     * created or released. Tiles that are replaced are retired and freed once no scan
+     * pins the table anymore, running scans keep reading the old tiles.
+     *
+     * @param placement New placement of the table.
+     */
+    void placement(const Placement placement)
+    {
+        if (placement == _placement)
+        {
+            return;
+        }
+
+        _tile_index_latch.lock();
+
+        /// Local and replicated tables keep the original tiles on the node of their worker.
+        if ((placement == Placement::Interleaved) != (_placement == Placement::Interleaved))
+        {
+            for (auto &tile_ptr : _tiles)
+            {
+                auto moved_tile_ptr = this->allocate_tile(placement, tile_ptr.worker_id());
+                Table::copy(tile_ptr, moved_tile_ptr);
+                _retired_tiles.emplace_back(_placement, tile_ptr);
+                tile_ptr = moved_tile_ptr;
+            }
+        }
+
+        if (_placement == Placement::Replicated)
+        {
+            this->release_replicas();
+        }
+
+        _placement = placement;
+
+        if (_placement == Placement::Replicated)
+        {
+            _replicas.resize(mx::system::cpu::max_node_id() + 1U);
+            this->update_replicas(0U);
+        }
+
+        if (_count_pins.load(std::memory_order_seq_cst) == 0U)
+        {
+            this->free_retired_tiles();
+        }
+
+        _tile_index_latch.unlock();
+    }
+
+    /**
+     * Pins the tiles of the table for a scan: Tiles replaced while the
+     * table is pinned are not freed before the last scan unpinned it.
+     * Scans pin the table before reading any tile.
+     */
+    void pin() const noexcept { _count_pins.fetch_add(1U, std::memory_order_seq_cst); }
+
+    /**
+     * Releases the pin of a scan; the last scan frees the retired tiles.
+     */
+    void unpin() const
+    {
+        if (_count_pins.fetch_sub(1U, std::memory_order_seq_cst) == 1U)
+        {
+            _tile_index_latch.lock();
+
+            /// Scans that pinned the table in the meantime may read tiles retired before.
+            if (_count_pins.load(std::memory_order_seq_cst) == 0U)
+            {
+                this->free_retired_tiles();
+            }
+            _tile_index_latch.unlock();
+        }
+    }
+
     [[nodiscard]] const std::vector<mx::resource::ptr> &tiles() const noexcept { return _tiles; }
-    [[nodiscard]] const std::unordered_map<std::uint16_t, std::vector<mx::resource::ptr>> &tiles_index() const noexcept
+
+    /**
+     * Calls the callback for every tile that is mapped to the given worker.
+     * For replicated tables, the callback receives the replica on the NUMA
+     * node of the worker. Tiles may be re-homed concurrently when the set
+     * of workers is resized (in between queries).
+     *
+     * @param worker_id Worker.
+     * @param callback Callback called for every tile of the worker.
+     */
+    template <typename F> void for_each_tile(const std::uint16_t worker_id, F &&callback) const
     {
-        return _tile_index;
+        _tile_index_latch.lock_shared();
+        if (auto iterator = _tile_index.find(worker_id); iterator != _tile_index.end())
+        {
+            const auto &tiles = _placement == Placement::Replicated
+                                    ? _replicas[mx::tasking::runtime::numa_node_id(worker_id)]
+                                    : _tiles;
+            for (const auto tile_id : iterator->second)
+            {
+                callback(tiles[tile_id]);
+            }
+        }
+        _tile_index_latch.unlock_shared();
+    }
+
+    /**
+     * @param worker_id Worker.
+     * @return Number of tiles mapped to the given worker.
+     */
+    [[nodiscard]] std::size_t count_tiles(const std::uint16_t worker_id) const
+    {
+        _tile_index_latch.lock_shared();
+        const auto iterator = _tile_index.find(worker_id);
+        const auto count = iterator != _tile_index.end() ? iterator->second.size() : 0U;
+        _tile_index_latch.unlock_shared();
+
+        return count;
     }
 
-    void initialize() { _tiles.emplace_back(make_tile()); }
+    void initialize()
+    {
+        if (_placement == Placement::Replicated)
+        {
+            _replicas.resize(mx::system::cpu::max_node_id() + 1U);
+        }
+
+        make_tile();
+    }
 
     void emplace_back(data::PaxTile *tile)
     {
         if (mx::resource::ptr_cast<data::PaxTile>(_tiles.back())->full())
         {
-            _tiles.emplace_back(make_tile());
+            make_tile();
         }
 
+        /// Tiles from this one on will be modified.
+        const auto first_tile_id = _tiles.size() - 1U;
+
         const auto count_records = tile->size();
         auto inserted = 0U;
         while (inserted < count_records)
@@ -59,36 +200,73 @@ public:
             inserted += persistent_tile->emplace_back(tile, inserted);
             if (persistent_tile->full())
             {
-                _tiles.emplace_back(make_tile());
+                make_tile();
             }
         }
+
+        if (_placement == Placement::Replicated)
+        {
+            _tile_index_latch.lock();
+            this->update_replicas(first_tile_id);
+            _tile_index_latch.unlock();
+        }
     }
 
     void update_core_mapping(const mx::util::core_set &new_core_set)
     {
         _tile_index.clear();
         auto next_worker_id = 0UL;
-        for (auto &tile_ptr : _tiles)
+        for (auto tile_id = 0U; tile_id < _tiles.size(); ++tile_id)
         {
-            const auto mapped_worker_id = next_worker_id++ % new_core_set.count_cores();
-
-            auto info = tile_ptr.info();
-            info.worker_id(mapped_worker_id);
-            tile_ptr.reset(info);
+            const auto mapped_worker_id = std::uint16_t(next_worker_id++ % new_core_set.count_cores());
+            this->map_tile(tile_id, mapped_worker_id);
 
             /// Rebuild tile index.
             auto iterator = _tile_index.find(mapped_worker_id);
             if (iterator == _tile_index.end())
             {
-                auto tiles = std::vector<mx::resource::ptr>{};
+                auto tiles = std::vector<std::uint64_t>{};
                 tiles.reserve(1024U);
                 iterator = _tile_index.insert(std::make_pair(mapped_worker_id, std::move(tiles))).first;
             }
-            iterator->second.emplace_back(tile_ptr);
+            iterator->second.emplace_back(tile_id);
         }
         _next_worker_id.store(next_worker_id);
     }
 
+    /**
+     * Re-homes tiles after the set of active workers was resized without
+     * restarting the runtime. Tiles of workers that left are moved to the
+     * remaining workers; when workers joined, tiles exceeding the fair share
+     * of a worker are moved to the new workers. All other tiles stay
+     * at their worker. Moved tiles are copied to the NUMA node of their
+     * new worker, unless they are interleaved.
+     * Only the mapping is changed at once; tiles are copied one by one without
+     * holding the latch, scans read the former tile until the copy is published.
+     *
+     * @param count_workers Number of active workers.
+     */
+    void rebalance_tiles(const std::uint16_t count_workers)
+    {
+        /// Tiles that are retired while copying are not freed before the copies are published.
+        this->pin();
+
+        _tile_index_latch.lock();
+        const auto placement = _placement;
+        const auto moving_tiles = this->remap_tiles(count_workers);
+        _tile_index_latch.unlock();
+
+        if (placement != Placement::Interleaved)
+        {
+            for (const auto &[tile_id, tile_ptr] : moving_tiles)
+            {
+                this->move_tile(placement, tile_id, tile_ptr);
+            }
+        }
+
+        this->unpin();
+    }
+
 private:
     /// Name of the table.
     std::string _name;
@@ -99,32 +277,277 @@ private:
     /// Statistics per column.
     statistic::Statistics _statistics;
 
+    /// Placement of the tiles in NUMA memory.
+    Placement _placement;
+
     /// List of tiles.
     std::vector<mx::resource::ptr> _tiles;
 
-    /// Index for tiles indexed by worker id.
-    std::unordered_map<std::uint16_t, std::vector<mx::resource::ptr>> _tile_index;
+    /// Copies of the tiles for every NUMA node, when the table is replicated.
+    std::vector<std::vector<mx::resource::ptr>> _replicas;
+
+    /// Ids (index in the list of tiles) of the tiles mapped to a worker.
+    std::unordered_map<std::uint16_t, std::vector<std::uint64_t>> _tile_index;
+
+    /// Tiles (with the placement they were allocated for) and replicas replaced while scans pinned the table.
+    mutable std::vector<std::pair<Placement, mx::resource::ptr>> _retired_tiles;
+    mutable std::vector<mx::resource::ptr> _retired_replicas;
+
+    /// Latch for the tile index, that may be re-homed while scanning.
+    mutable mx::synchronization::RWSpinLock _tile_index_latch;
+
+    /// Number of scans that read the tiles of the table.
+    mutable std::atomic_uint64_t _count_pins{0U};
 
     /// Incrementable int to distribute tiles round robin around all workers.
     alignas(mx::system::cache::line_size()) std::atomic_uint64_t _next_worker_id{0U};
 
-    [[nodiscard]] mx::resource::ptr make_tile()
+    /**
+     * Adds an empty tile (and its replicas) to the table.
+     */
+    void make_tile()
     {
         /// Map tiles round robin around channels.
         const auto mapping_id = std::uint16_t(_next_worker_id.fetch_add(1U) % mx::tasking::runtime::workers());
 
-        auto tile = data::PaxTile::make(_schema, false, mapping_id);
+        auto tile = this->allocate_tile(_placement, mapping_id);
+
+        _tile_index_latch.lock();
+        const auto tile_id = _tiles.size();
+        _tiles.emplace_back(tile);
+        if (_placement == Placement::Replicated)
+        {
+            this->update_replicas(tile_id);
+        }
 
         auto iterator = _tile_index.find(mapping_id);
         if (iterator == _tile_index.end())
         {
-            auto tiles = std::vector<mx::resource::ptr>{};
+            auto tiles = std::vector<std::uint64_t>{};
             tiles.reserve(1024U);
             iterator = _tile_index.insert(std::make_pair(mapping_id, std::move(tiles))).first;
         }
-        iterator->second.emplace_back(tile);
+        iterator->second.emplace_back(tile_id);
+        _tile_index_latch.unlock();
+    }
+
+    /**
+     * Allocates an empty tile for the given placement.
+     *
+     * @param placement Placement of the table.
+     * @param worker_id Worker the tile is mapped to.
+     * @return The tile.
+     */
+    [[nodiscard]] mx::resource::ptr allocate_tile(const Placement placement, const std::uint16_t worker_id) const
+    {
+        if (placement == Placement::Interleaved)
+        {
+            auto *memory = mx::memory::GlobalHeap::allocate_interleaved(Table::tile_size(_schema));
+            return data::PaxTile::make_in_place(_schema, memory, worker_id);
+        }
+
+        return data::PaxTile::make(_schema, false, worker_id);
+    }
+
+    /**
+     * Frees a tile that was allocated for the given placement.
+     *
+     * @param placement Placement of the table.
+     * @param tile Tile to free.
+     */
+    void free_tile(const Placement placement, const mx::resource::ptr tile) const
+    {
+        if (placement == Placement::Interleaved)
+        {
+            tile.get<data::PaxTile>()->~PaxTile();
+            mx::memory::GlobalHeap::free_interleaved(tile.get(), Table::tile_size(_schema));
+        }
+        else
+        {
+            mx::tasking::runtime::delete_resource<data::PaxTile>(tile);
+        }
+    }
+
+    /**
+     * Copies the records appended to the tiles starting at the given tile id to the replicas
+     * of every NUMA node, replicas for new tiles are allocated on their node. Replicas are
+     * only appended to, since scans may read them. The caller holds the latch.
+     *
+     * @param first_tile_id Id of the first tile that was modified.
+     */
+    void update_replicas(const std::uint64_t first_tile_id)
+    {
+        for (auto numa_node_id = std::uint8_t(0U); numa_node_id < _replicas.size(); ++numa_node_id)
+        {
+            auto &replicas = _replicas[numa_node_id];
+            for (auto tile_id = first_tile_id; tile_id < _tiles.size(); ++tile_id)
+            {
+                if (tile_id == replicas.size())
+                {
+                    auto *memory = mx::memory::GlobalHeap::allocate(numa_node_id, Table::tile_size(_schema));
+                    replicas.emplace_back(data::PaxTile::make_in_place(_schema, memory, _tiles[tile_id].worker_id()));
+                }
+
+                Table::copy(_tiles[tile_id], replicas[tile_id]);
+            }
+        }
+    }
+
+    /**
+     * Retires the replicas of all NUMA nodes. The caller holds the latch.
+     */
+    void release_replicas()
+    {
+        for (auto &replicas : _replicas)
+        {
+            std::move(replicas.begin(), replicas.end(), std::back_inserter(_retired_replicas));
+        }
+        _replicas.clear();
+    }
+
+    /**
+     * Frees the retired tiles and replicas. The caller holds the latch and no scan pins the table.
+     */
+    void free_retired_tiles() const
+    {
+        for (const auto &[placement, tile] : _retired_tiles)
+        {
+            this->free_tile(placement, tile);
+        }
+        _retired_tiles.clear();
 
-        return tile;
+        for (const auto replica : _retired_replicas)
+        {
+            replica.get<data::PaxTile>()->~PaxTile();
+            mx::memory::GlobalHeap::free(replica.get(), Table::tile_size(_schema));
+        }
+        _retired_replicas.clear();
+    }
+
+    /**
+     * Maps the tile (and its replicas) to the given worker.
+     *
+     * @param tile_id Id of the tile.
+     * @param worker_id Worker the tile is mapped to.
+     */
+    void map_tile(const std::uint64_t tile_id, const std::uint16_t worker_id)
+    {
+        auto info = _tiles[tile_id].info();
+        info.worker_id(worker_id);
+        _tiles[tile_id].reset(info);
+
+        for (auto &replicas : _replicas)
+        {
+            if (tile_id < replicas.size())
+            {
+                auto replica_info = replicas[tile_id].info();
+                replica_info.worker_id(worker_id);
+                replicas[tile_id].reset(replica_info);
+            }
+        }
+    }
+
+    /**
+     * Maps tiles of leaving workers and tiles exceeding the fair share of a
+     * worker to workers holding less than their fair share. The tiles are not
+     * copied; the caller holds the latch.
+     *
+     * @param count_workers Number of active workers.
+     * @return Ids of the re-mapped tiles, with the tile before it was re-mapped.
+     */
+    [[nodiscard]] std::vector<std::pair<std::uint64_t, mx::resource::ptr>> remap_tiles(
+        const std::uint16_t count_workers)
+    {
+        const auto max_tiles_per_worker = (_tiles.size() + count_workers - 1U) / count_workers;
+
+        /// Collect tiles of leaving workers and tiles exceeding the fair share.
+        auto moving_tiles = std::vector<std::pair<std::uint64_t, mx::resource::ptr>>{};
+        for (auto iterator = _tile_index.begin(); iterator != _tile_index.end();)
+        {
+            auto &tiles = iterator->second;
+            const auto first_moving_tile = iterator->first >= count_workers
+                                               ? tiles.begin()
+                                               : tiles.begin() + std::min(tiles.size(), max_tiles_per_worker);
+            std::transform(first_moving_tile, tiles.end(), std::back_inserter(moving_tiles),
+                           [this](const auto tile_id) { return std::make_pair(tile_id, _tiles[tile_id]); });
+            tiles.erase(first_moving_tile, tiles.end());
+
+            iterator = tiles.empty() ? _tile_index.erase(iterator) : std::next(iterator);
+        }
+
+        /// Hand the tiles to workers holding less than their fair share.
+        auto worker_id = std::uint16_t(0U);
+        for (const auto &[tile_id, _] : moving_tiles)
+        {
+            while (_tile_index[worker_id].size() >= max_tiles_per_worker)
+            {
+                ++worker_id;
+            }
+
+            this->map_tile(tile_id, worker_id);
+            _tile_index[worker_id].emplace_back(tile_id);
+        }
+
+        return moving_tiles;
+    }
+
+    /**
+     * Copies a re-mapped tile to the NUMA node of its new worker (if the node
+     * changed) and retires the former tile. The tile is copied without holding
+     * the latch; records appended in the meantime are copied when the copy is
+     * published. The copy is dropped when the tile was replaced concurrently
+     * (e.g., by changing the placement). The caller pins the table.
+     *
+     * @param placement Placement of the table when the tile was re-mapped.
+     * @param tile_id Id of the tile.
+     * @param tile_ptr Tile before it was re-mapped.
+     */
+    void move_tile(const Placement placement, const std::uint64_t tile_id, const mx::resource::ptr tile_ptr)
+    {
+        _tile_index_latch.lock_shared();
+        const auto worker_id = _tiles[tile_id].worker_id();
+        _tile_index_latch.unlock_shared();
+
+        if (mx::tasking::runtime::numa_node_id(tile_ptr.worker_id()) == mx::tasking::runtime::numa_node_id(worker_id))
+        {
+            return;
+        }
+
+        auto moved_tile_ptr = this->allocate_tile(placement, worker_id);
+        Table::copy(tile_ptr, moved_tile_ptr);
+
+        _tile_index_latch.lock();
+        auto &current_tile_ptr = _tiles[tile_id];
+        if (_placement == placement && current_tile_ptr.get() == tile_ptr.get() &&
+            current_tile_ptr.worker_id() == worker_id)
+        {
+            Table::copy(current_tile_ptr, moved_tile_ptr);
+            _retired_tiles.emplace_back(placement, current_tile_ptr);
+            current_tile_ptr = moved_tile_ptr;
+        }
+        else
+        {
+            _retired_tiles.emplace_back(placement, moved_tile_ptr);
+        }
+        _tile_index_latch.unlock();
+    }
+
+    /**
+     * Appends the records of a tile that are missing in a copy of that tile. Tiles
+     * only grow; thus, the copy holds a prefix of the records of the source.
+     *
+     * @param source Tile to copy the records from.
+     * @param target Copy of the tile, holding a prefix of its records.
+     */
+    static void copy(const mx::resource::ptr source, const mx::resource::ptr target)
+    {
+        auto *target_tile = target.get<data::PaxTile>();
+        std::ignore = target_tile->emplace_back(source.get<data::PaxTile>(), target_tile->size());
+    }
+
+    [[nodiscard]] static std::size_t tile_size(const PhysicalSchema &schema) noexcept
+    {
+        return sizeof(data::PaxTile) + data::PaxTile::size(schema);
     }
 };
-} // namespace db::topology
\ No newline at end of file
+} // namespace db::topology
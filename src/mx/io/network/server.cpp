@@ -1,7 +1,9 @@
 #include "server.h"
 #include <limits>
+#include <linux/sockios.h>
 #include <mx/tasking/runtime.h>
 #include <netinet/in.h>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <unistd.h>
 
@@ -133,6 +135,23 @@ void Server::send(const std::uint32_t client_id, std::string &&message)
     ::send(this->_client_sockets[client_id], response.c_str(), response.length(), 0);
 }
 
+std::uint64_t Server::count_pending_bytes(const std::uint32_t client_id) const noexcept
+{
+    const auto client = this->_client_sockets[client_id];
+    if (client == 0U)
+    {
+        return 0U;
+    }
+
+    auto pending_bytes = std::int32_t{0};
+    if (::ioctl(std::int32_t(client), SIOCOUTQ, &pending_bytes) < 0)
+    {
+        return 0U;
+    }
+
+    return std::uint64_t(pending_bytes);
+}
+
 std::uint16_t Server::add_client(const std::int32_t client_socket)
 {
     for (auto i = 0U; i < this->_client_sockets.size(); ++i)
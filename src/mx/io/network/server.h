@@ -56,6 +56,12 @@ public:
     [[nodiscard]] std::uint16_t port() const noexcept { return _port; }
     void stop() noexcept;
     void send(std::uint32_t client_id, std::string &&message);
+
+    /**
+     * @param client_id Id of the client.
+     * @return Number of bytes sent to the client that were not acknowledged by the client, yet.
+     */
+    [[nodiscard]] std::uint64_t count_pending_bytes(std::uint32_t client_id) const noexcept;
     bool listen();
 
     [[nodiscard]] bool is_running() const noexcept { return _is_running; }
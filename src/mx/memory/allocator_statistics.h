@@ -0,0 +1,111 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace mx::memory {
+/**
+ * Usage of the memory of an allocator, held by a single worker (or all
+ * workers) on a single NUMA node. Statistics are read while the allocator
+ * is in use; thus, they are a (not necessarily consistent) snapshot.
+ */
+class AllocatorStatistics
+{
+public:
+    /// Worker id of statistics that are not owned by a single worker.
+    static constexpr auto all_workers() { return std::numeric_limits<std::uint16_t>::max(); }
+
+    constexpr AllocatorStatistics(const std::string_view allocator, const std::uint16_t worker_id,
+                                  const std::uint8_t numa_node_id) noexcept
+        : _allocator(allocator), _worker_id(worker_id), _numa_node_id(numa_node_id)
+    {
+    }
+    constexpr AllocatorStatistics(const AllocatorStatistics &) noexcept = default;
+    ~AllocatorStatistics() noexcept = default;
+
+    AllocatorStatistics &operator=(const AllocatorStatistics &) noexcept = default;
+
+    /**
+     * Adds the statistics of another worker on the same NUMA node.
+     *
+     * @param other Statistics of the other worker.
+     * @return These statistics.
+     */
+    AllocatorStatistics &operator+=(const AllocatorStatistics &other) noexcept
+    {
+        _in_use_bytes += other._in_use_bytes;
+        _cached_bytes += other._cached_bytes;
+        _count_blocks += other._count_blocks;
+        _count_remote_frees += other._count_remote_frees;
+        _largest_free_block = std::max(_largest_free_block, other._largest_free_block);
+        return *this;
+    }
+
+    void in_use_bytes(const std::uint64_t bytes) noexcept { _in_use_bytes = bytes; }
+    void cached_bytes(const std::uint64_t bytes) noexcept { _cached_bytes = bytes; }
+    void count_blocks(const std::uint64_t count) noexcept { _count_blocks = count; }
+    void count_remote_frees(const std::uint64_t count) noexcept { _count_remote_frees = count; }
+    void largest_free_block(const std::uint64_t bytes) noexcept { _largest_free_block = bytes; }
+
+    [[nodiscard]] std::string_view allocator() const noexcept { return _allocator; }
+    [[nodiscard]] std::uint16_t worker_id() const noexcept { return _worker_id; }
+    [[nodiscard]] std::uint8_t numa_node_id() const noexcept { return _numa_node_id; }
+
+    /**
+     * @return Bytes handed out to the application (including headers and alignment).
+     */
+    [[nodiscard]] std::uint64_t in_use_bytes() const noexcept { return _in_use_bytes; }
+
+    /**
+     * @return Bytes allocated from the global heap but not handed out.
+     */
+    [[nodiscard]] std::uint64_t cached_bytes() const noexcept { return _cached_bytes; }
+
+    /**
+     * @return Number of blocks (or chunks) allocated from the global heap.
+     */
+    [[nodiscard]] std::uint64_t count_blocks() const noexcept { return _count_blocks; }
+
+    /**
+     * @return Number of objects freed by other workers that were not yet returned to the blocks.
+     */
+    [[nodiscard]] std::uint64_t count_remote_frees() const noexcept { return _count_remote_frees; }
+
+    /**
+     * @return Size of the largest contiguous free memory.
+     */
+    [[nodiscard]] std::uint64_t largest_free_block() const noexcept { return _largest_free_block; }
+
+    /**
+     * @return Share of the cached memory that is not part of the largest free block;
+     *  zero for no fragmentation, close to one if the cached memory is scattered.
+     */
+    [[nodiscard]] double fragmentation() const noexcept
+    {
+        if (_cached_bytes == 0U)
+        {
+            return 0.0;
+        }
+
+        return 1.0 - (double(std::min(_largest_free_block, _cached_bytes)) / double(_cached_bytes));
+    }
+
+private:
+    /// Name of the allocator (e.g., resources or tasks).
+    std::string_view _allocator;
+
+    /// Worker holding the memory or all_workers().
+    std::uint16_t _worker_id;
+
+    /// NUMA node the memory is allocated on.
+    std::uint8_t _numa_node_id;
+
+    std::uint64_t _in_use_bytes{0U};
+    std::uint64_t _cached_bytes{0U};
+    std::uint64_t _count_blocks{0U};
+    std::uint64_t _count_remote_frees{0U};
+    std::uint64_t _largest_free_block{0U};
+};
+} // namespace mx::memory
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace mx::memory {
+/**
+ * The budget accounts the memory held by a consumer (e.g., a query). Allocations
+ * can be charged and released by any thread; the budget keeps track of the current
+ * and the peak usage. When a limit is set and the usage exceeds that limit, the budget
+ * remembers the overrun; the consumer decides how to react (e.g., cancel the query).
+ */
+class Budget
+{
+public:
+    /**
+     * Snapshot of the usage, that outlives the budget (e.g., for reporting).
+     */
+    class Usage
+    {
+    public:
+        constexpr Usage(const std::uint64_t current, const std::uint64_t peak, const std::uint64_t limit) noexcept
+            : _current(current), _peak(peak), _limit(limit)
+        {
+        }
+        ~Usage() noexcept = default;
+
+        [[nodiscard]] std::uint64_t current() const noexcept { return _current; }
+        [[nodiscard]] std::uint64_t peak() const noexcept { return _peak; }
+        [[nodiscard]] std::uint64_t limit() const noexcept { return _limit; }
+
+    private:
+        std::uint64_t _current;
+        std::uint64_t _peak;
+        std::uint64_t _limit;
+    };
+
+    /**
+     * @param limit Limit in bytes; zero for no limit.
+     */
+    explicit Budget(const std::uint64_t limit = 0U) noexcept : _limit(limit) {}
+    ~Budget() noexcept = default;
+
+    /**
+     * Charges an allocation to the budget.
+     *
+     * @param size Size of the allocation.
+     * @return False, if the allocation exceeds the limit.
+     */
+    bool charge(const std::uint64_t size) noexcept
+    {
+        const auto current = _current.fetch_add(size, std::memory_order_relaxed) + size;
+
+        auto peak = _peak.load(std::memory_order_relaxed);
+        while (current > peak && _peak.compare_exchange_weak(peak, current, std::memory_order_relaxed) == false)
+        {
+        }
+
+        if (_limit > 0U && current > _limit) [[unlikely]]
+        {
+            _is_exceeded.store(true, std::memory_order_relaxed);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Releases an allocation that was charged before.
+     *
+     * @param size Size of the allocation.
+     */
+    void release(const std::uint64_t size) noexcept { _current.fetch_sub(size, std::memory_order_relaxed); }
+
+    /**
+     * @return True, if the usage exceeded the limit (at any time).
+     */
+    [[nodiscard]] bool is_exceeded() const noexcept { return _is_exceeded.load(std::memory_order_relaxed); }
+
+    /**
+     * Checks whether an allocation of the given size would exceed the limit,
+     * without charging the allocation.
+     *
+     * @param size Size of the allocation.
+     * @return True, if the allocation fits into the limit.
+     */
+    [[nodiscard]] bool is_fitting(const std::uint64_t size) const noexcept
+    {
+        return _limit == 0U || current() + size <= _limit;
+    }
+
+    [[nodiscard]] std::uint64_t limit() const noexcept { return _limit; }
+    [[nodiscard]] std::uint64_t current() const noexcept { return _current.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t peak() const noexcept { return _peak.load(std::memory_order_relaxed); }
+    [[nodiscard]] Usage usage() const noexcept { return Usage{current(), peak(), _limit}; }
+
+private:
+    /// Limit in bytes, zero for no limit.
+    const std::uint64_t _limit;
+
+    /// Charged and not released bytes.
+    std::atomic_uint64_t _current{0U};
+
+    /// Maximal charged bytes at a time.
+    std::atomic_uint64_t _peak{0U};
+
+    /// True, once the current usage exceeded the limit.
+    std::atomic_bool _is_exceeded{false};
+};
+} // namespace mx::memory
@@ -1,10 +1,19 @@
 #pragma once
 #include <chrono>
+#include <cstddef>
 
 namespace mx::memory {
 class config
 {
 public:
+    enum huge_page_backing
+    {
+        None,        /// Memory of the global heap is backed by 4KB pages.
+        Transparent, /// Memory is aligned to 2MB and advised for transparent huge pages (madvise).
+        Explicit2MB, /// Memory is mapped with explicit 2MB pages (MAP_HUGETLB), THP as fallback.
+        Explicit1GB  /// Like Explicit2MB, but allocations of at least 1GB use 1GB pages.
+    };
+
     /**
      * @return Number of maximal provided NUMA regions.
      */
@@ -24,5 +33,51 @@ public:
      * @return True, if garbage is removed local.
      */
     static constexpr auto local_garbage_collection() { return false; }
+
+    /**
+     * Quiescent-state-based reclamation collects retired resources in a limbo
+     * list per worker. When a limbo list reaches this size, the worker tries to
+     * reclaim on every retirement and every quiescent state.
+     *
+     * @return Number of resources a limbo list holds before reclaiming eagerly.
+     */
+    static constexpr auto max_limbo_list_size() { return 1024U; }
+
+    /**
+     * @return Number of quiescent states of a worker between two attempts to reclaim its limbo list.
+     */
+    static constexpr auto quiescent_states_per_reclamation() { return 32U; }
+
+    /**
+     * Explicit huge pages have to be reserved by the system (e.g., via
+     * /proc/sys/vm/nr_hugepages); otherwise, allocations fall back to
+     * transparent huge pages.
+     *
+     * @return Backing of large allocations from the global heap.
+     */
+    static constexpr auto huge_pages() { return huge_page_backing::Transparent; }
+
+    /**
+     * @return Minimal size of an allocation from the global heap to be backed by huge pages.
+     */
+    static constexpr auto huge_page_threshold() { return std::size_t(1U) << 21U; }
+
+    /**
+     * Slabs of a size class start small and double with every
+     * new slab of the class, up to this size.
+     *
+     * @return Maximal size of a slab of the slab allocator.
+     */
+    static constexpr auto max_slab_size() { return std::size_t(1U) << 21U; }
+
+    /**
+     * @return Number of objects in the first slab of a size class.
+     */
+    static constexpr auto min_slab_objects() { return 16U; }
+
+    /**
+     * @return Maximal number of size classes per worker of a slab arena.
+     */
+    static constexpr auto max_slab_size_classes() { return 8U; }
 };
 } // namespace mx::memory
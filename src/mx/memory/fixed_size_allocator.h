@@ -78,17 +78,11 @@ public:
 
     ~ProcessorHeap() noexcept
     {
-        for (const auto allocated_chunk : _allocated_chunks)
+        /// Chunks are cut from larger mappings that may be backed by huge pages;
+        /// only whole mappings can be returned to the global heap.
+        for (auto *heap_memory : _heap_memories)
         {
-            GlobalHeap::free(static_cast<void *>(allocated_chunk), Chunk::size());
-        }
-
-        for (const auto free_chunk : _free_chunk_buffer)
-        {
-            if (static_cast<bool>(free_chunk))
-            {
-                GlobalHeap::free(static_cast<void *>(free_chunk), Chunk::size());
-            }
+            GlobalHeap::free(heap_memory, ProcessorHeap::heap_memory_size());
         }
     }
 
@@ -100,6 +94,9 @@ public:
         _next_free_chunk.store(other._next_free_chunk.load());
         _fill_buffer_flag.store(other._fill_buffer_flag.load());
         _allocated_chunks = std::move(other._allocated_chunks);
+        _heap_memories = std::move(other._heap_memories);
+        _count_chunks.store(other._count_chunks.exchange(0U));
+        _count_handed_out_chunks.store(other._count_handed_out_chunks.exchange(0U));
         return *this;
     }
 
@@ -120,6 +117,7 @@ public:
         const auto next_free_chunk = _next_free_chunk.fetch_add(1U, std::memory_order_relaxed);
         if (next_free_chunk < _free_chunk_buffer.size())
         {
+            _count_handed_out_chunks.fetch_add(1U, std::memory_order_relaxed);
             return _free_chunk_buffer[next_free_chunk];
         }
 
@@ -167,6 +165,26 @@ public:
         return chunks;
     }
 
+    /**
+     * Chunks handed out to the workers count as used, although the
+     * workers may hold free objects of these chunks in their lists.
+     *
+     * @return Usage of the chunks of the ProcessorHeap.
+     */
+    [[nodiscard]] AllocatorStatistics statistics() const noexcept
+    {
+        const auto count_chunks = _count_chunks.load(std::memory_order_relaxed);
+        const auto count_handed_out_chunks =
+            std::min(_count_handed_out_chunks.load(std::memory_order_relaxed), count_chunks);
+
+        auto statistics = AllocatorStatistics{"tasks", AllocatorStatistics::all_workers(), _numa_node_id};
+        statistics.in_use_bytes(count_handed_out_chunks * Chunk::size());
+        statistics.cached_bytes((count_chunks - count_handed_out_chunks) * Chunk::size());
+        statistics.count_blocks(count_chunks);
+        statistics.largest_free_block(count_chunks > count_handed_out_chunks ? Chunk::size() : 0U);
+        return statistics;
+    }
+
 private:
     // Size of the internal chunk buffer.
     inline static constexpr auto CHUNKS = 128U;
@@ -183,9 +201,24 @@ private:
     // Flag, used for allocation from the global Heap for mutual exclusion.
     std::atomic_bool _fill_buffer_flag{false};
 
-    // List of all allocated chunks, they will be freed later.
+    // List of all allocated chunks.
     std::vector<Chunk> _allocated_chunks;
 
+    // Memory allocated from the global heap, the chunks are cut from; freed on destruction.
+    std::vector<void *> _heap_memories;
+
+    // Number of chunks allocated from the global heap and handed out to workers; read for statistics.
+    std::atomic_uint64_t _count_chunks{0U};
+    std::atomic_uint64_t _count_handed_out_chunks{0U};
+
+    /**
+     * @return Size of the memory allocated from the GlobalHeap to fill the buffer.
+     */
+    [[nodiscard]] static constexpr std::size_t heap_memory_size() noexcept
+    {
+        return std::size_t(Chunk::size()) * CHUNKS;
+    }
+
     /**
      * Allocates a very big chunk from the GlobalHeap and
      * splits it into smaller chunks to store them in the
@@ -201,7 +234,8 @@ private:
             }
         }
 
-        auto *heap_memory = GlobalHeap::allocate(_numa_node_id, Chunk::size() * _free_chunk_buffer.size());
+        auto *heap_memory = GlobalHeap::allocate(_numa_node_id, ProcessorHeap::heap_memory_size());
+        _heap_memories.push_back(heap_memory);
         auto heap_memory_address = reinterpret_cast<std::uintptr_t>(heap_memory);
         for (auto i = 0U; i < _free_chunk_buffer.size(); ++i)
         {
@@ -211,6 +245,7 @@ private:
             reinterpret_cast<char *>(_free_chunk_buffer[i].operator void *())[0] = '\0';
         }
 
+        _count_chunks.fetch_add(_free_chunk_buffer.size(), std::memory_order_relaxed);
         _next_free_chunk.store(0U);
     }
 };
@@ -369,6 +404,20 @@ public:
         return tags;
     }
 
+    [[nodiscard]] std::vector<AllocatorStatistics> statistics() const override
+    {
+        auto statistics = std::vector<AllocatorStatistics>{};
+        for (const auto &processor_heap : _processor_heaps)
+        {
+            if (processor_heap.numa_node_id() != std::numeric_limits<std::uint8_t>::max())
+            {
+                statistics.emplace_back(processor_heap.statistics());
+            }
+        }
+
+        return statistics;
+    }
+
 private:
     // Heap for every processor socket/NUMA region.
     std::array<ProcessorHeap, config::max_numa_nodes()> _processor_heaps;
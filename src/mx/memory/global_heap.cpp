@@ -0,0 +1,116 @@
+#include "global_heap.h"
+#include <mutex>
+#include <numaif.h>
+#include <sys/mman.h>
+#include <unordered_set>
+
+using namespace mx::memory;
+
+namespace {
+/// Mappings of allocate_huge() that could not be advised for transparent huge pages;
+/// they do not count as huge page backed when they are freed.
+std::mutex regular_mappings_lock;
+std::unordered_set<std::uintptr_t> regular_mappings;
+} // namespace
+
+void *GlobalHeap::allocate_huge(const std::uint8_t numa_node_id, const std::size_t size)
+{
+    constexpr auto transparent_page_size = std::size_t(1U) << 21U;
+
+    const auto page_size = GlobalHeap::huge_page_size(size);
+    const auto mapped_size = alignment_helper::next_multiple(size, page_size);
+
+    if constexpr (config::huge_pages() == config::huge_page_backing::Explicit2MB ||
+                  config::huge_pages() == config::huge_page_backing::Explicit1GB)
+    {
+        /// The page size is encoded as log2 in the flags.
+        const auto page_size_flag = (page_size == transparent_page_size ? 21 : 30) << MAP_HUGE_SHIFT;
+        auto *memory = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | page_size_flag, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            numa_tonode_memory(memory, mapped_size, numa_node_id);
+            _count_explicit_allocations.fetch_add(1U, std::memory_order_relaxed);
+            _huge_page_bytes.fetch_add(mapped_size, std::memory_order_relaxed);
+            return memory;
+        }
+
+        /// No (or not enough) huge pages reserved.
+        _count_fallbacks.fetch_add(1U, std::memory_order_relaxed);
+    }
+
+    /// Transparent huge pages need memory aligned to the huge page size:
+    /// Map more than needed and cut the unaligned head and tail.
+    const auto over_mapped_size = mapped_size + transparent_page_size;
+    auto *mapping = ::mmap(nullptr, over_mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) [[unlikely]]
+    {
+        return nullptr;
+    }
+
+    const auto begin = std::uintptr_t(mapping);
+    const auto aligned_begin = alignment_helper::next_multiple(begin, std::uintptr_t(transparent_page_size));
+    const auto end = begin + over_mapped_size;
+    const auto aligned_end = aligned_begin + mapped_size;
+    if (aligned_begin > begin)
+    {
+        ::munmap(mapping, aligned_begin - begin);
+    }
+    if (end > aligned_end)
+    {
+        ::munmap(reinterpret_cast<void *>(aligned_end), end - aligned_end);
+    }
+
+    auto *memory = reinterpret_cast<void *>(aligned_begin);
+    if (::madvise(memory, mapped_size, MADV_HUGEPAGE) == 0) [[likely]]
+    {
+        _count_transparent_allocations.fetch_add(1U, std::memory_order_relaxed);
+        _huge_page_bytes.fetch_add(mapped_size, std::memory_order_relaxed);
+    }
+    else
+    {
+        /// Transparent huge pages are not available; the mapping is backed by regular pages.
+        const auto lock = std::lock_guard{regular_mappings_lock};
+        regular_mappings.insert(aligned_begin);
+    }
+    numa_tonode_memory(memory, mapped_size, numa_node_id);
+
+    return memory;
+}
+
+void GlobalHeap::free_huge(void *memory, const std::size_t size)
+{
+    const auto mapped_size = alignment_helper::next_multiple(size, GlobalHeap::huge_page_size(size));
+
+    /// Forget the mapping before unmapping it; the address may be mapped again right after.
+    auto is_regular_mapping = false;
+    {
+        const auto lock = std::lock_guard{regular_mappings_lock};
+        is_regular_mapping = regular_mappings.erase(std::uintptr_t(memory)) > 0U;
+    }
+
+    if (::munmap(memory, mapped_size) == 0 && is_regular_mapping == false) [[likely]]
+    {
+        _huge_page_bytes.fetch_sub(mapped_size, std::memory_order_relaxed);
+    }
+}
+
+std::optional<std::uint8_t> GlobalHeap::numa_node_id(const void *memory) noexcept
+{
+    auto *address = const_cast<void *>(memory);
+
+    /// The policy of the mapping tells whether the pages are spread over all nodes.
+    auto policy = 0;
+    if (::get_mempolicy(&policy, nullptr, 0U, address, MPOL_F_ADDR) != 0 || policy == MPOL_INTERLEAVE)
+    {
+        return std::nullopt;
+    }
+
+    auto numa_node_id = 0;
+    if (::get_mempolicy(&numa_node_id, nullptr, 0U, address, MPOL_F_NODE | MPOL_F_ADDR) != 0 || numa_node_id < 0)
+    {
+        return std::nullopt;
+    }
+
+    return std::uint8_t(numa_node_id);
+}
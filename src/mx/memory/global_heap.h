@@ -1,13 +1,38 @@
 #pragma once
 #include "alignment_helper.h"
+#include "config.h"
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <mx/system/cache.h>
 #include <numa.h>
+#include <optional>
 
 namespace mx::memory {
+/**
+ * Number of allocations from the global heap that are backed by huge pages.
+ */
+class HugePageStatistics
+{
+public:
+    /// Allocations mapped with explicit huge pages (MAP_HUGETLB).
+    std::uint64_t explicit_allocations{0U};
+
+    /// Allocations advised for transparent huge pages.
+    std::uint64_t transparent_allocations{0U};
+
+    /// Allocations that could not be mapped with explicit huge pages.
+    std::uint64_t fallbacks{0U};
+
+    /// Bytes currently mapped for huge page backing (either explicit or advised for transparent huge pages).
+    /// Freed mappings are subtracted.
+    std::uint64_t bytes{0U};
+};
+
 /**
  * The global heap represents the heap, provided by the OS.
+ * Allocations of at least config::huge_page_threshold() are
+ * backed by huge pages, see config::huge_pages().
  */
 class GlobalHeap
 {
@@ -21,9 +46,34 @@ public:
      */
     static void *allocate(const std::uint8_t numa_node_id, const std::size_t size)
     {
+        if constexpr (config::huge_pages() != config::huge_page_backing::None)
+        {
+            if (size >= config::huge_page_threshold())
+            {
+                return GlobalHeap::allocate_huge(numa_node_id, size);
+            }
+        }
+
         return numa_alloc_onnode(size, numa_node_id);
     }
 
+    /**
+     * Allocates the given size with pages interleaved over all NUMA nodes
+     * (e.g., for data that is read by workers of every node).
+     *
+     * @param size Size of the memory to be allocated.
+     * @return Pointer to allocated memory.
+     */
+    static void *allocate_interleaved(const std::size_t size) { return numa_alloc_interleaved(size); }
+
+    /**
+     * Frees memory allocated by allocate_interleaved().
+     *
+     * @param memory Pointer to memory.
+     * @param size Size of the allocated memory.
+     */
+    static void free_interleaved(void *memory, const std::size_t size) { numa_free(memory, size); }
+
     /**
      * Allocates the given memory aligned to the cache line
      * with a multiple of the alignment as a size.
@@ -42,6 +92,80 @@ public:
      * @param memory Pointer to memory.
      * @param size Size of the allocated object.
      */
-    static void free(void *memory, const std::size_t size) { numa_free(memory, size); }
+    static void free(void *memory, const std::size_t size)
+    {
+        if constexpr (config::huge_pages() != config::huge_page_backing::None)
+        {
+            if (size >= config::huge_page_threshold())
+            {
+                GlobalHeap::free_huge(memory, size);
+                return;
+            }
+        }
+
+        numa_free(memory, size);
+    }
+
+    /**
+     * Looks up the NUMA node the page of the given memory is placed on.
+     * Memory interleaved over all nodes (see allocate_interleaved()) has no home node.
+     *
+     * @param memory Pointer to (allocated) memory.
+     * @return Id of the NUMA node the memory is placed on, if the memory has a home node.
+     */
+    [[nodiscard]] static std::optional<std::uint8_t> numa_node_id(const void *memory) noexcept;
+
+    /**
+     * @return Number of allocations backed by huge pages since the start of the process.
+     */
+    [[nodiscard]] static HugePageStatistics huge_page_statistics() noexcept
+    {
+        auto statistics = HugePageStatistics{};
+        statistics.explicit_allocations = _count_explicit_allocations.load(std::memory_order_relaxed);
+        statistics.transparent_allocations = _count_transparent_allocations.load(std::memory_order_relaxed);
+        statistics.fallbacks = _count_fallbacks.load(std::memory_order_relaxed);
+        statistics.bytes = _huge_page_bytes.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+private:
+    inline static std::atomic_uint64_t _count_explicit_allocations{0U};
+    inline static std::atomic_uint64_t _count_transparent_allocations{0U};
+    inline static std::atomic_uint64_t _count_fallbacks{0U};
+    inline static std::atomic_uint64_t _huge_page_bytes{0U};
+
+    /**
+     * @param size Size of an allocation.
+     * @return Size of the huge pages backing the allocation.
+     */
+    [[nodiscard]] static constexpr std::size_t huge_page_size(const std::size_t size) noexcept
+    {
+        if constexpr (config::huge_pages() == config::huge_page_backing::Explicit1GB)
+        {
+            if (size >= (std::size_t(1U) << 30U))
+            {
+                return std::size_t(1U) << 30U;
+            }
+        }
+
+        return std::size_t(1U) << 21U;
+    }
+
+    /**
+     * Maps the memory with huge pages and binds it to the given NUMA node.
+     *
+     * @param numa_node_id ID of the NUMA node, the memory should allocated on.
+     * @param size Size of the memory to be allocated.
+     * @return Pointer to allocated memory (nullptr, if the memory could not be mapped).
+     */
+    static void *allocate_huge(std::uint8_t numa_node_id, std::size_t size);
+
+    /**
+     * Unmaps memory allocated by allocate_huge().
+     *
+     * @param memory Pointer to memory.
+     * @param size Size of the allocated memory.
+     */
+    static void free_huge(void *memory, std::size_t size);
 };
-} // namespace mx::memory
\ No newline at end of file
+} // namespace mx::memory
@@ -0,0 +1,70 @@
+#pragma once
+#include "global_heap.h"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+namespace mx::memory {
+/**
+ * Direct mapped cache for the NUMA node memory pages are placed on,
+ * avoiding a system call (see GlobalHeap::numa_node_id()) for every lookup.
+ * Entries are not invalidated when memory is freed; the node is meant as a
+ * hint (e.g., to dispatch tasks to the node of their data).
+ * The cache is not thread-safe, every worker owns a cache.
+ */
+class NumaNodeCache
+{
+public:
+    /// Number of cached pages.
+    inline static constexpr auto CAPACITY = 1024U;
+
+    /// Granularity of the cached placement.
+    inline static constexpr auto PAGE_SIZE = 4096U;
+
+    NumaNodeCache() noexcept = default;
+    ~NumaNodeCache() noexcept = default;
+
+    /**
+     * Looks up the NUMA node the given memory is placed on.
+     *
+     * @param memory Pointer to (allocated) memory.
+     * @return Id of the NUMA node, if the memory has a home node (interleaved memory has not).
+     */
+    [[nodiscard]] std::optional<std::uint8_t> lookup(const void *memory) noexcept
+    {
+        const auto page = std::uintptr_t(memory) / PAGE_SIZE;
+        auto &entry = _entries[page % CAPACITY];
+        if (entry.page != page)
+        {
+            const auto numa_node_id = GlobalHeap::numa_node_id(memory);
+            entry.page = page;
+            entry.numa_node_id = numa_node_id.has_value() ? std::int16_t(numa_node_id.value()) : -1;
+        }
+
+        if (entry.numa_node_id < 0)
+        {
+            return std::nullopt;
+        }
+
+        return std::uint8_t(entry.numa_node_id);
+    }
+
+    /**
+     * Drops all cached pages, e.g., after memory was migrated to another node.
+     */
+    void clear() noexcept { _entries.fill(Entry{}); }
+
+private:
+    struct Entry
+    {
+        // Number of the cached page.
+        std::uintptr_t page{std::numeric_limits<std::uintptr_t>::max()};
+
+        // NUMA node of the page, negative if the page has no home node.
+        std::int16_t numa_node_id{-1};
+    };
+
+    std::array<Entry, CAPACITY> _entries;
+};
+} // namespace mx::memory
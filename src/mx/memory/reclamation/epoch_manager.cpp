@@ -55,6 +55,7 @@ void EpochManager::reclaim_epoch_garbage() noexcept
     // and therefore have to be scheduled to the next one.
     queue::List<resource::ResourceInterface> deferred_resources{};
 
+    auto count_reclaimed = std::uint64_t(0U);
     resource::ResourceInterface *resource;
     while ((resource = reinterpret_cast<resource::ResourceInterface *>(this->_global_garbage_queue.pop_front())) !=
            nullptr)
@@ -63,12 +64,14 @@ void EpochManager::reclaim_epoch_garbage() noexcept
         {
             resource->on_reclaim();
             this->_allocator.free(static_cast<void *>(resource));
+            ++count_reclaimed;
         }
         else
         {
             deferred_resources.push_back(resource);
         }
     }
+    this->count_reclaimed(count_reclaimed);
 
     // Resources that could not be deleted physically
     // need to be deleted in next epochs.
@@ -78,8 +81,49 @@ void EpochManager::reclaim_epoch_garbage() noexcept
     }
 }
 
+void EpochManager::reclaim_limbo_list(const std::uint16_t worker_id) noexcept
+{
+    // Once all workers entered the current epoch, each of them passed a
+    // quiescent state since the epoch began: Enter the next epoch.
+    // Resources retired in the current epoch will be reclaimed, when
+    // all workers entered the next one.
+    auto global_epoch = this->_global_epoch.load(std::memory_order_seq_cst);
+    const auto min_epoch = this->min_local_epoch();
+    if (min_epoch >= global_epoch)
+    {
+        this->_global_epoch.compare_exchange_strong(global_epoch, global_epoch + 1U);
+    }
+
+    // Items logically removed in an epoch less than
+    // this epoch can be removed physically.
+    auto [resource, count] = this->_limbo_lists[worker_id].pop_front(min_epoch);
+    while (resource != nullptr)
+    {
+        auto *next = resource->next();
+        resource->on_reclaim();
+        this->_allocator.free(worker_id, static_cast<void *>(resource));
+        resource = next;
+    }
+    this->count_reclaimed(count);
+}
+
 void EpochManager::reclaim_all() noexcept
 {
+    for (auto worker_id = 0U; worker_id < this->_count_channels; ++worker_id)
+    {
+        auto count_reclaimed = std::uint64_t(0U);
+        auto *resource = this->_limbo_lists[worker_id].pop_all();
+        while (resource != nullptr)
+        {
+            auto *next = resource->next();
+            resource->on_reclaim();
+            this->_allocator.free(static_cast<void *>(resource));
+            resource = next;
+            ++count_reclaimed;
+        }
+        this->count_reclaimed(count_reclaimed);
+    }
+
     if constexpr (config::local_garbage_collection())
     {
         for (auto worker_id = 0U; worker_id < this->_count_channels; ++worker_id)
@@ -90,6 +134,7 @@ void EpochManager::reclaim_all() noexcept
             {
                 resource->on_reclaim();
                 this->_allocator.free(static_cast<void *>(resource));
+                this->count_reclaimed(1U);
             }
         }
     }
@@ -101,6 +146,7 @@ void EpochManager::reclaim_all() noexcept
         {
             resource->on_reclaim();
             this->_allocator.free(static_cast<void *>(resource));
+            this->count_reclaimed(1U);
         }
     }
 }
@@ -130,6 +176,7 @@ mx::tasking::TaskResult ReclaimEpochGarbageTask::execute(const std::uint16_t wor
     // Queue with channel-local garbage.
     auto &garbage_queue = this->_epoch_manager.local_garbage(worker_id);
 
+    auto count_reclaimed = std::uint64_t(0U);
     resource::ResourceInterface *resource;
     while ((resource = reinterpret_cast<resource::ResourceInterface *>(garbage_queue.pop_front())) != nullptr)
     {
@@ -137,12 +184,14 @@ mx::tasking::TaskResult ReclaimEpochGarbageTask::execute(const std::uint16_t wor
         {
             resource->on_reclaim();
             this->_allocator.free(static_cast<void *>(resource));
+            ++count_reclaimed;
         }
         else
         {
             deferred_resources.push_back(resource);
         }
     }
+    this->_epoch_manager.count_reclaimed(count_reclaimed);
 
     // Resources that could not be deleted physically
     // need to be deleted in next epochs.
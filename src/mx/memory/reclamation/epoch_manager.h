@@ -16,6 +16,7 @@
 #include <mx/util/core_set.h>
 #include <mx/util/maybe_atomic.h>
 #include <thread>
+#include <utility>
 
 namespace mx::memory::reclamation {
 class alignas(64) LocalEpoch
@@ -42,6 +43,105 @@ private:
     std::atomic<epoch_t> _epoch{std::numeric_limits<epoch_t>::max()};
 };
 
+/**
+ * Resources retired by a single worker that wait for reclamation
+ * (quiescent-state-based reclamation). Only the owning worker
+ * accesses the list.
+ */
+class alignas(64) LimboList
+{
+public:
+    LimboList() noexcept = default;
+    ~LimboList() noexcept = default;
+
+    void push_back(resource::ResourceInterface *resource) noexcept
+    {
+        resource->next(nullptr);
+        if (_tail != nullptr) [[likely]]
+        {
+            _tail->next(resource);
+        }
+        else
+        {
+            _head = resource;
+        }
+        _tail = resource;
+
+        ++_size;
+    }
+
+    /**
+     * Removes the resources retired before the given epoch. Resources are
+     * retired in order of the (monotonic) global epoch; thus, the removal
+     * stops at the first resource that is retired at or after the epoch.
+     *
+     * @param min_epoch Minimal epoch of all workers.
+     * @return Concatenated resources that can be reclaimed (terminated by nullptr) and their number.
+     */
+    [[nodiscard]] std::pair<resource::ResourceInterface *, std::uint64_t> pop_front(const epoch_t min_epoch) noexcept
+    {
+        auto *first = _head;
+        auto *last = static_cast<resource::ResourceInterface *>(nullptr);
+        auto count = std::uint64_t(0U);
+        for (auto *resource = _head; resource != nullptr && resource->remove_epoch() < min_epoch;
+             resource = resource->next())
+        {
+            last = resource;
+            ++count;
+        }
+
+        if (count == 0U)
+        {
+            return std::make_pair(nullptr, 0U);
+        }
+
+        _head = last->next();
+        if (_head == nullptr)
+        {
+            _tail = nullptr;
+        }
+        last->next(nullptr);
+
+        _size -= count;
+        return std::make_pair(first, count);
+    }
+
+    /**
+     * @return All resources, concatenated (terminated by nullptr).
+     */
+    [[nodiscard]] resource::ResourceInterface *pop_all() noexcept
+    {
+        _tail = nullptr;
+        _size = 0U;
+        return std::exchange(_head, nullptr);
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return _head == nullptr; }
+    [[nodiscard]] std::uint64_t size() const noexcept { return _size; }
+    [[nodiscard]] bool is_full() const noexcept { return _size >= config::max_limbo_list_size(); }
+
+    /**
+     * Counts the quiescent states of the worker.
+     *
+     * @return True, if the worker should try to reclaim the list.
+     */
+    [[nodiscard]] bool is_reclamation_due() noexcept
+    {
+        return ++_count_quiescent_states % config::quiescent_states_per_reclamation() == 0U || is_full();
+    }
+
+private:
+    /// Retired resources in order of retirement.
+    resource::ResourceInterface *_head{nullptr};
+    resource::ResourceInterface *_tail{nullptr};
+
+    /// Number of retired resources.
+    std::uint64_t _size{0U};
+
+    /// Quiescent states of the worker.
+    std::uint64_t _count_quiescent_states{0U};
+};
+
 /**
  * The Epoch Manager manages periodic epochs which
  * are used to protect reads against concurrent
@@ -54,6 +154,15 @@ private:
  * the resource will be deleted physically, when
  * every local epoch is greater than the epoch
  * when the resource is deleted.
+ *
+ * With quiescent-state-based reclamation (QSBR), no
+ * thread drives the epochs: Every worker announces a
+ * quiescent state (holding no reference to any resource)
+ * by entering the global epoch whenever it refills its
+ * task buffer. Workers retire resources into a limbo list
+ * of their own and reclaim that list from time to time;
+ * the global epoch is advanced by reclaiming workers once
+ * all workers have entered the current one.
  */
 class EpochManager
 {
@@ -97,6 +206,7 @@ public:
                                    [[maybe_unused]] const std::uint16_t owning_worker_id) noexcept
     {
         resource->remove_epoch(_global_epoch.load(std::memory_order_acq_rel));
+        count_retired(1U);
 
         if constexpr (config::local_garbage_collection())
         {
@@ -108,6 +218,53 @@ public:
         }
     }
 
+    /**
+     * Adds an optimistic resource to the limbo list of the calling worker (QSBR).
+     * Resources retired by threads that are no workers are reclaimed when the
+     * runtime stops.
+     *
+     * @param resource Resource to logically delete.
+     * @param calling_worker_id Worker that retires the resource.
+     */
+    void add_to_limbo_list(resource::ResourceInterface *resource, const std::uint16_t calling_worker_id) noexcept
+    {
+        if (calling_worker_id >= _count_channels) [[unlikely]]
+        {
+            add_to_garbage_collection(resource, calling_worker_id);
+            return;
+        }
+
+        resource->remove_epoch(_global_epoch.load(std::memory_order_seq_cst));
+        count_retired(1U);
+
+        auto &limbo_list = _limbo_lists[calling_worker_id];
+        limbo_list.push_back(resource);
+
+        /// Reclaiming is safe at any time, only announcing quiescent states is not.
+        if (limbo_list.is_full()) [[unlikely]]
+        {
+            reclaim_limbo_list(calling_worker_id);
+        }
+    }
+
+    /**
+     * Announces a quiescent state of the given worker (QSBR): The worker holds
+     * no reference to any optimistic resource. From time to time, the worker
+     * reclaims its limbo list.
+     *
+     * @param worker_id Worker that passed a quiescent state.
+     */
+    void quiescent(const std::uint16_t worker_id) noexcept
+    {
+        _local_epochs[worker_id].enter(_global_epoch);
+
+        auto &limbo_list = _limbo_lists[worker_id];
+        if (limbo_list.empty() == false && limbo_list.is_reclamation_due())
+        {
+            reclaim_limbo_list(worker_id);
+        }
+    }
+
     /**
      * Called periodically by a separate thread.
      */
@@ -129,12 +286,35 @@ public:
         return _local_garbage_queues[worker_id].value();
     }
 
+    /**
+     * Accounts resources that were reclaimed physically.
+     *
+     * @param count Number of reclaimed resources.
+     */
+    void count_reclaimed(const std::uint64_t count) noexcept
+    {
+        _count_garbage.fetch_sub(count, std::memory_order_relaxed);
+    }
+
     /**
      * Reset all local and the global epoch to initial values
      * if no memory is in use.
      */
     void reset() noexcept;
 
+    /**
+     * @return Number of retired resources that are not reclaimed yet.
+     */
+    [[nodiscard]] std::uint64_t count_garbage() const noexcept
+    {
+        return _count_garbage.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Maximal number of retired resources that were not reclaimed at a time.
+     */
+    [[nodiscard]] std::uint64_t peak_garbage() const noexcept { return _peak_garbage.load(std::memory_order_relaxed); }
+
 private:
     // Number of used channels; important for min-calculation.
     const std::uint16_t _count_channels;
@@ -159,10 +339,35 @@ private:
     alignas(64) std::array<util::aligned_t<queue::MPSC<resource::ResourceInterface>>,
                            tasking::config::max_cores()> _local_garbage_queues;
 
+    // Resources retired by every worker, when using quiescent-state-based reclamation.
+    std::array<LimboList, tasking::config::max_cores()> _limbo_lists;
+
+    // Retired and not reclaimed resources (now and at most).
+    alignas(64) std::atomic_uint64_t _count_garbage{0U};
+    std::atomic_uint64_t _peak_garbage{0U};
+
     /**
      * Reclaims resources with regard to the epoch.
      */
     void reclaim_epoch_garbage() noexcept;
+
+    /**
+     * Reclaims the resources of the limbo list that are retired before all
+     * workers passed a quiescent state. Advances the global epoch, when all
+     * workers entered the current one.
+     *
+     * @param worker_id Worker owning the limbo list.
+     */
+    void reclaim_limbo_list(std::uint16_t worker_id) noexcept;
+
+    void count_retired(const std::uint64_t count) noexcept
+    {
+        const auto garbage = _count_garbage.fetch_add(count, std::memory_order_relaxed) + count;
+        auto peak = _peak_garbage.load(std::memory_order_relaxed);
+        while (garbage > peak && _peak_garbage.compare_exchange_weak(peak, garbage, std::memory_order_relaxed) == false)
+        {
+        }
+    }
 };
 
 class ReclaimEpochGarbageTask final : public tasking::TaskInterface
@@ -0,0 +1,58 @@
+#include "slab_allocator.h"
+#include "global_heap.h"
+
+using namespace mx::memory::slab;
+
+void *WorkerArena::allocate_slab(SizeClass &size_class)
+{
+    const auto size = size_class.next_slab_size();
+    auto *slab = this->allocate_slab(this->_numa_node_id, size);
+    if (slab == nullptr) [[unlikely]]
+    {
+        return nullptr;
+    }
+
+    size_class.refill(slab, size);
+
+    return size_class.allocate();
+}
+
+void *WorkerArena::allocate_slab(const std::uint8_t numa_node_id, const std::size_t size)
+{
+    auto *slab = GlobalHeap::allocate(numa_node_id, size);
+    if (slab == nullptr) [[unlikely]]
+    {
+        return nullptr;
+    }
+
+    this->_slabs.emplace_back(slab, size);
+    if (this->_budget != nullptr)
+    {
+        this->_budget->charge(size);
+    }
+    this->_allocated_bytes.store(this->_allocated_bytes.load(std::memory_order_relaxed) + size,
+                                 std::memory_order_relaxed);
+
+    return slab;
+}
+
+void WorkerArena::release() noexcept
+{
+    for (const auto [slab, size] : this->_slabs)
+    {
+        GlobalHeap::free(slab, size);
+        if (this->_budget != nullptr)
+        {
+            this->_budget->release(size);
+        }
+    }
+
+    this->_slabs.clear();
+    this->_next_block = 0U;
+    this->_blocks_end = 0U;
+    this->_allocated_bytes.store(0U, std::memory_order_relaxed);
+
+    /// Objects of the size classes pointed into the released slabs.
+    std::fill(this->_size_classes.begin(), this->_size_classes.begin() + this->_count_size_classes, SizeClass{});
+    this->_count_size_classes = 0U;
+}
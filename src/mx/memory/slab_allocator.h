@@ -0,0 +1,393 @@
+#pragma once
+
+#include "alignment_helper.h"
+#include "budget.h"
+#include "config.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mx/system/cache.h>
+#include <utility>
+#include <vector>
+
+namespace mx::memory::slab {
+/**
+ * Represents a free object within a slab.
+ */
+class FreeHeader
+{
+public:
+    constexpr FreeHeader() noexcept = default;
+    ~FreeHeader() noexcept = default;
+
+    [[nodiscard]] FreeHeader *next() const noexcept { return _next; }
+    void next(FreeHeader *next) noexcept { _next = next; }
+
+private:
+    FreeHeader *_next{nullptr};
+};
+
+/**
+ * Objects of the same size. Freed objects are recycled (LIFO) before
+ * the rest of the latest slab is used.
+ */
+class SizeClass
+{
+public:
+    constexpr SizeClass() noexcept = default;
+    explicit constexpr SizeClass(const std::size_t object_size) noexcept : _object_size(object_size) {}
+    ~SizeClass() noexcept = default;
+
+    [[nodiscard]] std::size_t object_size() const noexcept { return _object_size; }
+
+    /**
+     * @return A free object of the size class or nullptr, if a new slab is needed.
+     */
+    [[nodiscard]] void *allocate() noexcept
+    {
+        if (_first_free != nullptr)
+        {
+            return static_cast<void *>(std::exchange(_first_free, _first_free->next()));
+        }
+
+        if (_next_object + _object_size <= _slab_end)
+        {
+            return reinterpret_cast<void *>(std::exchange(_next_object, _next_object + _object_size));
+        }
+
+        return nullptr;
+    }
+
+    void free(void *pointer) noexcept
+    {
+        auto *free_object = static_cast<FreeHeader *>(pointer);
+        free_object->next(_first_free);
+        _first_free = free_object;
+    }
+
+    /**
+     * @return Size of the next slab; slabs double in size up to config::max_slab_size().
+     */
+    [[nodiscard]] std::size_t next_slab_size() const noexcept
+    {
+        return std::max(std::min(_object_size * _count_slab_objects, config::max_slab_size()), _object_size);
+    }
+
+    /**
+     * Uses the given slab for the following allocations.
+     *
+     * @param slab Memory of the slab.
+     * @param size Size of the slab.
+     */
+    void refill(void *slab, const std::size_t size) noexcept
+    {
+        _next_object = reinterpret_cast<std::uintptr_t>(slab);
+        _slab_end = _next_object + size;
+        _count_slab_objects *= 2U;
+    }
+
+private:
+    /// Size of every object, a multiple of the cache line size.
+    std::size_t _object_size{0U};
+
+    /// List of freed objects.
+    FreeHeader *_first_free{nullptr};
+
+    /// Unused memory of the latest slab.
+    std::uintptr_t _next_object{0U};
+    std::uintptr_t _slab_end{0U};
+
+    /// Number of objects of the next slab.
+    std::size_t _count_slab_objects{config::min_slab_objects()};
+};
+
+/**
+ * Slabs of a single worker within an arena. Only the owning
+ * worker allocates and frees, thus, allocation is latch-free.
+ */
+class alignas(64) WorkerArena
+{
+public:
+    WorkerArena() noexcept = default;
+    ~WorkerArena() noexcept { release(); }
+
+    void numa_node_id(const std::uint8_t numa_node_id) noexcept { _numa_node_id = numa_node_id; }
+    void budget(Budget *budget) noexcept { _budget = budget; }
+
+    /**
+     * Allocates an object of the given size.
+     *
+     * @param size Size of the object, a multiple of the cache line size.
+     * @return Pointer to the object or nullptr, if the worker exceeded config::max_slab_size_classes()
+     *  or the global heap ran out of memory.
+     */
+    [[nodiscard]] void *allocate(const std::size_t size)
+    {
+        auto *size_class = this->size_class(size);
+        if (size_class == nullptr) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        if (auto *object = size_class->allocate(); object != nullptr) [[likely]]
+        {
+            return object;
+        }
+
+        return this->allocate_slab(*size_class);
+    }
+
+    /**
+     * Recycles an object, that may be allocated by any worker of the arena.
+     *
+     * @param pointer Pointer to the object.
+     * @param size Size of the object, a multiple of the cache line size.
+     */
+    void free(void *pointer, const std::size_t size) noexcept
+    {
+        /// Objects of unknown size classes are released with the arena.
+        if (auto *size_class = this->size_class(size); size_class != nullptr) [[likely]]
+        {
+            size_class->free(pointer);
+        }
+    }
+
+    /**
+     * Allocates a block that is not recycled but released with the arena
+     * (e.g., hash tables or other execution state of a query). Small blocks
+     * are carved from a shared slab, large blocks get a slab of their own.
+     *
+     * @param numa_node_id NUMA node to allocate the block on.
+     * @param size Size of the block, a multiple of the cache line size.
+     * @return Pointer to the block or nullptr, if the global heap ran out of memory.
+     */
+    [[nodiscard]] void *allocate_block(const std::uint8_t numa_node_id, const std::size_t size)
+    {
+        if (numa_node_id == _numa_node_id && size <= WorkerArena::max_shared_block_size()) [[likely]]
+        {
+            if (_next_block + size > _blocks_end) [[unlikely]]
+            {
+                auto *slab = this->allocate_slab(numa_node_id, config::max_slab_size());
+                if (slab == nullptr) [[unlikely]]
+                {
+                    return nullptr;
+                }
+                _next_block = reinterpret_cast<std::uintptr_t>(slab);
+                _blocks_end = _next_block + config::max_slab_size();
+            }
+
+            return reinterpret_cast<void *>(std::exchange(_next_block, _next_block + size));
+        }
+
+        return this->allocate_slab(numa_node_id, size);
+    }
+
+    /**
+     * Returns all slabs to the global heap.
+     */
+    void release() noexcept;
+
+    /**
+     * @return Size of all slabs allocated by the worker.
+     */
+    [[nodiscard]] std::uint64_t allocated_bytes() const noexcept
+    {
+        return _allocated_bytes.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// NUMA node of the worker, slabs are allocated on.
+    std::uint8_t _numa_node_id{0U};
+
+    /// Budget of the arena, every slab is charged to.
+    Budget *_budget{nullptr};
+
+    /// Number of used size classes.
+    std::uint8_t _count_size_classes{0U};
+
+    /// Size classes, few per query (one per schema of intermediate results).
+    std::array<SizeClass, config::max_slab_size_classes()> _size_classes;
+
+    /// Unused memory of the latest slab for blocks.
+    std::uintptr_t _next_block{0U};
+    std::uintptr_t _blocks_end{0U};
+
+    /// Allocated slabs and their sizes.
+    std::vector<std::pair<void *, std::size_t>> _slabs;
+
+    /// Size of all slabs; read by other threads for statistics.
+    std::atomic_uint64_t _allocated_bytes{0U};
+
+    /**
+     * Finds the size class of the given object size or adds one, if there is space left.
+     *
+     * @param size Size of the object.
+     * @return The size class or nullptr.
+     */
+    [[nodiscard]] SizeClass *size_class(const std::size_t size) noexcept
+    {
+        for (auto index = 0U; index < _count_size_classes; ++index)
+        {
+            if (_size_classes[index].object_size() == size) [[likely]]
+            {
+                return &_size_classes[index];
+            }
+        }
+
+        if (_count_size_classes < _size_classes.size())
+        {
+            _size_classes[_count_size_classes] = SizeClass{size};
+            return &_size_classes[_count_size_classes++];
+        }
+
+        return nullptr;
+    }
+
+    /// Larger blocks get a slab of their own.
+    [[nodiscard]] static constexpr std::size_t max_shared_block_size() { return config::max_slab_size() / 4U; }
+
+    /**
+     * Allocates a new slab from the global heap and an object from that slab.
+     *
+     * @param size_class Size class that ran out of memory.
+     * @return Pointer to the object or nullptr, if the global heap ran out of memory.
+     */
+    [[nodiscard]] void *allocate_slab(SizeClass &size_class);
+
+    /**
+     * Allocates a new slab from the global heap.
+     *
+     * @param numa_node_id NUMA node to allocate the slab on.
+     * @param size Size of the slab.
+     * @return Pointer to the slab or nullptr, if the global heap ran out of memory.
+     */
+    [[nodiscard]] void *allocate_slab(std::uint8_t numa_node_id, std::size_t size);
+};
+
+/**
+ * The arena hands out objects of a few sizes (e.g., temporary tiles of a query)
+ * from worker-local slabs, avoiding the free lists and coalescing of the dynamic
+ * allocator. Freed objects are recycled by the freeing worker. Besides, the arena
+ * hands out blocks of any size (e.g., hash tables of a query) that are never
+ * freed individually. All slabs are returned to the global heap at once when the
+ * arena is destroyed, objects that are still alive do not need to be freed one by
+ * one. The size of all slabs is the memory held by the owner of the arena.
+ *
+ * Threads that are not workers of the arena can neither allocate (nullptr) nor
+ * recycle (the object stays in its slab until the arena is destroyed).
+ *
+ * Every slab is charged to the budget of the arena; owners may charge further
+ * memory that is allocated elsewhere on behalf of the owner.
+ */
+class Arena
+{
+public:
+    /**
+     * @param count_workers Number of workers allocating from the arena.
+     * @param numa_node_id Callback that returns the NUMA node id of a worker.
+     * @param memory_limit Limit of the budget in bytes; zero for no limit.
+     */
+    template <typename F>
+    Arena(const std::uint16_t count_workers, F &&numa_node_id, const std::uint64_t memory_limit = 0U)
+        : _count_workers(count_workers), _budget(memory_limit),
+          _worker_arenas(std::make_unique<WorkerArena[]>(count_workers))
+    {
+        for (auto worker_id = std::uint16_t(0U); worker_id < count_workers; ++worker_id)
+        {
+            _worker_arenas[worker_id].numa_node_id(numa_node_id(worker_id));
+            _worker_arenas[worker_id].budget(&_budget);
+        }
+    }
+
+    ~Arena() noexcept = default;
+
+    /**
+     * Allocates an object from the slabs of the given worker.
+     *
+     * @param worker_id Id of the calling worker.
+     * @param size Size of the object.
+     * @return Pointer to the (cache line aligned) object or nullptr, if the object can not be allocated
+     *  from the arena.
+     */
+    [[nodiscard]] void *allocate(const std::uint16_t worker_id, const std::size_t size)
+    {
+        if (worker_id >= _count_workers) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        return _worker_arenas[worker_id].allocate(Arena::object_size(size));
+    }
+
+    /**
+     * Allocates a block that lives until the arena is destroyed.
+     *
+     * @param worker_id Id of the calling worker.
+     * @param numa_node_id NUMA node to allocate the block on.
+     * @param size Size of the block.
+     * @return Pointer to the (cache line aligned) block or nullptr, if the calling thread is no worker of the arena
+     *  or the global heap ran out of memory.
+     */
+    [[nodiscard]] void *allocate_block(const std::uint16_t worker_id, const std::uint8_t numa_node_id,
+                                       const std::size_t size)
+    {
+        if (worker_id >= _count_workers) [[unlikely]]
+        {
+            return nullptr;
+        }
+
+        return _worker_arenas[worker_id].allocate_block(numa_node_id, Arena::object_size(size));
+    }
+
+    /**
+     * Recycles an object for following allocations of the given worker.
+     *
+     * @param worker_id Id of the calling worker.
+     * @param pointer Pointer to the object.
+     * @param size Size of the object, as allocated.
+     */
+    void free(const std::uint16_t worker_id, void *pointer, const std::size_t size) noexcept
+    {
+        if (worker_id < _count_workers) [[likely]]
+        {
+            _worker_arenas[worker_id].free(pointer, Arena::object_size(size));
+        }
+    }
+
+    /**
+     * @return Size of all slabs allocated by the arena.
+     */
+    [[nodiscard]] std::uint64_t allocated_bytes() const noexcept
+    {
+        auto bytes = std::uint64_t(0U);
+        for (auto worker_id = 0U; worker_id < _count_workers; ++worker_id)
+        {
+            bytes += _worker_arenas[worker_id].allocated_bytes();
+        }
+
+        return bytes;
+    }
+
+    /**
+     * @return Budget of the arena, charged with all slabs.
+     */
+    [[nodiscard]] Budget &budget() noexcept { return _budget; }
+    [[nodiscard]] const Budget &budget() const noexcept { return _budget; }
+
+private:
+    const std::uint16_t _count_workers;
+
+    /// Budget of all slabs; outlives the worker arenas that release their slabs.
+    Budget _budget;
+
+    /// Slabs of every worker.
+    std::unique_ptr<WorkerArena[]> _worker_arenas;
+
+    [[nodiscard]] static std::size_t object_size(const std::size_t size) noexcept
+    {
+        return alignment_helper::next_multiple(size, std::size_t(system::cache::line_size()));
+    }
+};
+} // namespace mx::memory::slab
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "allocator_statistics.h"
 #include <cstdint>
 #include <cstdlib>
 #include <mx/system/cache.h>
@@ -33,6 +34,11 @@ public:
 
     [[nodiscard]] virtual std::unordered_map<std::string, std::vector<std::pair<std::uintptr_t, std::uintptr_t>>>
     allocated_chunks() = 0;
+
+    /**
+     * @return Usage of the memory held by the allocator.
+     */
+    [[nodiscard]] virtual std::vector<AllocatorStatistics> statistics() const = 0;
 };
 
 /**
@@ -63,5 +69,7 @@ public:
     {
         return std::unordered_map<std::string, std::vector<std::pair<std::uintptr_t, std::uintptr_t>>>{};
     }
+
+    [[nodiscard]] std::vector<AllocatorStatistics> statistics() const override { return {}; }
 };
 } // namespace mx::memory
\ No newline at end of file
@@ -154,6 +154,14 @@ WorkerHeap::WorkerHeap(mx::memory::dynamic::local::WorkerHeap &&other) noexcept
         {
             this->_remote_free_lists[i].push_back(free_header);
         }
+
+        auto &usage = this->_usage[i];
+        const auto &other_usage = other._usage[i];
+        usage.allocated_bytes.store(other_usage.allocated_bytes.load());
+        usage.in_use_bytes.store(other_usage.in_use_bytes.load());
+        usage.count_blocks.store(other_usage.count_blocks.load());
+        usage.count_remote_frees.store(other_usage.count_remote_frees.load());
+        usage.largest_free_block.store(other_usage.largest_free_block.load());
     }
 }
 
@@ -166,7 +174,7 @@ void *WorkerHeap::allocate(const std::uint8_t numa_node_id, const std::size_t al
         auto *allocated_block = numa_blocks[i].allocate(this->_worker_id, numa_node_id, alignment, size);
         if (allocated_block != nullptr)
         {
-            return allocated_block;
+            return this->account(allocated_block);
         }
     }
 
@@ -178,20 +186,13 @@ void *WorkerHeap::allocate(const std::uint8_t numa_node_id, const std::size_t al
 
         const auto qualifies = header->size() >= size;
 
-        auto &index = this->_allocated_block_indices[header->numa_node_id()];
-        if (auto iterator = index.find(header->block_id()); iterator != index.end())
+        auto *block = this->refund(header);
+        if (block != nullptr && qualifies)
         {
-            auto &block = this->_allocated_blocks[header->numa_node_id()][iterator->second];
-            assert(block.id() == header->block_id());
-            block.refund(header);
-
-            if (qualifies)
+            auto *allocation = block->allocate(this->_worker_id, numa_node_id, alignment, size);
+            if (allocation != nullptr)
             {
-                auto *allocation = block.allocate(this->_worker_id, numa_node_id, alignment, size);
-                if (allocation != nullptr)
-                {
-                    return allocation;
-                }
+                return this->account(allocation);
             }
         }
     }
@@ -199,19 +200,55 @@ void *WorkerHeap::allocate(const std::uint8_t numa_node_id, const std::size_t al
     /// (3) Allocate a new block.
     const auto size_to_alloc_from_global_heap = std::max<std::size_t>(
         AllocatedBlock::DEFAULT_SIZE_IN_BYTES, alignment_helper::next_multiple(size + sizeof(AllocationHeader), 64UL));
-    auto *data = GlobalHeap::allocate(numa_node_id, size_to_alloc_from_global_heap);
-    auto &allocated_block = this->_allocated_blocks[numa_node_id].emplace_back(this->_next_block_id++,
-                                                                               size_to_alloc_from_global_heap, data);
+    auto &allocated_block = this->allocate_block(numa_node_id, size_to_alloc_from_global_heap);
+
+    return this->account(allocated_block.allocate(this->_worker_id, numa_node_id, alignment, size));
+}
+
+AllocatedBlock &WorkerHeap::allocate_block(const std::uint8_t numa_node_id, const std::size_t size)
+{
+    auto *data = GlobalHeap::allocate(numa_node_id, size);
+    auto &allocated_block = this->_allocated_blocks[numa_node_id].emplace_back(this->_next_block_id++, size, data);
 
     /// Update the index.
     this->_allocated_block_indices[numa_node_id].insert(
         std::make_pair(allocated_block.id(), this->_allocated_blocks[numa_node_id].size() - 1U));
 
-    return allocated_block.allocate(this->_worker_id, numa_node_id, alignment, size);
+    auto &usage = this->_usage[numa_node_id];
+    WorkerHeap::increase(usage.allocated_bytes, size);
+    WorkerHeap::increase(usage.count_blocks, 1U);
+    if (usage.largest_free_block.load(std::memory_order_relaxed) < size)
+    {
+        usage.largest_free_block.store(size, std::memory_order_relaxed);
+    }
+
+    return allocated_block;
+}
+
+AllocatedBlock *WorkerHeap::refund(FreeHeader *free_header)
+{
+    auto &usage = this->_usage[free_header->numa_node_id()];
+    usage.count_remote_frees.fetch_sub(1U, std::memory_order_relaxed);
+
+    auto &index = this->_allocated_block_indices[free_header->numa_node_id()];
+    if (auto iterator = index.find(free_header->block_id()); iterator != index.end())
+    {
+        WorkerHeap::decrease(usage.in_use_bytes, free_header->size());
+
+        auto &block = this->_allocated_blocks[free_header->numa_node_id()][iterator->second];
+        assert(block.id() == free_header->block_id());
+        block.refund(free_header);
+        return &block;
+    }
+
+    return nullptr;
 }
 
 void WorkerHeap::free(AllocationHeader *allocated_block)
 {
+    WorkerHeap::decrease(this->_usage[allocated_block->numa_node_id()].in_use_bytes,
+                         allocated_block->allocated_size());
+
     auto &index = this->_allocated_block_indices[allocated_block->numa_node_id()];
     if (auto iterator = index.find(allocated_block->block_id()); iterator != index.end())
     {
@@ -234,10 +271,19 @@ void WorkerHeap::release_free_memory()
 
         auto &index = this->_allocated_block_indices[numa_node_id];
         index.clear();
+        auto allocated_bytes = std::uint64_t(0U);
+        auto largest_free_block = std::uint64_t(0U);
         for (auto i = 0UL; i < allocated_blocks.size(); ++i)
         {
             index.insert(std::make_pair(allocated_blocks[i].id(), i));
+            allocated_bytes += allocated_blocks[i].size();
+            largest_free_block = std::max(largest_free_block, allocated_blocks[i].largest_free_size());
         }
+
+        auto &usage = this->_usage[numa_node_id];
+        usage.allocated_bytes.store(allocated_bytes, std::memory_order_relaxed);
+        usage.count_blocks.store(allocated_blocks.size(), std::memory_order_relaxed);
+        usage.largest_free_block.store(largest_free_block, std::memory_order_relaxed);
     }
 }
 
@@ -252,6 +298,14 @@ void WorkerHeap::release_all_memory()
     {
         index.clear();
     }
+
+    for (auto &usage : this->_usage)
+    {
+        usage.allocated_bytes.store(0U, std::memory_order_relaxed);
+        usage.in_use_bytes.store(0U, std::memory_order_relaxed);
+        usage.count_blocks.store(0U, std::memory_order_relaxed);
+        usage.largest_free_block.store(0U, std::memory_order_relaxed);
+    }
 }
 
 void WorkerHeap::refund_remote_freed_memory()
@@ -264,14 +318,7 @@ void WorkerHeap::refund_remote_freed_memory()
         while ((header = this->_remote_free_lists[nid].pop_front()) != nullptr)
         {
             header->next(nullptr);
-
-            auto &index = this->_allocated_block_indices[header->numa_node_id()];
-            if (auto iterator = index.find(header->block_id()); iterator != index.end())
-            {
-                auto &block = this->_allocated_blocks[header->numa_node_id()][iterator->second];
-                assert(block.id() == header->block_id());
-                block.refund(header);
-            }
+            std::ignore = this->refund(header);
         }
     }
 }
@@ -291,10 +338,7 @@ void WorkerHeap::initialize(const std::uint8_t numa_nodes)
             const auto size = AllocatedBlock::DEFAULT_SIZE_IN_BYTES *
                               (1U + (static_cast<std::uint8_t>(numa_node_id == this->_numa_node_id) * 3U));
 
-            auto *data = GlobalHeap::allocate(numa_node_id, size);
-            auto &block = this->_allocated_blocks[numa_node_id].emplace_back(this->_next_block_id++, size, data);
-
-            index.insert(std::make_pair(block.id(), this->_allocated_blocks[numa_node_id].size() - 1U));
+            std::ignore = this->allocate_block(std::uint8_t(numa_node_id), size);
         }
     }
 }
@@ -315,6 +359,23 @@ bool WorkerHeap::is_free() const noexcept
     return true;
 }
 
+mx::memory::AllocatorStatistics WorkerHeap::statistics(const std::uint8_t numa_node_id) const noexcept
+{
+    const auto &usage = this->_usage[numa_node_id];
+    const auto allocated_bytes = usage.allocated_bytes.load(std::memory_order_relaxed);
+    const auto in_use_bytes = std::min(usage.in_use_bytes.load(std::memory_order_relaxed), allocated_bytes);
+
+    auto statistics = AllocatorStatistics{"resources", this->_worker_id, numa_node_id};
+    statistics.in_use_bytes(in_use_bytes);
+    statistics.cached_bytes(allocated_bytes - in_use_bytes);
+    statistics.count_blocks(usage.count_blocks.load(std::memory_order_relaxed));
+    statistics.count_remote_frees(usage.count_remote_frees.load(std::memory_order_relaxed));
+    statistics.largest_free_block(
+        std::min(usage.largest_free_block.load(std::memory_order_relaxed), allocated_bytes - in_use_bytes));
+
+    return statistics;
+}
+
 Allocator::Allocator(const util::core_set &cores) : _count_workers(cores.count_cores())
 {
     this->_worker_local_heaps = reinterpret_cast<WorkerHeap *>(
@@ -431,3 +492,23 @@ bool Allocator::is_free() const noexcept
 
     return true;
 }
+
+std::vector<mx::memory::AllocatorStatistics> Allocator::statistics() const
+{
+    auto statistics = std::vector<AllocatorStatistics>{};
+    statistics.reserve(this->_count_workers * config::max_numa_nodes());
+
+    for (auto worker_id = 0U; worker_id < this->_count_workers; ++worker_id)
+    {
+        for (auto numa_node_id = std::uint8_t(0U); numa_node_id < config::max_numa_nodes(); ++numa_node_id)
+        {
+            auto heap_statistics = this->_worker_local_heaps[worker_id].statistics(numa_node_id);
+            if (heap_statistics.count_blocks() > 0U || heap_statistics.count_remote_frees() > 0U)
+            {
+                statistics.emplace_back(heap_statistics);
+            }
+        }
+    }
+
+    return statistics;
+}
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "allocator_statistics.h"
 #include "config.h"
 #include "global_heap.h"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <cstdint>
 #include <mx/queue/mpsc.h>
@@ -10,6 +13,7 @@
 #include <mx/tasking/task.h>
 #include <mx/util/core_set.h>
 #include <set>
+#include <vector>
 
 namespace mx::memory::dynamic::local {
 /**
@@ -85,11 +89,18 @@ public:
     [[nodiscard]] std::uint8_t numa_node_id() const noexcept { return _numa_node_id; }
     [[nodiscard]] std::uint32_t block_id() const noexcept { return _block_id; }
 
+    /**
+     * @return Size taken from the block, including the header and the size needed for alignment.
+     */
+    [[nodiscard]] std::size_t allocated_size() const noexcept
+    {
+        return _size + _unused_size_before_header + sizeof(AllocationHeader);
+    }
+
     [[nodiscard]] FreeHeader *to_free_header() const noexcept
     {
-        const auto size = _size + _unused_size_before_header + sizeof(AllocationHeader);
         return new (reinterpret_cast<void *>(std::uintptr_t(this) - _unused_size_before_header))
-            FreeHeader(size, _numa_node_id, _block_id);
+            FreeHeader(allocated_size(), _numa_node_id, _block_id);
     }
 
 private:
@@ -190,6 +201,20 @@ public:
         return _free_header.size() == 1U && _free_header.begin()->size() == _size;
     }
 
+    /**
+     * @return Size of the largest free memory within the block.
+     */
+    [[nodiscard]] std::size_t largest_free_size() const noexcept
+    {
+        auto largest_free_size = std::size_t(0U);
+        for (const auto &descriptor : _free_header)
+        {
+            largest_free_size = std::max(largest_free_size, descriptor.size());
+        }
+
+        return largest_free_size;
+    }
+
     [[nodiscard]] std::tuple<std::set<FreeHeaderDescriptor>::iterator, bool, std::size_t, std::size_t> find_free_header(
         std::size_t alignment, std::size_t size) const;
 
@@ -230,6 +255,7 @@ public:
     void free(const std::uint8_t calling_numa_id, AllocationHeader *allocated_item)
     {
         auto *free_header = allocated_item->to_free_header();
+        _usage[free_header->numa_node_id()].count_remote_frees.fetch_add(1U, std::memory_order_relaxed);
         _remote_free_lists[calling_numa_id].push_back(free_header);
     }
 
@@ -259,7 +285,30 @@ public:
 
     [[nodiscard]] bool is_free() const noexcept;
 
+    /**
+     * Reads the usage of the blocks of the given NUMA node; may be called by any thread.
+     * The largest free block is updated when the heap releases its free memory.
+     *
+     * @param numa_node_id NUMA node of the blocks.
+     * @return Statistics of the blocks.
+     */
+    [[nodiscard]] AllocatorStatistics statistics(std::uint8_t numa_node_id) const noexcept;
+
 private:
+    /**
+     * Usage of the blocks of a NUMA node. Counters are written by the owning
+     * worker (remote frees by every worker) and read by any thread.
+     */
+    class Usage
+    {
+    public:
+        std::atomic_uint64_t allocated_bytes{0U};
+        std::atomic_uint64_t in_use_bytes{0U};
+        std::atomic_uint64_t count_blocks{0U};
+        std::atomic_uint64_t count_remote_frees{0U};
+        std::atomic_uint64_t largest_free_block{0U};
+    };
+
     const std::uint16_t _worker_id;
     const std::uint8_t _numa_node_id;
     std::uint32_t _next_block_id{0U};
@@ -271,6 +320,59 @@ private:
     std::array<std::unordered_map<std::uint32_t, std::uint64_t>, config::max_numa_nodes()> _allocated_block_indices;
 
     std::array<queue::MPSC<FreeHeader>, config::max_numa_nodes()> _remote_free_lists;
+
+    /// Usage of the blocks of every NUMA node.
+    std::array<Usage, config::max_numa_nodes()> _usage;
+
+    /**
+     * Adds a new block to the heap.
+     *
+     * @param numa_node_id NUMA node the block is allocated on.
+     * @param size Size of the block.
+     * @return The block.
+     */
+    AllocatedBlock &allocate_block(std::uint8_t numa_node_id, std::size_t size);
+
+    /**
+     * Returns remote freed memory to its block.
+     *
+     * @param free_header Header of the remote freed memory.
+     * @return The block of the memory or nullptr, if the block was released.
+     */
+    AllocatedBlock *refund(FreeHeader *free_header);
+
+    /**
+     * Accounts memory that was handed out by the heap.
+     *
+     * @param allocation Allocated memory, may be nullptr.
+     * @return The allocated memory.
+     */
+    void *account(void *allocation) noexcept
+    {
+        if (allocation != nullptr)
+        {
+            const auto *header = static_cast<AllocationHeader *>(allocation) - 1U;
+            WorkerHeap::increase(_usage[header->numa_node_id()].in_use_bytes, header->allocated_size());
+        }
+
+        return allocation;
+    }
+
+    /**
+     * Increases a counter that is written by a single thread.
+     */
+    static void increase(std::atomic_uint64_t &counter, const std::uint64_t value) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    /**
+     * Decreases a counter that is written by a single thread.
+     */
+    static void decrease(std::atomic_uint64_t &counter, const std::uint64_t value) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) - value, std::memory_order_relaxed);
+    }
 };
 
 class Allocator
@@ -316,6 +418,11 @@ public:
      */
     [[nodiscard]] bool is_free() const noexcept;
 
+    /**
+     * @return Usage of every worker heap for every NUMA node the heap holds blocks of.
+     */
+    [[nodiscard]] std::vector<AllocatorStatistics> statistics() const;
+
 private:
     /// Map from worker id to numa node id.
     std::array<std::uint8_t, tasking::config::max_cores()> _numa_node_ids;
@@ -61,6 +61,21 @@ public:
         return _tail == _end && reinterpret_cast<T const &>(_stub).next() == nullptr;
     }
 
+    /**
+     * @return The first item of the queue without removing it, may be nullptr.
+     *         Like pop_front(), this must only be called by the consumer.
+     */
+    [[nodiscard]] T *front() const noexcept
+    {
+        auto *tail = this->_tail;
+        if (tail == this->_end)
+        {
+            return tail->next();
+        }
+
+        return tail;
+    }
+
     /**
      * @return Takes and removes the first item from the queue.
      */
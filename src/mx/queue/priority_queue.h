@@ -43,6 +43,22 @@ public:
         return _queues[static_cast<std::uint8_t>(priority) - static_cast<std::uint8_t>(MIN_PRIORITY)];
     }
 
+    /**
+     * @return True, when the queues of all priorities are empty.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        for (const auto &queue : _queues)
+        {
+            if (queue.empty() == false)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
 private:
     std::array<Q, static_cast<std::uint8_t>(MAX_PRIORITY) - static_cast<std::uint8_t>(MIN_PRIORITY) + 1U> _queues{};
 };
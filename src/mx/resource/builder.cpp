@@ -13,7 +13,7 @@ std::pair<std::uint16_t, std::uint8_t> Builder::schedule(const resource::annotat
     }
 
     // Schedule resources round robin to the channels.
-    const auto count_worker = this->_scheduler.count_cores();
+    const auto count_worker = this->_scheduler.count_active_workers();
     auto worker_id = this->_round_robin_worker_id.fetch_add(1U, std::memory_order_relaxed) % count_worker;
 
     // If the chosen channel contains an excessive accessed resource, get another.
@@ -128,12 +128,21 @@ public:
         // TODO: Revoke usage prediction?
         if (resource != nullptr)
         {
-            if constexpr (tasking::config::memory_reclamation() != tasking::config::None)
+            const auto memory_reclamation = _scheduler.configuration().memory_reclamation();
+            if (memory_reclamation != tasking::config::None)
             {
                 if (synchronization::is_optimistic(resource.synchronization_primitive()))
                 {
-                    _scheduler.epoch_manager().add_to_garbage_collection(resource.get<ResourceInterface>(),
-                                                                         resource.worker_id());
+                    if (memory_reclamation == tasking::config::QuiescentStateBased)
+                    {
+                        _scheduler.epoch_manager().add_to_limbo_list(resource.get<ResourceInterface>(),
+                                                                     calling_worker_id);
+                    }
+                    else
+                    {
+                        _scheduler.epoch_manager().add_to_garbage_collection(resource.get<ResourceInterface>(),
+                                                                             resource.worker_id());
+                    }
                     return;
                 }
             }
@@ -54,6 +54,6 @@ public:
     [[nodiscard]] bool is_locked() const noexcept { return __atomic_load_n(&_flag, __ATOMIC_RELAXED); }
 
 private:
-    bool _flag;
+    bool _flag{false};
 };
 } // namespace mx::synchronization
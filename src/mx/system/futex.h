@@ -0,0 +1,49 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace mx::system {
+/**
+ * Encapsulates the futex system call to park and wake threads
+ * on a 32bit word.
+ */
+class futex
+{
+public:
+    /**
+     * Suspends the calling thread as long as the given word holds the expected value,
+     * until the thread is woken up or the timeout expires.
+     *
+     * @param word Word to wait on.
+     * @param expected Value the word has to hold to suspend the thread.
+     * @param timeout Maximal time to wait.
+     */
+    static void wait(std::atomic_uint32_t &word, const std::uint32_t expected,
+                     const std::chrono::microseconds timeout) noexcept
+    {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+        auto timeout_spec = timespec{};
+        timeout_spec.tv_sec = seconds.count();
+        timeout_spec.tv_nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - seconds).count();
+
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected, &timeout_spec,
+                  nullptr, 0);
+    }
+
+    /**
+     * Wakes up threads waiting on the given word.
+     *
+     * @param word Word the threads wait on.
+     * @param count Maximal number of threads to wake up.
+     */
+    static void wake(std::atomic_uint32_t &word, const std::uint32_t count = 1U) noexcept
+    {
+        ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+    }
+};
+} // namespace mx::system
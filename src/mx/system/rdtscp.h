@@ -31,5 +31,18 @@ public:
 
         return (std::uint64_t(high) << 32) | low;
     }
+
+    /**
+     * Reads the timestamp counter without serializing the instruction stream.
+     * Cheaper than begin()/end(), intended for always-on accounting.
+     */
+    [[nodiscard]] inline static std::uint64_t now() noexcept
+    {
+        std::uint32_t high, low;
+
+        asm volatile("RDTSCP\n\t" : "=d"(high), "=a"(low)::"%rcx");
+
+        return (std::uint64_t(high) << 32) | low;
+    }
 };
 } // namespace mx::system
\ No newline at end of file
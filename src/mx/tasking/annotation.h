@@ -35,6 +35,12 @@ public:
         compute = 1U,
         mixed = 2U
     };
+    enum worker_binding : std::uint8_t
+    {
+        unbound = 0U,
+        bound = 1U,
+        stealable = 2U
+    };
 
     constexpr annotation() noexcept = default;
     explicit constexpr annotation(const std::uint16_t worker_id) noexcept : _destination(worker_id) {}
@@ -79,10 +85,25 @@ public:
     [[nodiscard]] PrefetchHint prefetch_hint() const noexcept { return _prefetch_hint; }
     [[nodiscard]] PrefetchHint &prefetch_hint() noexcept { return _prefetch_hint; }
     [[nodiscard]] std::uint16_t cycles() const noexcept { return _cycles; }
+    [[nodiscard]] bool is_bound_to_worker() const noexcept { return _worker_binding == worker_binding::bound; }
+    [[nodiscard]] bool is_stealable_from_worker() const noexcept
+    {
+        return _worker_binding == worker_binding::stealable;
+    }
+
+    /**
+     * @return The data object accessed by the task: Either the annotated
+     *  resource or the object of the prefetch hint (may be nullptr).
+     */
+    [[nodiscard]] resource::ptr accessed_resource() const noexcept
+    {
+        return has_resource() ? resource() : _prefetch_hint.resource();
+    }
 
     void set(const enum access_intention access_intention) noexcept { _access_intention = access_intention; }
     void set(const enum priority priority) noexcept { _priority = priority; }
     void set(const enum resource_boundness resource_boundness) noexcept { _resource_boundness = resource_boundness; }
+    void set(const enum worker_binding worker_binding) noexcept { _worker_binding = worker_binding; }
     void set(const std::uint16_t worker_id) noexcept { _destination = worker_id; }
     void set(const std::uint8_t numa_id) noexcept { _destination = numa_id; }
     void set(const resource::ptr resource) noexcept { _destination = resource; }
@@ -108,9 +129,9 @@ private:
         access_intention::write
     };
 
-    /// Priority of a task. Low priority tasks will only be
-    /// executed, whenever a worker has no higher-priorized
-    /// tasks in his pool.
+    /// Priority of a task. Higher prioritized tasks get a larger
+    /// share of the task buffer when a worker refills it, but
+    /// tasks of lower priorities will not starve.
     enum priority _priority
     {
         priority::normal
@@ -121,6 +142,15 @@ private:
         resource_boundness::mixed
     };
 
+    /// Tasks bound to the worker they were dispatched to are neither
+    /// stolen nor shared with other workers. Stealable tasks annotated
+    /// with a worker id are dispatched to that worker, but the worker
+    /// is only a placement hint (e.g., producers of a pipeline share).
+    enum worker_binding _worker_binding
+    {
+        worker_binding::unbound
+    };
+
     /// Cycles used for execution of this task.
     std::uint16_t _cycles{500U};
 
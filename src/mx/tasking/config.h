@@ -8,69 +8,170 @@ public:
     {
         Single,     /// Each worker has a single queue.
         NUMALocal,  /// Each worker has a queue for each NUMA domain and a local queue.
-        WorkerLocal /// Each worker has a queue for each worker.
+        WorkerLocal, /// Each worker has a queue for each worker.
+        NUMAShared   /// Workers of a NUMA domain share a bounded lock-free queue; pinned tasks use the queues above.
     };
 
     enum memory_reclamation_scheme
     {
-        None = 0U,                   /// No memory reclamation at all.
-        UpdateEpochOnRead = 1U,      /// End the epoch after every reading task.
-        UpdateEpochPeriodically = 2U /// End the epoch after a static amount of time.
+        None = 0U,                    /// No memory reclamation at all.
+        UpdateEpochOnRead = 1U,       /// End the epoch after every reading task.
+        UpdateEpochPeriodically = 2U, /// End the epoch after a static amount of time.
+        QuiescentStateBased = 3U      /// Workers announce quiescent states when refilling the task buffer.
     };
 
     enum worker_mode
     {
         Performance = 0U, /// The worker contact the task pool when no task was found.
-        PowerSave = 1U    /// The worker will sleep a static amount of time when no task was found.
+        PowerSave = 1U,   /// The worker will sleep a static amount of time when no task was found.
+        Adaptive = 2U     /// The worker spins, backs off, and finally parks until tasks are dispatched to it.
     };
 
     /// Maximal number of supported cores.
     static constexpr auto max_cores() { return 64U; }
 
-    /// Backend of the queues.
+    /// Backend of the worker-owned queues. The 'NUMAShared' backend is
+    /// selected at runtime (see runtime_config) and complements this one.
     static constexpr auto queue() { return queue_backend::NUMALocal; }
 
     /// Maximal number of supported simultaneous multithreading threads.
     static constexpr auto max_smt_threads() { return 2U; }
 
     /// If enabled, the scheduler will schedule compute- and memory-bound
-    /// tasks to specific workers on a physical core.
-    static constexpr auto is_consider_resource_bound_workers() { return false; }
+    /// tasks to specific workers on a physical core. Tasks without an
+    /// annotated boundness are classified online by sampling their
+    /// cycles and last-level cache misses. Tasks fall back to the sibling
+    /// thread of the core while that thread idles.
+    /// Default of the runtime_config.
+    static constexpr auto is_consider_resource_bound_workers() { return true; }
+
+    /// Every n-th task of a worker will be sampled to classify its resource boundness.
+    static constexpr auto resource_boundness_sample_period() { return 1024U; }
+
+    /// Number of samples of a task (per worker) between two classifications.
+    static constexpr auto resource_boundness_samples() { return 16U; }
+
+    /// Tasks with at least this number of last-level cache misses
+    /// per 10,000 cycles are classified as memory-bound.
+    static constexpr auto memory_bound_llc_misses() { return 20U; }
+
+    /// Tasks with at most this number of last-level cache misses
+    /// per 10,000 cycles are classified as compute-bound.
+    static constexpr auto compute_bound_llc_misses() { return 2U; }
+
+    /// If enabled, workers that run out of tasks will steal tasks from
+    /// other workers (NUMA-local siblings first, remote nodes afterwards).
+    /// Tasks will only be stolen when their annotated resource allows
+    /// execution on a foreign worker.
+    static constexpr auto is_use_work_stealing() { return false; }
+
+    /// If enabled, the set of active workers can be resized while
+    /// the runtime is running. Leaving workers hand over their tasks
+    /// to the remaining workers and sleep until they are re-activated;
+    /// tasks dispatched to inactive workers are redirected.
+    static constexpr auto is_allow_resizing_workers() { return false; }
+
+    /// If enabled, tasks that are spawned locally but reference data by their
+    /// prefetch hint are dispatched to a worker on the NUMA node the data
+    /// was allocated on, instead of the spawning worker.
+    static constexpr auto is_use_locality_aware_dispatch() { return false; }
 
     /// Maximal size for a single task, will be used for task allocation.
     static constexpr auto task_size() { return 128U; }
 
     /// The task buffer will hold a set of tasks, fetched from
-    /// queues. This is the size of the buffer.
+    /// queues. This is the capacity of the buffer; the number of
+    /// tasks fetched at once can be lowered in the runtime_config.
     static constexpr auto task_buffer_size() { return 64U; }
 
+    /// Weight of a priority level when refilling the task buffer.
+    /// Every level (but low, see min_weighted_priority) receives a
+    /// share of the free slots that is proportional to its weight;
+    /// credits of levels that could not be served are carried over,
+    /// so no weighted level will starve.
+    static constexpr auto priority_weight(const unsigned level) { return 1U << (level * 2U); }
+
     /// If enabled, the worker will sample task cycles during execution
     /// and use that stats for approximating the prefetch distance for each
     /// task.
     /// If disabled, automatic prefetching will fall back to task annotations.
     static constexpr auto is_monitor_task_cycles_for_prefetching() { return false; }
 
+    /// If enabled, the automatic prefetch distance is tuned for every
+    /// task type (trace id) by a feedback controller that samples the
+    /// cycles of tasks (see PrefetchDistanceController).
+    static constexpr auto is_tune_prefetch_distance() { return true; }
+
+    /// Every n-th task of a worker will be sampled to tune the prefetch distance.
+    static constexpr auto prefetch_distance_sample_period() { return 64U; }
+
+    /// Upper bound of the tuned prefetch distance.
+    static constexpr auto max_prefetch_distance() { return 16U; }
+
     /// If enabled, will record the number of execute tasks,
     /// scheduled tasks, reader and writer per core and more.
+    /// Default of the runtime_config.
     static constexpr auto is_use_task_counter() { return false; }
 
     /// If enabled, the runtime of each task will be recorded.
+    /// Default of the runtime_config.
     static constexpr auto is_collect_task_traces() { return false; }
 
     /// If enabled, the dataflow graph will collect statistics which node
     /// emitted which amount of data.
     static constexpr auto is_count_graph_emits() { return false; }
 
+    /// If enabled, producers of a pipeline will be parked while a succeeding
+    /// node holds more pending tokens (i.e., tokens consumed by spawning tasks
+    /// that did not execute, yet) than the watermark of the graph, which caps
+    /// the memory of intermediate results. Default for every graph, can be
+    /// switched per graph (see Graph::is_use_backpressure()).
+    static constexpr auto is_use_dataflow_backpressure() { return false; }
+
+    /// If enabled, dataflow pipelines that are started at the same time
+    /// (e.g., the build sides of multiple joins) split the workers
+    /// proportional to their estimated work instead of producing on
+    /// all workers each.
+    static constexpr auto is_share_workers_between_pipelines() { return true; }
+
+    /// Time (in microseconds) a worker should need to process a morsel
+    /// pulled from a morsel-driven token generator; the number of tokens
+    /// per morsel is adapted to the measured cost of a token.
+    static constexpr auto morsel_duration() { return 1000U; }
+
+    /// Number of worker-local data reduced by a single step when
+    /// reducing worker-local data along a tree (e.g., when finalizing
+    /// dataflow nodes); data is reduced per NUMA node first.
+    static constexpr auto reduction_fanout() { return 4U; }
+
+    /// Default number of pending tokens of a dataflow node that throttles
+    /// the producers of the pipeline (can be changed for every graph).
+    static constexpr auto dataflow_pending_tokens_watermark() { return 4096U; }
+
+    /// If enabled, every dataflow graph owns a slab arena for temporary
+    /// data (e.g., intermediate tiles) that is freed with the graph.
+    static constexpr auto is_use_dataflow_slab_arena() { return true; }
+
     /// If enabled, the dataflow graph will collect start times of
     /// pipelines and finish times of nodes.
+    /// Default of the runtime_config.
     static constexpr auto is_record_graph_times() { return false; }
 
     /// If enabled, memory will be reclaimed while using optimistic
     /// synchronization by epoch-based reclamation. Otherwise, freeing
     /// memory is unsafe.
+    /// Default of the runtime_config.
     static constexpr auto memory_reclamation() { return memory_reclamation_scheme::None; }
 
-    /// Switch between performance and power saving mode.
+    /// Interval (in milliseconds) in which idle workers return the empty
+    /// blocks of their resource heap to the global heap; zero disables
+    /// the compaction.
+    /// Default of the runtime_config.
+    static constexpr auto memory_compaction_interval() { return 0U; }
+
+    /// Switch between performance, power saving, and adaptive mode.
+    /// 'worker_mode::Adaptive' releases the CPU of idle workers, which
+    /// is preferable for servers idling between queries.
     /// Set to 'worker_mode::Performance' for measurements.
     static constexpr auto worker_mode() { return worker_mode::Performance; }
 };
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "runtime.h"
+#include "task.h"
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <mx/system/cache.h>
+#include <utility>
+
+namespace mx::tasking {
+/**
+ * Return type of coroutines executed by a CoroutineTask.
+ * The coroutine finishes with a TaskResult (via co_return)
+ * that is handed to the runtime like the result of a regular task.
+ */
+class Coroutine
+{
+public:
+    class promise_type
+    {
+    public:
+        constexpr promise_type() noexcept = default;
+        ~promise_type() noexcept = default;
+
+        /**
+         * Frames are allocated from the worker-local heap,
+         * coroutines are created and destroyed by workers only.
+         * When the heap is exhausted, nullptr is returned and the
+         * coroutine is created empty (see get_return_object_on_allocation_failure()).
+         */
+        static void *operator new(const std::size_t size) noexcept
+        {
+            return runtime::allocate(runtime::numa_node_id(runtime::worker_id()), 64U, size);
+        }
+
+        static void operator delete(void *pointer) noexcept { runtime::free(pointer); }
+
+        [[nodiscard]] Coroutine get_return_object() noexcept
+        {
+            return Coroutine{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        /**
+         * @return An empty coroutine, when the frame could not be allocated.
+         */
+        [[nodiscard]] static Coroutine get_return_object_on_allocation_failure() noexcept { return Coroutine{}; }
+
+        /// The coroutine is started by the first execution of the task.
+        [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+        /// The frame stays alive until the task has read the result.
+        [[nodiscard]] std::suspend_always final_suspend() const noexcept { return {}; }
+
+        void return_value(const TaskResult result) noexcept { _result = result; }
+
+        [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+
+        [[nodiscard]] TaskResult result() const noexcept { return _result; }
+
+    private:
+        TaskResult _result;
+    };
+
+    constexpr Coroutine() noexcept = default;
+    Coroutine(Coroutine &&other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+    Coroutine(const Coroutine &) = delete;
+
+    ~Coroutine() noexcept
+    {
+        if (_handle)
+        {
+            _handle.destroy();
+        }
+    }
+
+    Coroutine &operator=(Coroutine &&other) noexcept
+    {
+        if (_handle)
+        {
+            _handle.destroy();
+        }
+        _handle = std::exchange(other._handle, nullptr);
+        return *this;
+    }
+
+    Coroutine &operator=(const Coroutine &) = delete;
+
+    explicit operator bool() const noexcept { return static_cast<bool>(_handle); }
+
+    /**
+     * Runs the coroutine until it suspends or finishes.
+     */
+    void resume() const { _handle.resume(); }
+
+    /**
+     * @return True, when the coroutine returned its result.
+     */
+    [[nodiscard]] bool done() const noexcept { return _handle.done(); }
+
+    /**
+     * @return The result of the finished coroutine.
+     */
+    [[nodiscard]] TaskResult result() const noexcept { return _handle.promise().result(); }
+
+private:
+    explicit Coroutine(const std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+
+    std::coroutine_handle<promise_type> _handle{nullptr};
+};
+
+/**
+ * Awaitable that issues a prefetch for a memory region and suspends the coroutine.
+ * While the data is loaded into the cache, the worker executes other tasks
+ * (and other suspended coroutines) before the coroutine is resumed.
+ */
+class PrefetchAwaiter
+{
+public:
+    constexpr PrefetchAwaiter(const void *address, const std::uint32_t size) noexcept
+        : _address(address), _size(size)
+    {
+    }
+
+    ~PrefetchAwaiter() noexcept = default;
+
+    /// Nothing to prefetch, nothing to wait for.
+    [[nodiscard]] bool await_ready() const noexcept { return _address == nullptr || _size == 0U; }
+
+    void await_suspend(std::coroutine_handle<> /*handle*/) const noexcept
+    {
+        system::cache::prefetch_range<system::cache::level::ALL, system::cache::access::read>(
+            static_cast<const std::int64_t *>(_address), _size);
+    }
+
+    void await_resume() const noexcept {}
+
+private:
+    const void *_address;
+    const std::uint32_t _size;
+};
+
+/**
+ * Task that executes a coroutine instead of running to completion. The coroutine
+ * can co_await a prefetch; the task is then re-scheduled at the same worker and
+ * resumed after the worker executed the tasks in front of it. Interleaving many
+ * suspended tasks hides memory latency like asynchronous memory access chaining
+ * or group prefetching do.
+ *
+ * Since the state of the coroutine lives in its frame and not in the task,
+ * coroutine tasks can not be restored by optimistic execution; coroutine tasks
+ * must not be annotated with a synchronized resource and synchronize on their own.
+ */
+class CoroutineTask : public TaskInterface
+{
+public:
+    constexpr CoroutineTask() noexcept = default;
+    ~CoroutineTask() noexcept override = default;
+
+    TaskResult execute(const std::uint16_t worker_id) final
+    {
+        if (static_cast<bool>(_coroutine) == false) [[unlikely]]
+        {
+            _coroutine = this->run(worker_id);
+
+            /// The frame could not be allocated; try again after the worker
+            /// executed the tasks in front (that may release their frames).
+            if (static_cast<bool>(_coroutine) == false) [[unlikely]]
+            {
+                this->annotate(worker_id);
+                return TaskResult::make_succeed(this);
+            }
+        }
+
+        _coroutine.resume();
+        if (_coroutine.done())
+        {
+            return _coroutine.result();
+        }
+
+        /// The coroutine waits for a prefetch; resume at this worker.
+        this->annotate(worker_id);
+        return TaskResult::make_succeed(this);
+    }
+
+protected:
+    /**
+     * The coroutine executed by the task.
+     * Coroutines are resumed at the worker they were started.
+     *
+     * @param worker_id Worker the coroutine is executed on.
+     * @return The coroutine.
+     */
+    virtual Coroutine run(std::uint16_t worker_id) = 0;
+
+    /**
+     * Prefetches the given memory region and suspends the coroutine.
+     *
+     * @param address Address of the data.
+     * @param size Size of the data in bytes.
+     * @return Awaitable for co_await.
+     */
+    [[nodiscard]] static PrefetchAwaiter prefetch(const void *address, const std::uint32_t size) noexcept
+    {
+        return PrefetchAwaiter{address, size};
+    }
+
+private:
+    Coroutine _coroutine;
+};
+} // namespace mx::tasking
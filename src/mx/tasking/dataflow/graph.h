@@ -5,24 +5,34 @@
 #include "node.h"
 #include "pipeline.h"
 #include "producer.h"
+#include "reduction.h"
+#include "worker_share.h"
 #include <bitset>
 #include <chrono>
+#include <memory>
+#include <mutex>
 #include <mx/memory/global_heap.h>
+#include <mx/memory/slab_allocator.h>
 #include <mx/synchronization/spinlock.h>
 #include <mx/tasking/runtime.h>
 #include <mx/tasking/task.h>
+#include <optional>
 #include <ranges>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
 namespace mx::tasking::dataflow {
 
 template <typename T> class Graph;
+template <typename T> class MorselProducingTask;
 
 /**
  * The SequentialProducingTask takes a graph node and calls the nodes produce()
  * method for an annotated amount or until the produce() call returns false.
  * The task will only spawned once; produced will be called in a loop.
+ * When the graph throttles the producer, the task is parked by the graph
+ * and continues with the remaining data when it is resumed.
  */
 template <typename T> class SequentialProducingTask final : public TaskInterface
 {
@@ -37,6 +47,12 @@ public:
 private:
     Graph<T> *_graph;
     NodeInterface<T> *_node;
+
+    /// Data generated by the first execution.
+    std::optional<std::vector<Token<T>>> _data{std::nullopt};
+
+    /// Index of the next token to consume.
+    std::size_t _next_token_index{0U};
 };
 
 /**
@@ -50,8 +66,10 @@ template <typename T> class ParallelProducingTask final : public TaskInterface
 {
 public:
     ParallelProducingTask(Graph<T> *graph, NodeInterface<T> *node, T &&data,
-                          ParallelProducingFinalizeCounter finalize_counter) noexcept
-        : _graph(graph), _node(node), _data(std::move(data)), _finalize_counter(finalize_counter)
+                          ParallelProducingFinalizeCounter finalize_counter,
+                          MorselProducingTask<T> *morsel_producer = nullptr) noexcept
+        : _graph(graph), _node(node), _data(std::move(data)), _finalize_counter(finalize_counter),
+          _morsel_producer(morsel_producer)
     {
     }
     ~ParallelProducingTask() noexcept override = default;
@@ -65,20 +83,27 @@ private:
     NodeInterface<T> *_node;
     T _data;
     ParallelProducingFinalizeCounter _finalize_counter;
+
+    /// Task that pulled the morsel of this token, if any; resumed when the morsel is processed.
+    MorselProducingTask<T> *_morsel_producer;
 };
 
 /**
  * Since the produced data may become very large, a single task that spawns
  * all parallel producing tasks may block a worker for a long time.
- * The SpawnParallelProducingTask will be spawned on every worker and spawn
- * parallel producing tasks for a partition of the data.
+ * The SpawnParallelProducingTask will be spawned on every worker of the pipelines
+ * share and spawn parallel producing tasks for the data partitions mapped to that worker;
+ * the producing tasks are dispatched to that worker (unless their token writes a resource),
+ * but may be stolen by idle workers.
  */
 template <typename T> class SpawnParallelProducingTask final : public TaskInterface
 {
 public:
-    SpawnParallelProducingTask(Graph<T> *graph, NodeInterface<T> *node,
+    SpawnParallelProducingTask(Graph<T> *graph, NodeInterface<T> *node, const WorkerShare worker_share,
+                               const std::uint16_t target_worker_id,
                                std::atomic_uint16_t *spawned_worker_counter) noexcept
-        : _graph(graph), _node(node), _spawned_worker_counter(spawned_worker_counter)
+        : _graph(graph), _node(node), _worker_share(worker_share), _target_worker_id(target_worker_id),
+          _spawned_worker_counter(spawned_worker_counter)
     {
     }
     ~SpawnParallelProducingTask() noexcept override = default;
@@ -89,7 +114,16 @@ public:
         if (generator != nullptr) [[likely]]
         {
             /// Data spawned for this worker by this task.
-            auto data = generator->generate(worker_id);
+            auto data = std::vector<Token<T>>{};
+            const auto count_partitions = runtime::workers();
+            for (auto partition_id = std::uint16_t(0U); partition_id < count_partitions; ++partition_id)
+            {
+                if (_worker_share.worker_id(partition_id, count_partitions) == _target_worker_id)
+                {
+                    auto partition = generator->generate(partition_id);
+                    std::move(partition.begin(), partition.end(), std::back_inserter(data));
+                }
+            }
 
             if (data.empty() == false) [[likely]]
             {
@@ -99,6 +133,8 @@ public:
                     new (std::aligned_alloc(system::cache::line_size(), sizeof(std::atomic_uint64_t)))
                         std::atomic_uint64_t(data.size());
 
+                auto source_tasks = std::vector<TaskInterface *>{};
+                source_tasks.reserve(data.size());
                 for (auto &&token : data)
                 {
                     /// Spawn producing tasks with
@@ -107,8 +143,21 @@ public:
                         ParallelProducingFinalizeCounter{_spawned_worker_counter, finalize_counter});
 
                     source_task->annotate(token.annotation());
-                    runtime::spawn(*source_task, worker_id);
+
+                    /// Produce on the worker of the share, the read data is only a prefetch hint;
+                    /// idle workers may steal the task to balance skewed partitions.
+                    /// Tokens writing a resource stay at its owner that synchronizes the access.
+                    if (token.annotation().has_resource() == false || token.annotation().is_readonly())
+                    {
+                        source_task->annotate(_target_worker_id);
+                        source_task->annotate(mx::tasking::annotation::stealable);
+                    }
+                    source_task->annotate(_graph->priority());
+                    source_tasks.emplace_back(source_task);
                 }
+
+                /// Tasks targeting the same worker are handed over with a single queue operation.
+                runtime::spawn_batch(source_tasks, worker_id);
             }
 
             /// It may happen, that a worker has no data. In this case,
@@ -123,10 +172,72 @@ public:
         return TaskResult::make_remove();
     }
 
+private:
+    Graph<T> *_graph;
+    NodeInterface<T> *_node;
+
+    /// Workers producing the data of the pipeline.
+    WorkerShare _worker_share;
+
+    /// Worker the task was spawned for; produces the partitions mapped to this worker.
+    std::uint16_t _target_worker_id;
+
+    std::atomic_uint16_t *_spawned_worker_counter;
+};
+
+/**
+ * The MorselProducingTask pulls morsels from a morsel-driven token generator
+ * and spawns parallel producing tasks for the tokens of the morsel on the
+ * pulling worker. The task will be spawned on every worker of the pipelines
+ * share and pulls morsels until the generator is exhausted. While the tasks of
+ * a morsel run, the task is suspended; the last of them resumes the task to
+ * pull the next morsel and report the time the morsel took (to adapt the size
+ * of morsels).
+ */
+template <typename T> class MorselProducingTask final : public TaskInterface
+{
+public:
+    MorselProducingTask(Graph<T> *graph, NodeInterface<T> *node, std::atomic_uint16_t *spawned_worker_counter) noexcept
+        : _graph(graph), _node(node), _spawned_worker_counter(spawned_worker_counter)
+    {
+    }
+    ~MorselProducingTask() noexcept override = default;
+
+    TaskResult execute(std::uint16_t worker_id) override;
+
+    [[nodiscard]] std::uint64_t trace_id() const noexcept override { return _node->trace_id(); }
+
+    /**
+     * Called by the task of every token of the last morsel after processing
+     * the token; the last one resumes this task.
+     *
+     * @param worker_id Worker that processed the token.
+     */
+    void processed_token(const std::uint16_t worker_id)
+    {
+        if (_count_pending_morsel_tokens.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+        {
+            runtime::spawn(*this, worker_id);
+        }
+    }
+
 private:
     Graph<T> *_graph;
     NodeInterface<T> *_node;
     std::atomic_uint16_t *_spawned_worker_counter;
+
+    /// Counter of pending tasks spawned by this task, including a reference of
+    /// the task itself that is released when the generator is exhausted.
+    std::atomic_uint64_t *_task_counter{nullptr};
+
+    /// Tokens of the last morsel that were not processed, yet.
+    std::atomic_uint64_t _count_pending_morsel_tokens{0U};
+
+    /// Number of tokens of the last pulled morsel.
+    std::uint64_t _count_morsel_tokens{0U};
+
+    /// Time the last morsel was pulled.
+    std::chrono::steady_clock::time_point _morsel_start;
 };
 
 /**
@@ -136,6 +247,7 @@ private:
  * and starts pipelines of the graph if needed.
  */
 template <typename T> class AbstractFinalizeTask;
+template <typename T> class CompletionReducer;
 
 /**
  * The graph is a set of nodes that produce and consume data.
@@ -144,7 +256,9 @@ template <typename T> class AbstractFinalizeTask;
  *
  * Further, the nodes are arranged in pipelines to solve dependencies
  * between nodes. Everytime a pipeline finishes, the graph will start
- * depending pipelines.
+ * depending pipelines. Independent pipelines (e.g., the build sides
+ * of multiple joins) run at the same time and share the workers
+ * proportional to their estimated work.
  *
  * After executing the last node of the graph, all nodes and pipelines
  * will be removed.
@@ -153,26 +267,45 @@ template <typename T> class Graph : public EmitterInterface<T>
 {
 public:
     friend class AbstractFinalizeTask<T>;
+    friend class CompletionReducer<T>;
 
-    Graph(const bool is_record_times = false) : _is_record_times(is_record_times)
+    /**
+     * @param is_record_times Record start times of pipelines and finish times of nodes.
+     * @param priority Priority of all tasks spawned by the graph.
+     * @param slab_arena Arena for temporary data (e.g., shared with the planner of the graph); if not
+     *  given, the graph creates an arena when config::is_use_dataflow_slab_arena() is enabled.
+     */
+    Graph(const bool is_record_times = false, const enum priority priority = priority::normal,
+          std::shared_ptr<memory::slab::Arena> slab_arena = nullptr)
+        : _slab_arena(std::move(slab_arena)),
+          _is_record_times(is_record_times && runtime::configuration().is_record_graph_times()), _priority(priority)
     {
         _pipelines.reserve(1U << 3U);
         _node_pipelines.reserve(1U << 6U);
         _pipeline_dependencies.reserve(1U << 3U);
         _pipeline_dependencies_lock.unlock();
 
-        if constexpr (config::is_record_graph_times())
+        if constexpr (config::is_use_dataflow_slab_arena())
         {
-            if (_is_record_times)
+            if (_slab_arena == nullptr)
             {
-                _pipeline_start_times.reserve(_pipelines.capacity());
-                _node_finish_times.reserve(1U << 6U);
+                _slab_arena = runtime::new_slab_arena();
             }
         }
+
+        if (_is_record_times)
+        {
+            _pipeline_start_times.reserve(_pipelines.capacity());
+            _node_finish_times.reserve(1U << 6U);
+        }
     }
 
     ~Graph() override
     {
+        /// Trace ids are derived from the nodes and may be reused by following graphs; cycles
+        /// may have been accounted even if the accounting was switched off in the meantime.
+        runtime::retire_task_cycles(this->trace_ids());
+
         std::for_each(_pipelines.begin(), _pipelines.end(), [](auto *pipeline) {
             pipeline->~Pipeline();
             std::free(pipeline);
@@ -202,8 +335,9 @@ public:
      */
     void emit(const std::uint16_t worker_id, NodeInterface<T> *node, Token<T> &&data) override
     {
-        if (_is_active) [[likely]]
+        if (is_active()) [[likely]]
         {
+            data.annotation().set(_priority);
             node->out()->consume(worker_id, *this, std::move(data));
 
             if constexpr (config::is_count_graph_emits())
@@ -235,6 +369,22 @@ public:
         }
     }
 
+    /**
+     * @return Trace ids of all nodes, used to attribute task cycles to the nodes.
+     */
+    [[nodiscard]] std::vector<std::uint64_t> trace_ids() const
+    {
+        auto trace_ids = std::vector<std::uint64_t>{};
+        this->for_each_node([&trace_ids](NodeInterface<T> *node) {
+            if (const auto trace_id = node->trace_id(); trace_id != 0U)
+            {
+                trace_ids.emplace_back(trace_id);
+            }
+        });
+
+        return trace_ids;
+    }
+
     /**
      * Adds a single node to the graph.
      *
@@ -289,7 +439,9 @@ public:
 
     /**
      * Creates a dependency between the node pair (A,B) where A will be
-     * started only when B finishes.
+     * started only when B finishes. The dependencies between pipelines
+     * are derived from the dependencies between nodes when the graph
+     * is started.
      *
      * @param node Node with dependency.
      * @param node_to_wait_for Node that has to finish.
@@ -299,28 +451,23 @@ public:
         _node_dependencies.template emplace_back(std::make_pair(node, node_to_wait_for));
 
         auto *node_pipeline = _node_pipelines.at(node);
-        auto *wait_for_pipeline = _node_pipelines.at(node_to_wait_for);
-
-        if (node_pipeline == wait_for_pipeline)
-        {
-            auto *new_pipeline = make_pipeline();
-            change_pipeline(node_to_wait_for, node_pipeline, new_pipeline);
-            _pipeline_dependencies.at(node_pipeline).template emplace_back(new_pipeline);
-        }
-        else
+        if (node_pipeline == _node_pipelines.at(node_to_wait_for))
         {
-            _pipeline_dependencies.at(node_pipeline).template emplace_back(wait_for_pipeline);
+            change_pipeline(node_to_wait_for, node_pipeline, make_pipeline());
         }
     }
 
     /**
      * Starts the graph by spawning tasks that call produce() for all
-     * nodes assigned to a pipeline without dependencies.
+     * nodes assigned to a pipeline without dependencies. The set of
+     * workers is not resized until the graph completed.
      *
      * @param worker_id Worker where the graph is started.
      */
     void start(const std::uint16_t worker_id)
     {
+        runtime::register_running_graph();
+
         if constexpr (config::is_count_graph_emits())
         {
             this->for_each_node([&emits = this->_emit_counter](auto *node) {
@@ -332,11 +479,25 @@ public:
         /// Start all tasks for preparatory work.
         for (auto *task : _preparatory_tasks)
         {
+            task->annotate(_priority);
             runtime::spawn(*task, worker_id);
         }
         _preparatory_tasks.clear();
 
-        /// Collect pipelines without dependencies and start them.
+        /// Build the DAG of pipelines from the dependencies between the nodes.
+        for (const auto &[node, node_to_wait_for] : _node_dependencies)
+        {
+            auto *pipeline = _node_pipelines.at(node);
+            auto *wait_for_pipeline = _node_pipelines.at(node_to_wait_for);
+            auto &dependencies = _pipeline_dependencies.at(pipeline);
+            if (pipeline != wait_for_pipeline &&
+                std::find(dependencies.begin(), dependencies.end(), wait_for_pipeline) == dependencies.end())
+            {
+                dependencies.emplace_back(wait_for_pipeline);
+            }
+        }
+
+        /// Collect pipelines without dependencies and start them at the same time.
         auto pipelines_to_start = std::vector<Pipeline<T> *>{};
         for (auto &[pipeline, dependencies] : _pipeline_dependencies)
         {
@@ -349,12 +510,165 @@ public:
         for (auto *pipeline : pipelines_to_start)
         {
             _pipeline_dependencies.erase(pipeline);
-            start(worker_id, pipeline);
         }
+        start(worker_id, pipelines_to_start);
     }
 
     void interrupt() override { _is_active = false; }
 
+    /**
+     * The graph becomes inactive when interrupted or when the memory of the
+     * graph exceeds the limit of its budget; producers stop producing and
+     * emitted data is dropped, so the graph completes as soon as possible.
+     *
+     * @return True, if the graph is active.
+     */
+    [[nodiscard]] bool is_active() const noexcept
+    {
+        return _is_active && (_slab_arena == nullptr || _slab_arena->budget().is_exceeded() == false);
+    }
+
+    /**
+     * Updates the priority of the query represented by the graph. All tasks
+     * spawned by the graph and all data emitted to the graph will inherit
+     * that priority. Should be set before the graph is started.
+     *
+     * @param priority New priority.
+     */
+    void priority(const enum priority priority) noexcept { _priority = priority; }
+
+    /**
+     * @return Priority of the query represented by the graph.
+     */
+    [[nodiscard]] enum priority priority() const noexcept override { return _priority; }
+
+    /**
+     * Updates the number of pending tokens of a node that throttles
+     * the producers feeding that node.
+     *
+     * @param watermark Number of pending tokens.
+     */
+    void pending_tokens_watermark(const std::uint64_t watermark) noexcept { _pending_tokens_watermark = watermark; }
+
+    /**
+     * @return Number of pending tokens of a node that throttles the producers feeding that node.
+     */
+    [[nodiscard]] std::uint64_t pending_tokens_watermark() const noexcept { return _pending_tokens_watermark; }
+
+    /**
+     * Enables or disables throttling producers by the pending tokens of the
+     * succeeding nodes (see config::is_use_dataflow_backpressure() for the default).
+     * Producers are throttled by congested nodes in either case.
+     *
+     * @param is_use_backpressure True, if producers are throttled by the watermark.
+     */
+    void is_use_backpressure(const bool is_use_backpressure) noexcept { _is_use_backpressure = is_use_backpressure; }
+
+    /**
+     * @return True, if producers are throttled by the watermark.
+     */
+    [[nodiscard]] bool is_use_backpressure() const noexcept { return _is_use_backpressure; }
+
+    /**
+     * Checks whether a producing node should pause producing data,
+     * because a succeeding node is congested or (with backpressure)
+     * has not processed the tokens emitted before.
+     *
+     * @param node Producing node.
+     * @return True, if the producer should pause.
+     */
+    [[nodiscard]] bool is_throttled(const NodeInterface<T> *node) const noexcept
+    {
+        /// Producers of an inactive graph skip their data and should complete as soon as possible.
+        if (is_active() == false) [[unlikely]]
+        {
+            return false;
+        }
+
+        for (const auto *consumer = node->out(); consumer != nullptr; consumer = consumer->out())
+        {
+            if (consumer->is_congested()) [[unlikely]]
+            {
+                return true;
+            }
+
+            if (_is_use_backpressure && consumer->count_pending_tokens() >= _pending_tokens_watermark)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Parks a throttled producing task until the succeeding nodes caught up; the
+     * task is spawned again by resume_producers(). The task may be resumed (and
+     * executed by another worker) before park() returns and must not be accessed
+     * by the caller afterwards.
+     *
+     * @param worker_id Worker parking the producer.
+     * @param producer Producing task.
+     * @param node Node of the producing task.
+     */
+    void park(const std::uint16_t worker_id, TaskInterface *producer, NodeInterface<T> *node)
+    {
+        {
+            auto lock = std::unique_lock{_parked_producers_lock};
+            _parked_producers.emplace_back(producer, node);
+            _count_parked_producers.fetch_add(1U);
+        }
+
+        /// The succeeding nodes may have caught up before the producer was parked.
+        if (this->is_resumable(node))
+        {
+            this->resume_producers(worker_id);
+        }
+    }
+
+    /**
+     * Spawns all parked producers whose succeeding nodes caught up. Producers are
+     * resumed when the pending tokens dropped to half the watermark, so they do not
+     * pause and resume with every processed token.
+     *
+     * @param worker_id Worker resuming the producers.
+     */
+    void resume_producers(const std::uint16_t worker_id) override
+    {
+        if (_count_parked_producers.load() == 0U) [[likely]]
+        {
+            return;
+        }
+
+        auto resumed_producers = std::vector<TaskInterface *>{};
+        {
+            auto lock = std::unique_lock{_parked_producers_lock};
+            for (auto iterator = _parked_producers.begin(); iterator != _parked_producers.end();)
+            {
+                if (this->is_resumable(iterator->second))
+                {
+                    resumed_producers.emplace_back(iterator->first);
+                    iterator = _parked_producers.erase(iterator);
+                }
+                else
+                {
+                    ++iterator;
+                }
+            }
+            _count_parked_producers.store(_parked_producers.size());
+        }
+
+        for (auto *producer : resumed_producers)
+        {
+            runtime::spawn(*producer, worker_id);
+        }
+    }
+
+    /**
+     * @return Number of producing tasks that are parked until the succeeding nodes caught up.
+     */
+    [[nodiscard]] std::uint64_t count_parked_producers() const noexcept { return _count_parked_producers.load(); }
+
     void add(std::vector<TaskInterface *> &&preparatory_tasks)
     {
         std::move(preparatory_tasks.begin(), preparatory_tasks.end(), std::back_inserter(_preparatory_tasks));
@@ -374,6 +688,22 @@ public:
         }
     }
 
+    /**
+     * @return Arena for temporary data produced by the nodes of the graph.
+     */
+    [[nodiscard]] memory::slab::Arena *slab_arena() const noexcept override { return _slab_arena.get(); }
+
+    /**
+     * Data allocated from the arena may outlive the graph (e.g., results
+     * that are sent to the client); owners of such data share the arena.
+     *
+     * @return Shared ownership of the arena.
+     */
+    [[nodiscard]] const std::shared_ptr<memory::slab::Arena> &shared_slab_arena() const noexcept
+    {
+        return _slab_arena;
+    }
+
     [[nodiscard]] std::optional<std::chrono::system_clock::time_point> start_time(Pipeline<T> *pipeline) const noexcept
     {
         if (auto iterator = _pipeline_start_times.find(pipeline); iterator != _pipeline_start_times.end())
@@ -423,6 +753,9 @@ public:
     }
 
 private:
+    /// Arena for temporary data of the nodes; released after all nodes are freed.
+    std::shared_ptr<memory::slab::Arena> _slab_arena{nullptr};
+
     /// All pipelines of the graph.
     std::vector<Pipeline<T> *> _pipelines;
 
@@ -441,6 +774,15 @@ private:
     /// Record execution times?
     bool _is_record_times;
 
+    /// Priority of all tasks spawned by the graph.
+    enum priority _priority;
+
+    /// Number of pending tokens of a node that throttles the producers.
+    std::uint64_t _pending_tokens_watermark{config::dataflow_pending_tokens_watermark()};
+
+    /// Throttle producers by the pending tokens of the succeeding nodes?
+    bool _is_use_backpressure{config::is_use_dataflow_backpressure()};
+
     /// Start time of each pipeline.
     std::unordered_map<Pipeline<T> *, std::chrono::system_clock::time_point> _pipeline_start_times;
 
@@ -453,11 +795,43 @@ private:
 
     alignas(64) bool _is_active{true};
 
+    /// Producing tasks (and their nodes) waiting for the succeeding nodes to catch up.
+    alignas(64) synchronization::Spinlock _parked_producers_lock;
+    std::vector<std::pair<TaskInterface *, NodeInterface<T> *>> _parked_producers;
+    std::atomic_uint64_t _count_parked_producers{0U};
+
     alignas(64) std::unordered_map<NodeInterface<T> *,
                                    std::array<util::aligned_t<std::uint64_t>, config::max_cores()>> _emit_counter;
 
     [[nodiscard]] bool complete(std::uint16_t worker_id, NodeInterface<T> *node);
 
+    /**
+     * Checks whether a parked producer can continue: The succeeding nodes are not
+     * congested and (with backpressure) hold at most half the watermark of pending tokens.
+     *
+     * @param node Producing node.
+     * @return True, if the producer can be resumed.
+     */
+    [[nodiscard]] bool is_resumable(const NodeInterface<T> *node) const noexcept
+    {
+        if (is_active() == false) [[unlikely]]
+        {
+            return true;
+        }
+
+        const auto resume_watermark = std::max<std::uint64_t>(_pending_tokens_watermark / 2U, 1U);
+        for (const auto *consumer = node->out(); consumer != nullptr; consumer = consumer->out())
+        {
+            if (consumer->is_congested() ||
+                (_is_use_backpressure && consumer->count_pending_tokens() > resume_watermark))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     /**
      * @return A new pipeline.
      */
@@ -491,44 +865,89 @@ private:
         }
     }
 
+    /**
+     * Estimates the work of a pipeline by the amount of data the first node produces in parallel.
+     *
+     * @param pipeline Pipeline to estimate.
+     * @return Estimated work; zero if the pipeline does not produce data in parallel.
+     */
+    [[nodiscard]] static std::uint64_t estimated_work(Pipeline<T> *pipeline)
+    {
+        auto *node = pipeline->nodes().front();
+        if (node->annotation().is_parallel() && node->annotation().is_producing())
+        {
+            return node->annotation().token_generator()->count();
+        }
+
+        return 0U;
+    }
+
+    /**
+     * Starts pipelines that became independent at the same time. When enabled,
+     * the workers are split between the pipelines proportional to their
+     * estimated work; otherwise, every pipeline spans all workers.
+     *
+     * @param worker_id Worker where start() is called.
+     * @param pipelines Pipelines to start.
+     */
+    void start(const std::uint16_t worker_id, const std::vector<Pipeline<T> *> &pipelines)
+    {
+        auto work = std::vector<std::uint64_t>(pipelines.size(), 0U);
+        if constexpr (config::is_share_workers_between_pipelines())
+        {
+            std::transform(pipelines.begin(), pipelines.end(), work.begin(), &Graph<T>::estimated_work);
+        }
+
+        const auto shares = WorkerShare::allocate(work, runtime::workers());
+        for (auto index = 0U; index < pipelines.size(); ++index)
+        {
+            this->start(worker_id, pipelines[index], shares[index]);
+        }
+    }
+
     /**
      * Starts a given pipeline. This will spawn the produce tasks for the first node of the pipeline.
      *
      * @param worker_id Worker where start() is called.
      * @param pipeline Pipeline to start.
+     * @param worker_share Workers producing the data of the pipeline.
      */
-    void start(const std::uint16_t worker_id, Pipeline<T> *pipeline)
+    void start(const std::uint16_t worker_id, Pipeline<T> *pipeline, const WorkerShare worker_share)
     {
         auto *node = pipeline->nodes().front();
 
-        if constexpr (config::is_record_graph_times())
+        if (this->_is_record_times)
         {
-            if (this->_is_record_times)
-            {
-                this->_pipeline_start_times.insert(std::make_pair(pipeline, std::chrono::system_clock::now()));
-            }
+            this->_pipeline_start_times.insert(std::make_pair(pipeline, std::chrono::system_clock::now()));
         }
 
         if (node->annotation().is_parallel() && node->annotation().is_producing())
         {
-            const auto count_workers = runtime::workers();
-
             auto *spawned_worker_counter =
                 new (std::aligned_alloc(system::cache::line_size(), sizeof(std::atomic_uint16_t)))
-                    std::atomic_uint16_t(count_workers);
+                    std::atomic_uint16_t(worker_share.count_workers());
 
-            for (auto target_worker_id = std::uint16_t(0U); target_worker_id < count_workers; ++target_worker_id)
+            const auto is_morsel_driven = node->annotation().token_generator()->is_morsel_driven();
+            const auto end_worker_id = worker_share.first_worker_id() + worker_share.count_workers();
+            for (auto target_worker_id = worker_share.first_worker_id(); target_worker_id < end_worker_id;
+                 ++target_worker_id)
             {
                 auto *spawn_task =
-                    runtime::new_task<SpawnParallelProducingTask<T>>(worker_id, this, node, spawned_worker_counter);
+                    is_morsel_driven
+                        ? static_cast<TaskInterface *>(runtime::new_task<MorselProducingTask<T>>(
+                              worker_id, this, node, spawned_worker_counter))
+                        : static_cast<TaskInterface *>(runtime::new_task<SpawnParallelProducingTask<T>>(
+                              worker_id, this, node, worker_share, target_worker_id, spawned_worker_counter));
 
                 spawn_task->annotate(std::uint16_t(target_worker_id));
+                spawn_task->annotate(this->_priority);
                 runtime::spawn(*spawn_task, worker_id);
             }
         }
         else if (node->annotation().is_producing()) /// Produce sequential.
         {
             auto *source_task = runtime::new_task<SequentialProducingTask<T>>(worker_id, this, node);
+            source_task->annotate(this->_priority);
             runtime::spawn(*source_task, worker_id);
         }
         else
@@ -592,47 +1011,58 @@ public:
     }
 };
 
-template <typename T> class ParallelCompletionTask final : public AbstractFinalizeTask<T>
+/**
+ * Completes a node with a completion callback: Every round visits the workers
+ * of the finalize sequence along a reduction tree (without reducing any data)
+ * and asks the callback afterwards; the node completes when the callback does.
+ * The reducer frees itself when the node completed.
+ */
+template <typename T> class CompletionReducer final : public ReducerInterface
 {
 public:
-    ParallelCompletionTask(Graph<T> *graph, NodeInterface<T> *node,
-                           std::atomic_uint16_t *count_finalized_cores) noexcept
-        : AbstractFinalizeTask<T>(graph, node), _count_finalized_workers(count_finalized_cores)
+    constexpr CompletionReducer(Graph<T> *graph, NodeInterface<T> *node) noexcept : _graph(graph), _node(node) {}
+
+    ~CompletionReducer() noexcept override = default;
+
+    /**
+     * Starts a round visiting the workers of the finalize sequence.
+     *
+     * @param worker_id Worker starting the round.
+     */
+    void start(const std::uint16_t worker_id)
     {
+        const auto &finalize_sequence = _node->annotation().finalize_sequence();
+        auto worker_ids = std::vector<std::uint16_t>{};
+        worker_ids.reserve(finalize_sequence.size());
+        std::transform(finalize_sequence.begin(), finalize_sequence.end(), std::back_inserter(worker_ids),
+                       [](const auto resource) { return resource.worker_id(); });
+
+        Reduction::start(worker_id, std::move(worker_ids), *this, _graph->priority());
     }
 
-    ~ParallelCompletionTask() noexcept override = default;
+    void reduce(const std::uint16_t /*worker_id*/, const std::size_t /*target*/,
+                const std::size_t /*source*/) override
+    {
+    }
 
-    TaskResult execute(const std::uint16_t worker_id) override
+    void reduced(const std::uint16_t worker_id, const std::size_t /*root*/) override
     {
-        const auto is_last = _count_finalized_workers->fetch_sub(1U) == 1U;
-        if (is_last)
+        if (_node->annotation().completion_callback()->is_complete())
         {
-            const auto is_completed = this->_node->annotation().completion_callback()->is_complete();
-            if (is_completed)
-            {
-                std::free(_count_finalized_workers);
-                AbstractFinalizeTask<T>::complete(worker_id);
-            }
-            else
-            {
-                _count_finalized_workers->store(this->_node->annotation().finalize_sequence().size());
-                for (const auto finalize_data : this->_node->annotation().finalize_sequence())
-                {
-                    const auto target_worker_id = finalize_data.worker_id();
-                    auto *completion_task = mx::tasking::runtime::new_task<ParallelCompletionTask<T>>(
-                        worker_id, this->_graph, this->_node, _count_finalized_workers);
-                    completion_task->annotate(target_worker_id);
-                    mx::tasking::runtime::spawn(*completion_task, worker_id);
-                }
-            }
+            std::ignore = _graph->complete(worker_id, _node);
+            delete this;
+        }
+        else
+        {
+            this->start(worker_id);
         }
-
-        return TaskResult::make_remove();
     }
 
+    [[nodiscard]] bool is_visit_participants() const noexcept override { return true; }
+
 private:
-    std::atomic_uint16_t *_count_finalized_workers{nullptr};
+    Graph<T> *_graph;
+    NodeInterface<T> *_node;
 };
 
 /**
@@ -662,23 +1092,17 @@ public:
 
         if (is_last)
         {
+            std::free(_count_finalized_workers);
+
             if (this->_node->annotation().has_completion_callback() &&
                 this->_node->annotation().completion_callback()->is_complete() == false)
             {
-                const auto &finalize_sequence = this->_node->annotation().finalize_sequence();
-                _count_finalized_workers->store(finalize_sequence.size());
-                for (const auto finalize_data : finalize_sequence)
-                {
-                    const auto target_worker_id = finalize_data.worker_id();
-                    auto *completion_task = mx::tasking::runtime::new_task<ParallelCompletionTask<T>>(
-                        worker_id, this->_graph, this->_node, _count_finalized_workers);
-                    completion_task->annotate(target_worker_id);
-                    mx::tasking::runtime::spawn(*completion_task, worker_id);
-                }
+                /// Visit every finalizing worker until the node completes.
+                auto *reducer = new CompletionReducer<T>(this->_graph, this->_node);
+                reducer->start(worker_id);
             }
             else
             {
-                std::free(_count_finalized_workers);
                 AbstractFinalizeTask<T>::complete(worker_id);
             }
         }
@@ -690,49 +1114,38 @@ private:
     std::atomic_uint16_t *_count_finalized_workers{nullptr};
 };
 
-template <typename T> class ReduceFinalizeTask final : public AbstractFinalizeTask<T>
+/**
+ * Reduces the worker-local data of a node that finalizes by reduction: Every
+ * step calls finalize() of the node for a pair of resources (target and
+ * reduced resource). Afterwards, the node is finalized on the resource holding
+ * all data. The reducer frees itself when the reduction completed.
+ */
+template <typename T> class FinalizeReducer final : public ReducerInterface
 {
 public:
-    constexpr ReduceFinalizeTask(Graph<T> *graph, NodeInterface<T> *node, const mx::resource::ptr reduced_data) noexcept
-        : AbstractFinalizeTask<T>(graph, node), _reduced_data(reduced_data)
-    {
-    }
+    constexpr FinalizeReducer(Graph<T> *graph, NodeInterface<T> *node) noexcept : _graph(graph), _node(node) {}
 
-    ~ReduceFinalizeTask() noexcept override = default;
+    ~FinalizeReducer() noexcept override = default;
 
-    TaskResult execute(const std::uint16_t worker_id) override
+    void reduce(const std::uint16_t worker_id, const std::size_t target, const std::size_t source) override
     {
-        AbstractFinalizeTask<T>::_node->finalize(worker_id, *AbstractFinalizeTask<T>::_graph, false,
-                                                 this->annotation().resource(), _reduced_data);
-
-        if (auto *next_task = dynamic_cast<ReduceFinalizeTask<T> *>(_follow_up_task))
-        {
-            if (next_task->_pending_preceding_counter.fetch_sub(1U) == 1U)
-            {
-                return TaskResult::make_succeed_and_remove(next_task);
-            }
-        }
-        else if (auto *sequential_finalize_task = dynamic_cast<SequentialFinalizeTask<T> *>(_follow_up_task))
-        {
-            return TaskResult::make_succeed_and_remove(sequential_finalize_task);
-        }
-
-        return TaskResult::make_remove();
+        const auto &finalize_sequence = _node->annotation().finalize_sequence();
+        _node->finalize(worker_id, *_graph, false, finalize_sequence[target], finalize_sequence[source]);
     }
 
-    void follow_up_task(AbstractFinalizeTask<T> *task) noexcept { _follow_up_task = task; }
+    void reduced(const std::uint16_t worker_id, const std::size_t root) override
+    {
+        auto *finalize_task = runtime::new_task<SequentialFinalizeTask<T>>(worker_id, _graph, _node);
+        finalize_task->annotate(_node->annotation().finalize_sequence()[root]);
+        finalize_task->annotate(_graph->priority());
+        runtime::spawn(*finalize_task, worker_id);
 
-    [[nodiscard]] resource::ptr reduced_resource() const noexcept { return _reduced_data; }
+        delete this;
+    }
 
 private:
-    /// The task that will reduce next.
-    AbstractFinalizeTask<T> *_follow_up_task;
-
-    /// The worker id that will be reduced.
-    resource::ptr _reduced_data;
-
-    /// Counts how many reduce tasks are pending.
-    std::atomic_uint8_t _pending_preceding_counter{2U};
+    Graph<T> *_graph;
+    NodeInterface<T> *_node;
 };
 
 /**
@@ -740,15 +1153,35 @@ private:
  */
 template <typename T> TaskResult SequentialProducingTask<T>::execute(const std::uint16_t worker_id)
 {
-    auto sequence = 0ULL;
+    if (this->_data.has_value() == false)
+    {
+        this->_data = this->_node->annotation().token_generator()->generate(worker_id);
+    }
 
-    for (auto &data : this->_node->annotation().token_generator()->generate(worker_id))
+    auto &data = this->_data.value();
+    for (; this->_next_token_index < data.size(); ++this->_next_token_index)
     {
-        this->_node->consume(worker_id, *_graph, std::move(data));
+        /// Skip the remaining data of a graph that became inactive.
+        if (_graph->is_active() == false) [[unlikely]]
+        {
+            break;
+        }
+
+        /// Give the succeeding nodes the chance to catch up; the graph resumes the task.
+        if (_graph->is_throttled(this->_node)) [[unlikely]]
+        {
+            _graph->park(worker_id, this, this->_node);
+            return TaskResult::make_null();
+        }
+
+        auto &token = data[this->_next_token_index];
+        token.annotation().set(_graph->priority());
+        this->_node->consume(worker_id, *_graph, std::move(token));
     }
 
     auto *finalize_task = mx::tasking::runtime::new_task<SequentialFinalizeTask<T>>(worker_id, _graph, _node);
     finalize_task->annotate(worker_id);
+    finalize_task->annotate(_graph->priority());
     return TaskResult::make_succeed_and_remove(finalize_task);
 }
 
@@ -758,65 +1191,102 @@ template <typename T> TaskResult SequentialProducingTask<T>::execute(const std::
  */
 template <typename T> TaskResult ParallelProducingTask<T>::execute(const std::uint16_t worker_id)
 {
-    _node->consume(worker_id, *_graph, Token<T>{std::move(this->_data), this->annotation()});
+    /// Give the succeeding nodes the chance to catch up; the graph
+    /// resumes the task when the pending tokens were processed.
+    if (_graph->is_throttled(_node)) [[unlikely]]
+    {
+        _graph->park(worker_id, this, _node);
+        return TaskResult::make_null();
+    }
+
+    /// The task still counts for finalizing the node when the graph became inactive.
+    if (_graph->is_active()) [[likely]]
+    {
+        _node->consume(worker_id, *_graph, Token<T>{std::move(this->_data), this->annotation()});
+    }
+
+    /// The pulling task holds a reference of the finalize counter; the node cannot be finalized here.
+    auto *morsel_producer = _morsel_producer;
     if (_finalize_counter.tick())
     {
         _graph->finalize(worker_id, _node);
     }
 
+    if (morsel_producer != nullptr)
+    {
+        morsel_producer->processed_token(worker_id);
+    }
+
     return TaskResult::make_remove();
 }
 
-class FinalizeReduceCalculator
+/**
+ * Pulls the next morsel and spawns a producing task for every token, or
+ * releases the reference of this task when the generator is exhausted.
+ */
+template <typename T> TaskResult MorselProducingTask<T>::execute(const std::uint16_t worker_id)
 {
-public:
-    [[nodiscard]] static std::pair<std::vector<std::vector<std::pair<resource::ptr, resource::ptr>>>, resource::ptr>
-    pairs(const std::vector<resource::ptr> &data)
-    {
-        auto pairs = std::vector<std::vector<std::pair<resource::ptr, resource::ptr>>>{};
+    auto &generator = _node->annotation().token_generator();
 
-        auto reduced_data = data;
-        while (reduced_data.size() > 1U)
-        {
-            reduced_data = FinalizeReduceCalculator::reduce(pairs, std::move(reduced_data));
-        }
-
-        return std::make_pair(std::move(pairs), reduced_data.front());
+    /// The task was resumed by the last task of the morsel.
+    if (_count_morsel_tokens > 0U)
+    {
+        generator->processed_morsel(worker_id, _count_morsel_tokens, std::chrono::steady_clock::now() - _morsel_start);
+        _count_morsel_tokens = 0U;
     }
 
-private:
-    [[nodiscard]] static std::vector<mx::resource::ptr> reduce(
-        std::vector<std::vector<std::pair<resource::ptr, resource::ptr>>> &reduce_passes,
-        std::vector<resource::ptr> &&to_reduce)
+    /// Give the succeeding nodes the chance to catch up; the graph resumes the task.
+    if (_graph->is_throttled(_node)) [[unlikely]]
     {
-        /// Pairs to reduce.
-        auto pairs = std::vector<std::pair<mx::resource::ptr, mx::resource::ptr>>{};
-        pairs.reserve(to_reduce.size() / 2U);
+        _graph->park(worker_id, this, _node);
+        return TaskResult::make_null();
+    }
 
-        /// Data that will be reduced in the next step.
-        auto to_reduce_next = std::vector<resource::ptr>{};
-        to_reduce_next.reserve((to_reduce.size() / 2U) + 1U);
+    if (_task_counter == nullptr)
+    {
+        _task_counter = new (std::aligned_alloc(system::cache::line_size(), sizeof(std::atomic_uint64_t)))
+            std::atomic_uint64_t(1U);
+    }
 
-        const auto is_odd = to_reduce.size() % 2U != 0U;
-        for (auto i = 0U; i < to_reduce.size() - static_cast<std::uint16_t>(is_odd); i += 2U)
+    auto morsel = _graph->is_active() ? generator->next_morsel(worker_id) : std::vector<Token<T>>{};
+    if (morsel.empty())
+    {
+        if (ParallelProducingFinalizeCounter{_spawned_worker_counter, _task_counter}.tick())
         {
-            pairs.emplace_back(std::make_pair(to_reduce[i], to_reduce[i + 1U]));
-            to_reduce_next.emplace_back(to_reduce[i]);
+            _graph->finalize(worker_id, _node);
         }
 
-        if (is_odd)
-        {
-            to_reduce_next.emplace_back(to_reduce.back());
-        }
+        return TaskResult::make_remove();
+    }
 
-        if (pairs.empty() == false)
-        {
-            reduce_passes.emplace_back(std::move(pairs));
-        }
+    _task_counter->fetch_add(morsel.size());
+    _count_pending_morsel_tokens.store(morsel.size(), std::memory_order_relaxed);
+    _count_morsel_tokens = morsel.size();
+    _morsel_start = std::chrono::steady_clock::now();
+
+    /// The last task of the morsel resumes this task on the pulling worker, which
+    /// is busy with this execution until the task is suspended.
+    this->annotate(worker_id);
 
-        return to_reduce_next;
+    auto source_tasks = std::vector<TaskInterface *>{};
+    source_tasks.reserve(morsel.size());
+    for (auto &&token : morsel)
+    {
+        auto *source_task = runtime::new_task<ParallelProducingTask<T>>(
+            worker_id, _graph, _node, std::move(token.data()),
+            ParallelProducingFinalizeCounter{_spawned_worker_counter, _task_counter}, this);
+
+        /// The pulling worker processes the morsel; the tile is only a prefetch hint, not routed to its owner.
+        source_task->annotate(token.annotation());
+        source_task->annotate(worker_id);
+        source_task->annotate(mx::tasking::annotation::stealable);
+        source_task->annotate(_graph->priority());
+        source_tasks.emplace_back(source_task);
     }
-};
+    runtime::spawn_batch(source_tasks, worker_id);
+
+    return TaskResult::make_null();
+}
 
 template <typename T> void Graph<T>::finalize(const std::uint16_t worker_id, NodeInterface<T> *node)
 {
@@ -832,86 +1302,17 @@ template <typename T> void Graph<T>::finalize(const std::uint16_t worker_id, Nod
             auto *finalize_task =
                 runtime::new_task<ParallelFinalizeTask<T>>(worker_id, this, node, finalized_worker_counter);
             finalize_task->annotate(data);
+            finalize_task->annotate(this->_priority);
             runtime::spawn(*finalize_task, worker_id);
         }
     }
     else if (finalization_type == annotation<T>::FinalizationType::reduce)
     {
-        /// List of list of resource pairs to reduce.
-        auto reduce_resource_pairs = FinalizeReduceCalculator::pairs(node->annotation().finalize_sequence());
-        auto &pair_lists = std::get<0>(reduce_resource_pairs);
-
-        /// The resource with the final finalization task (that will be a sequential finalization task).
-        const auto last_resource = std::get<1>(reduce_resource_pairs);
-
-        /// Create the last and final finalization task.
-        auto *last_finalization_task = runtime::new_task<SequentialFinalizeTask<T>>(worker_id, this, node);
-        last_finalization_task->annotate(last_resource);
-        if (pair_lists.empty())
-        {
-            runtime::spawn(*last_finalization_task, worker_id);
-            return;
-        }
-
-        /// Reduce tasks, one map (main worker id -> finalization task) per "reduce stage".
-        auto tasks = std::vector<std::unordered_map<resource::ptr, ReduceFinalizeTask<T> *>>{};
-        tasks.reserve(pair_lists.size());
-
-        /// Create all reduce tasks.
-        for (auto &pair_list : pair_lists)
-        {
-            auto task_map = std::unordered_map<resource::ptr, ReduceFinalizeTask<T> *>{};
-            task_map.reserve(pair_list.size());
-
-            for (auto &pair : pair_list)
-            {
-                const auto main_resource = std::get<0>(pair);
-                const auto reduced_resource = std::get<1>(pair);
-                auto *reduce_task = runtime::new_task<ReduceFinalizeTask<T>>(worker_id, this, node, reduced_resource);
-                reduce_task->annotate(main_resource);
-                task_map.insert(std::make_pair(main_resource, reduce_task));
-            }
-
-            tasks.template emplace_back(std::move(task_map));
-        }
-
-        /// Setup the last reduce step.
-        if (auto iterator = tasks.back().find(last_resource); iterator != tasks.back().end())
-        {
-            iterator->second->follow_up_task(last_finalization_task);
-        }
+        /// Reduce the worker-local data along a NUMA-aware tree; the reducer finalizes the node afterwards.
+        auto participants = node->annotation().finalize_sequence();
 
-        /// Setup all follow up tasks.
-        for (auto stage = tasks.size() - 1U; stage > 0U; --stage)
-        {
-            for (auto [main_resource, task] : tasks[stage])
-            {
-                /// The task for the main worker will be in the last stage.
-                if (auto main_resource_task = tasks[stage - 1U].find(main_resource);
-                    main_resource_task != tasks[stage - 1U].end())
-                {
-                    main_resource_task->second->follow_up_task(task);
-                }
-
-                /// The task for the reduced worker may be in any stage before.
-                const auto reduced_resource = task->reduced_resource();
-                for (auto reduced_stage = stage - 1U; reduced_stage >= 0U; --reduced_stage)
-                {
-                    if (auto reduced_resource_task = tasks[reduced_stage].find(reduced_resource);
-                        reduced_resource_task != tasks[reduced_stage].end())
-                    {
-                        reduced_resource_task->second->follow_up_task(task);
-                        break;
-                    }
-                }
-            }
-        }
-
-        /// Spawn tasks of the first stage.
-        for (auto [_, finalization_task] : tasks[0])
-        {
-            runtime::spawn(*finalization_task, worker_id);
-        }
+        auto *reducer = new FinalizeReducer<T>(this, node);
+        Reduction::start(worker_id, std::move(participants), *reducer, this->_priority);
     }
     else if (finalization_type == annotation<T>::FinalizationType::none)
     {
@@ -922,18 +1323,16 @@ template <typename T> void Graph<T>::finalize(const std::uint16_t worker_id, Nod
     {
         auto *finalize_task = runtime::new_task<SequentialFinalizeTask<T>>(worker_id, this, node);
         finalize_task->annotate(mx::tasking::annotation::local);
+        finalize_task->annotate(this->_priority);
         runtime::spawn(*finalize_task, worker_id);
     }
 }
 
 template <typename T> bool Graph<T>::complete(std::uint16_t worker_id, NodeInterface<T> *node)
 {
-    if constexpr (config::is_record_graph_times())
+    if (this->_is_record_times)
     {
-        if (this->_is_record_times)
-        {
-            this->_node_finish_times.insert(std::make_pair(node, std::chrono::system_clock::now()));
-        }
+        this->_node_finish_times.insert(std::make_pair(node, std::chrono::system_clock::now()));
     }
 
     /// Tell the next node, that this node has completed.
@@ -973,8 +1372,8 @@ template <typename T> bool Graph<T>::complete(std::uint16_t worker_id, NodeInter
         for (auto *pipeline : pipelines_to_start)
         {
             this->_pipeline_dependencies.erase(pipeline);
-            this->start(worker_id, pipeline);
         }
+        this->start(worker_id, pipelines_to_start);
 
         this->_pipeline_dependencies_lock.unlock();
     }
@@ -984,6 +1383,7 @@ template <typename T> bool Graph<T>::complete(std::uint16_t worker_id, NodeInter
     {
         if (this->_finished_pipelines.fetch_add(1U) == (this->_pipelines.size() - 1U))
         {
+            runtime::unregister_running_graph();
             delete this;
             return true;
         }
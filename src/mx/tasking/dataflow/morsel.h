@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mx/util/aligned_t.h>
+#include <span>
+#include <vector>
+
+namespace mx::tasking::dataflow {
+/**
+ * Shared cursor over data that is partitioned by NUMA nodes. Workers pull
+ * morsels (ranges of items) from the partition of their own NUMA node and
+ * steal morsels from the partitions of other nodes when their own is
+ * exhausted.
+ */
+template <typename I> class MorselCursor
+{
+public:
+    explicit MorselCursor(std::vector<std::vector<I>> &&items_per_numa_node)
+        : _items(std::move(items_per_numa_node)), _cursors(_items.size())
+    {
+    }
+
+    ~MorselCursor() noexcept = default;
+
+    /**
+     * Hands out the next morsel.
+     *
+     * @param numa_node_id NUMA node of the pulling worker.
+     * @param morsel_size Maximal number of items of the morsel.
+     * @return Items of the morsel; empty when all items were handed out.
+     */
+    [[nodiscard]] std::span<const I> next(const std::uint8_t numa_node_id, const std::uint64_t morsel_size) noexcept
+    {
+        const auto count_numa_nodes = _items.size();
+        for (auto offset = 0U; offset < count_numa_nodes; ++offset)
+        {
+            const auto partition_id = (numa_node_id + offset) % count_numa_nodes;
+            const auto &items = _items[partition_id];
+            auto &cursor = _cursors[partition_id].value();
+
+            /// Avoid contention on exhausted partitions.
+            if (cursor.load(std::memory_order_relaxed) >= items.size())
+            {
+                continue;
+            }
+
+            const auto begin = cursor.fetch_add(morsel_size, std::memory_order_relaxed);
+            if (begin < items.size())
+            {
+                return std::span<const I>{items.data() + begin, std::min(morsel_size, items.size() - begin)};
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * @return Number of all items.
+     */
+    [[nodiscard]] std::uint64_t size() const noexcept
+    {
+        auto size = std::uint64_t(0U);
+        for (const auto &items : _items)
+        {
+            size += items.size();
+        }
+        return size;
+    }
+
+private:
+    /// Items of every NUMA node.
+    std::vector<std::vector<I>> _items;
+
+    /// Next item to hand out, one for every NUMA node.
+    std::vector<util::aligned_t<std::atomic_uint64_t>> _cursors;
+};
+
+/**
+ * Number of items per morsel, adapted to the measured cost of an item
+ * so that processing a morsel takes about the target duration: Short
+ * morsels balance the load between workers, long morsels amortize the
+ * cost of pulling them.
+ */
+class MorselSize
+{
+public:
+    constexpr MorselSize(const std::uint64_t initial_size, const std::uint64_t max_size,
+                         const std::chrono::microseconds target_duration) noexcept
+        : _size(initial_size), _max_size(max_size), _target_duration(target_duration)
+    {
+    }
+
+    ~MorselSize() noexcept = default;
+
+    /**
+     * Limits the size of morsels, e.g., to keep enough morsels for balancing the load at the end.
+     *
+     * @param max_size Maximal number of items per morsel.
+     */
+    void limit(const std::uint64_t max_size) noexcept
+    {
+        _max_size = std::max<std::uint64_t>(max_size, 1U);
+        _size.store(std::min(_size.load(std::memory_order_relaxed), _max_size), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t get() const noexcept { return _size.load(std::memory_order_relaxed); }
+
+    /**
+     * Adapts the size to the time a worker needed for a morsel.
+     *
+     * @param count_items Number of items of the processed morsel.
+     * @param duration Time needed to process the morsel.
+     */
+    void update(const std::uint64_t count_items, const std::chrono::nanoseconds duration) noexcept
+    {
+        if (count_items == 0U || duration.count() <= 0)
+        {
+            return;
+        }
+
+        const auto nanoseconds_per_item = std::max<std::uint64_t>(std::uint64_t(duration.count()) / count_items, 1U);
+        const auto target_nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(_target_duration).count();
+        const auto ideal_size = std::clamp<std::uint64_t>(target_nanoseconds / nanoseconds_per_item, 1U, _max_size);
+
+        /// Smooth the size since single measurements may be noisy.
+        const auto size = (_size.load(std::memory_order_relaxed) + ideal_size + 1U) / 2U;
+        _size.store(std::min(size, _max_size), std::memory_order_relaxed);
+    }
+
+private:
+    /// Current number of items per morsel; updated by all workers without synchronization.
+    std::atomic_uint64_t _size;
+
+    /// Upper bound of the morsel size.
+    std::uint64_t _max_size;
+
+    /// Time a worker should need to process a morsel.
+    std::chrono::microseconds _target_duration;
+};
+} // namespace mx::tasking::dataflow
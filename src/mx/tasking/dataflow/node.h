@@ -93,6 +93,18 @@ public:
 
     [[nodiscard]] virtual std::uint64_t trace_id() const noexcept { return 0U; }
 
+    /**
+     * @return Number of tokens consumed by the node that are not processed, yet.
+     *  Nodes that process tokens immediately within consume() have no pending tokens.
+     */
+    [[nodiscard]] virtual std::uint64_t count_pending_tokens() const noexcept { return 0U; }
+
+    /**
+     * @return True, if the node can not take further tokens for now (e.g., its output
+     *  waits for a slow client). Producers are throttled independent of backpressure.
+     */
+    [[nodiscard]] virtual bool is_congested() const noexcept { return false; }
+
 private:
     /// Node where data is emitted to.
     NodeInterface<T> *_out{nullptr};
@@ -25,6 +25,6 @@ public:
 
 private:
     std::vector<NodeInterface<T> *> _nodes;
-    alignas(64) std::atomic_uint16_t _finalization_barrier_counter;
+    alignas(64) std::atomic_uint16_t _finalization_barrier_counter{0U};
 };
 } // namespace mx::tasking::dataflow
\ No newline at end of file
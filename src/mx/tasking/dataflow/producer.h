@@ -2,6 +2,8 @@
 
 #include "token.h"
 #include <cstdint>
+#include <mx/memory/slab_allocator.h>
+#include <mx/tasking/priority.h>
 
 namespace mx::tasking::dataflow {
 template <typename T> class NodeInterface;
@@ -15,5 +17,23 @@ public:
     virtual void finalize(std::uint16_t worker_id, NodeInterface<T> *node) = 0;
     virtual void interrupt() = 0;
     virtual void for_each_node(std::function<void(NodeInterface<T> *)> &&callback) const = 0;
+
+    /**
+     * @return Priority of all tasks that are spawned on behalf of the emitter.
+     */
+    [[nodiscard]] virtual enum priority priority() const noexcept { return priority::normal; }
+
+    /**
+     * Resumes producers that paused until the succeeding nodes caught up,
+     * if they caught up by now. Called whenever a node processed tokens.
+     *
+     * @param worker_id Worker where the tokens were processed.
+     */
+    virtual void resume_producers(const std::uint16_t /*worker_id*/) {}
+
+    /**
+     * @return Arena for temporary data of the emitter, or nullptr if the emitter has none.
+     */
+    [[nodiscard]] virtual memory::slab::Arena *slab_arena() const noexcept { return nullptr; }
 };
 } // namespace mx::tasking::dataflow
\ No newline at end of file
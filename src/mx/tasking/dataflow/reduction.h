@@ -0,0 +1,497 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mx/resource/ptr.h>
+#include <mx/tasking/config.h>
+#include <mx/tasking/priority.h>
+#include <mx/tasking/runtime.h>
+#include <mx/tasking/task.h>
+#include <optional>
+#include <vector>
+
+namespace mx::tasking::dataflow {
+/**
+ * Shape of a reduction of worker-local data (participants) into a single
+ * participant. Every step reduces up to fanout-1 sources into a target.
+ * Participants are reduced on their NUMA node first; only one participant
+ * per node takes part in the reduction across nodes.
+ */
+class ReductionTree
+{
+public:
+    class Step
+    {
+    public:
+        explicit Step(const std::size_t target) noexcept : _target(target) {}
+        ~Step() noexcept = default;
+
+        [[nodiscard]] std::size_t target() const noexcept { return _target; }
+        [[nodiscard]] const std::vector<std::size_t> &sources() const noexcept { return _sources; }
+
+        /**
+         * @return The step that has to wait for this step, none for the last step.
+         */
+        [[nodiscard]] std::optional<std::size_t> parent() const noexcept { return _parent; }
+
+        /**
+         * @return Number of steps that have to finish before this step.
+         */
+        [[nodiscard]] std::uint16_t count_children() const noexcept { return _count_children; }
+
+    private:
+        friend ReductionTree;
+
+        /// Participant the sources are reduced into.
+        std::size_t _target;
+
+        /// Participants reduced by this step.
+        std::vector<std::size_t> _sources;
+
+        /// Step reducing the target of this step (or into it), if any.
+        std::optional<std::size_t> _parent{std::nullopt};
+
+        /// Number of preceding steps.
+        std::uint16_t _count_children{0U};
+    };
+
+    /**
+     * @param numa_node_ids NUMA node of every participant.
+     * @param fanout Number of participants reduced by one step (at least two).
+     */
+    ReductionTree(const std::vector<std::uint8_t> &numa_node_ids, const std::uint16_t fanout)
+    {
+        const auto count_participants = numa_node_ids.size();
+        if (count_participants == 0U)
+        {
+            return;
+        }
+
+        /// Participants grouped by their NUMA node, keeping their order.
+        const auto max_numa_node_id = *std::max_element(numa_node_ids.begin(), numa_node_ids.end());
+        auto numa_node_participants = std::vector<std::vector<std::size_t>>(max_numa_node_id + 1U);
+        for (auto participant = 0U; participant < count_participants; ++participant)
+        {
+            numa_node_participants[numa_node_ids[participant]].emplace_back(participant);
+        }
+
+        auto last_steps = std::vector<std::optional<std::size_t>>(count_participants, std::nullopt);
+        const auto effective_fanout = std::max<std::uint16_t>(fanout, 2U);
+
+        auto numa_node_roots = std::vector<std::size_t>{};
+        for (auto &participants : numa_node_participants)
+        {
+            if (participants.empty() == false)
+            {
+                numa_node_roots.emplace_back(this->reduce(std::move(participants), effective_fanout, last_steps));
+            }
+        }
+
+        _root = this->reduce(std::move(numa_node_roots), effective_fanout, last_steps);
+    }
+
+    ~ReductionTree() noexcept = default;
+
+    /**
+     * @return All steps; children are listed before their parents.
+     */
+    [[nodiscard]] const std::vector<Step> &steps() const noexcept { return _steps; }
+
+    /**
+     * @return Participant holding the reduced data after the last step.
+     */
+    [[nodiscard]] std::size_t root() const noexcept { return _root; }
+
+private:
+    std::vector<Step> _steps;
+    std::size_t _root{0U};
+
+    /**
+     * Reduces the given participants level by level into the first one.
+     *
+     * @param participants Participants to reduce.
+     * @param fanout Number of participants reduced by one step.
+     * @param last_steps Last step of every participant, used to link steps to their parents.
+     * @return The participant holding the reduced data.
+     */
+    std::size_t reduce(std::vector<std::size_t> &&participants, const std::uint16_t fanout,
+                       std::vector<std::optional<std::size_t>> &last_steps)
+    {
+        while (participants.size() > 1U)
+        {
+            auto survivors = std::vector<std::size_t>{};
+            survivors.reserve((participants.size() + fanout - 1U) / fanout);
+
+            for (auto begin = 0U; begin < participants.size(); begin += fanout)
+            {
+                const auto end = std::min<std::size_t>(begin + fanout, participants.size());
+                const auto target = participants[begin];
+                survivors.emplace_back(target);
+                if (end - begin == 1U)
+                {
+                    continue;
+                }
+
+                const auto step_id = _steps.size();
+                auto &step = _steps.emplace_back(target);
+                for (auto index = begin; index < end; ++index)
+                {
+                    const auto participant = participants[index];
+                    if (participant != target)
+                    {
+                        step._sources.emplace_back(participant);
+                    }
+
+                    if (const auto last_step = last_steps[participant]; last_step.has_value())
+                    {
+                        _steps[last_step.value()]._parent = step_id;
+                        ++step._count_children;
+                    }
+                }
+                last_steps[target] = step_id;
+            }
+
+            participants = std::move(survivors);
+        }
+
+        return participants.front();
+    }
+};
+
+/**
+ * Reduces worker-local data, e.g., merging aggregation or hash tables,
+ * concatenating results, or merging statistics.
+ */
+class ReducerInterface
+{
+public:
+    constexpr ReducerInterface() noexcept = default;
+    virtual ~ReducerInterface() noexcept = default;
+
+    /**
+     * Reduces the data of the source into the target. Called on the worker of the target.
+     *
+     * @param worker_id Worker executing the reduction.
+     * @param target Participant holding the reduced data.
+     * @param source Participant that is reduced; the data is no longer used afterwards.
+     */
+    virtual void reduce(std::uint16_t worker_id, std::size_t target, std::size_t source) = 0;
+
+    /**
+     * Called once after all data was reduced into the root.
+     *
+     * @param worker_id Worker executing the last step.
+     * @param root Participant holding all reduced data.
+     */
+    virtual void reduced(std::uint16_t worker_id, std::size_t root) = 0;
+
+    /**
+     * Reducers that depend on tasks dispatched to the workers of the participants
+     * before the reduction (e.g., tasks flushing worker-local buffers) let the
+     * reduction visit every participant first: A step starts after a task was
+     * executed on the worker of each of its sources.
+     *
+     * @return True, if the reduction visits the participants.
+     */
+    [[nodiscard]] virtual bool is_visit_participants() const noexcept { return false; }
+};
+
+/**
+ * Executes a reduction tree by tasks: Every step is executed where the data
+ * of its target lives as soon as all preceding steps finished; steps on
+ * different workers (and NUMA nodes) run in parallel. The reduction frees
+ * itself after the last step.
+ */
+class Reduction
+{
+public:
+    /**
+     * Starts the reduction of the given worker-local data. Steps are annotated
+     * with the resource of their target, so the scheduler dispatches (and
+     * synchronizes) them like any other task accessing that resource.
+     *
+     * @param worker_id Worker starting the reduction.
+     * @param participants Resource of every participant.
+     * @param reducer Reducer of the data; has to outlive the reduction.
+     * @param priority Priority of the reduction tasks.
+     * @param fanout Number of participants reduced by one step.
+     */
+    static void start(const std::uint16_t worker_id, std::vector<resource::ptr> &&participants,
+                      ReducerInterface &reducer, const enum priority priority = priority::normal,
+                      const std::uint16_t fanout = config::reduction_fanout())
+    {
+        if (participants.empty() || (participants.size() == 1U && reducer.is_visit_participants() == false))
+        {
+            reducer.reduced(worker_id, 0U);
+            return;
+        }
+
+        auto *reduction = new Reduction(std::move(participants), reducer, priority, fanout);
+        reduction->start(worker_id);
+    }
+
+    /**
+     * Starts the reduction of data that is local to the given workers,
+     * without a resource to annotate.
+     *
+     * @param worker_id Worker starting the reduction.
+     * @param worker_ids Worker of every participant.
+     * @param reducer Reducer of the data; has to outlive the reduction.
+     * @param priority Priority of the reduction tasks.
+     * @param fanout Number of participants reduced by one step.
+     */
+    static void start(const std::uint16_t worker_id, std::vector<std::uint16_t> &&worker_ids,
+                      ReducerInterface &reducer, const enum priority priority = priority::normal,
+                      const std::uint16_t fanout = config::reduction_fanout())
+    {
+        auto participants = std::vector<resource::ptr>{};
+        participants.reserve(worker_ids.size());
+        std::transform(worker_ids.begin(), worker_ids.end(), std::back_inserter(participants),
+                       [](const auto participant_worker_id) {
+                           return resource::ptr{nullptr,
+                                                resource::information{participant_worker_id,
+                                                                      synchronization::primitive::None}};
+                       });
+
+        Reduction::start(worker_id, std::move(participants), reducer, priority, fanout);
+    }
+
+    ~Reduction() noexcept = default;
+
+    /**
+     * Executes a step and starts the parent step when this was the last child.
+     *
+     * @param worker_id Worker executing the step.
+     * @param step_id Step to execute.
+     * @return The parent step, if it can be executed now.
+     */
+    [[nodiscard]] TaskInterface *execute(std::uint16_t worker_id, std::size_t step_id);
+
+    /**
+     * Called when the worker of a participant was visited (see ReducerInterface::is_visit_participants()).
+     *
+     * @param worker_id Worker of the visited participant.
+     * @param step_id Step reducing the participant, none if the participant is the only one.
+     * @return The step, if it can be executed now.
+     */
+    [[nodiscard]] TaskInterface *visited(std::uint16_t worker_id, std::optional<std::size_t> step_id);
+
+private:
+    Reduction(std::vector<resource::ptr> &&participants, ReducerInterface &reducer, const enum priority priority,
+              const std::uint16_t fanout)
+        : _participants(std::move(participants)), _tree(Reduction::numa_node_ids(_participants), fanout),
+          _pending_children(std::make_unique<std::atomic_uint16_t[]>(_tree.steps().size())), _reducer(reducer),
+          _priority(priority)
+    {
+        for (auto step_id = 0U; step_id < _tree.steps().size(); ++step_id)
+        {
+            auto count_pending = _tree.steps()[step_id].count_children();
+            if (_reducer.is_visit_participants())
+            {
+                count_pending += this->unvisited_sources(step_id).size();
+            }
+            _pending_children[step_id].store(count_pending, std::memory_order_relaxed);
+        }
+    }
+
+    /// Resource (and worker) of every participant.
+    std::vector<resource::ptr> _participants;
+
+    /// Steps of the reduction.
+    ReductionTree _tree;
+
+    /// Number of children (and participants to visit) that did not finish, yet, for every step.
+    std::unique_ptr<std::atomic_uint16_t[]> _pending_children;
+
+    ReducerInterface &_reducer;
+
+    enum priority _priority;
+
+    void start(std::uint16_t worker_id);
+
+    [[nodiscard]] TaskInterface *make_task(std::uint16_t worker_id, std::size_t step_id);
+
+    /**
+     * Sources of a step that are not the target of a preceding step; no step
+     * of the reduction is executed on their worker before this step.
+     *
+     * @param step_id Step.
+     * @return Participants of the step that have to be visited.
+     */
+    [[nodiscard]] std::vector<std::size_t> unvisited_sources(const std::size_t step_id) const
+    {
+        auto sources = std::vector<std::size_t>{};
+        for (const auto source : _tree.steps()[step_id].sources())
+        {
+            const auto is_target = std::any_of(_tree.steps().begin(), _tree.steps().begin() + step_id,
+                                               [source](const auto &step) { return step.target() == source; });
+            if (is_target == false)
+            {
+                sources.emplace_back(source);
+            }
+        }
+
+        return sources;
+    }
+
+    [[nodiscard]] static std::vector<std::uint8_t> numa_node_ids(const std::vector<resource::ptr> &participants)
+    {
+        auto numa_node_ids = std::vector<std::uint8_t>{};
+        numa_node_ids.reserve(participants.size());
+        std::transform(participants.begin(), participants.end(), std::back_inserter(numa_node_ids),
+                       [](const auto participant) { return runtime::numa_node_id(participant.worker_id()); });
+        return numa_node_ids;
+    }
+};
+
+/**
+ * Executes a single step of a reduction.
+ */
+class ReductionTask final : public TaskInterface
+{
+public:
+    constexpr ReductionTask(Reduction *reduction, const std::size_t step_id) noexcept
+        : _reduction(reduction), _step_id(step_id)
+    {
+    }
+    ~ReductionTask() noexcept override = default;
+
+    TaskResult execute(const std::uint16_t worker_id) override
+    {
+        if (auto *parent_task = _reduction->execute(worker_id, _step_id); parent_task != nullptr)
+        {
+            return TaskResult::make_succeed_and_remove(parent_task);
+        }
+
+        return TaskResult::make_remove();
+    }
+
+private:
+    Reduction *_reduction;
+    std::size_t _step_id;
+};
+
+/**
+ * Visits the worker of a participant before the participant is reduced.
+ */
+class ReductionVisitTask final : public TaskInterface
+{
+public:
+    constexpr ReductionVisitTask(Reduction *reduction, const std::optional<std::size_t> step_id) noexcept
+        : _reduction(reduction), _step_id(step_id)
+    {
+    }
+    ~ReductionVisitTask() noexcept override = default;
+
+    TaskResult execute(const std::uint16_t worker_id) override
+    {
+        if (auto *step_task = _reduction->visited(worker_id, _step_id); step_task != nullptr)
+        {
+            return TaskResult::make_succeed_and_remove(step_task);
+        }
+
+        return TaskResult::make_remove();
+    }
+
+private:
+    Reduction *_reduction;
+    std::optional<std::size_t> _step_id;
+};
+
+inline void Reduction::start(const std::uint16_t worker_id)
+{
+    auto tasks = std::vector<TaskInterface *>{};
+    const auto make_visit_task = [this, worker_id](const std::size_t participant,
+                                                   const std::optional<std::size_t> step_id) {
+        auto *task = runtime::new_task<ReductionVisitTask>(worker_id, this, step_id);
+        task->annotate(_participants[participant].worker_id());
+        task->annotate(_priority);
+        return task;
+    };
+
+    /// A single participant is visited before it is handed to the reducer.
+    if (_tree.steps().empty())
+    {
+        tasks.emplace_back(make_visit_task(_tree.root(), std::nullopt));
+    }
+
+    for (auto step_id = 0U; step_id < _tree.steps().size(); ++step_id)
+    {
+        if (_reducer.is_visit_participants())
+        {
+            for (const auto source : this->unvisited_sources(step_id))
+            {
+                tasks.emplace_back(make_visit_task(source, step_id));
+            }
+        }
+
+        if (_pending_children[step_id].load(std::memory_order_relaxed) == 0U)
+        {
+            tasks.emplace_back(this->make_task(worker_id, step_id));
+        }
+    }
+
+    runtime::spawn_batch(tasks, worker_id);
+}
+
+inline TaskInterface *Reduction::visited(const std::uint16_t worker_id, const std::optional<std::size_t> step_id)
+{
+    if (step_id.has_value() == false)
+    {
+        _reducer.reduced(worker_id, _tree.root());
+        delete this;
+        return nullptr;
+    }
+
+    if (_pending_children[step_id.value()].fetch_sub(1U) == 1U)
+    {
+        return this->make_task(worker_id, step_id.value());
+    }
+
+    return nullptr;
+}
+
+inline TaskInterface *Reduction::execute(const std::uint16_t worker_id, const std::size_t step_id)
+{
+    const auto &step = _tree.steps()[step_id];
+    for (const auto source : step.sources())
+    {
+        _reducer.reduce(worker_id, step.target(), source);
+    }
+
+    if (const auto parent_id = step.parent(); parent_id.has_value())
+    {
+        if (_pending_children[parent_id.value()].fetch_sub(1U) == 1U)
+        {
+            return this->make_task(worker_id, parent_id.value());
+        }
+
+        return nullptr;
+    }
+
+    /// This was the last step.
+    _reducer.reduced(worker_id, _tree.root());
+    delete this;
+    return nullptr;
+}
+
+inline TaskInterface *Reduction::make_task(const std::uint16_t worker_id, const std::size_t step_id)
+{
+    auto *task = runtime::new_task<ReductionTask>(worker_id, this, step_id);
+
+    /// Keep the annotation of the target resource (e.g., its synchronization), the worker otherwise.
+    const auto target = _participants[_tree.steps()[step_id].target()];
+    if (target != nullptr)
+    {
+        task->annotate(target);
+    }
+    else
+    {
+        task->annotate(target.worker_id());
+    }
+    task->annotate(_priority);
+    return task;
+}
+} // namespace mx::tasking::dataflow
@@ -1,11 +1,12 @@
 #pragma once
 
-#include "barrier_task.h"
 #include "node.h"
 #include "producer.h"
 #include "token.h"
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <mx/tasking/config.h>
 #include <mx/tasking/runtime.h>
 #include <mx/tasking/task.h>
 #include <mx/util/aligned_t.h>
@@ -71,7 +72,10 @@ public:
     void consume(std::uint16_t worker_id, EmitterInterface<value_type> &graph, Token<value_type> &&token) override;
 
     /**
-     * Called whenever the succeeding node was finalized.
+     * Called whenever the succeeding node was finalized. When the last incoming
+     * node completed, the reference of the incoming nodes is released; the node
+     * finalizes as soon as all consumed tokens are processed, regardless of the
+     * workers that executed (or stole) their tasks.
      *
      * @param worker_id Core where consume is called.
      * @param graph Graph where the node is located in.
@@ -81,15 +85,7 @@ public:
     {
         if (_count_nodes_in.fetch_sub(1) == 1)
         {
-            const auto count_workers = mx::tasking::runtime::workers();
-            _count_pending_workers = count_workers - 1;
-            for (auto target_worker_id = std::uint16_t(0U); target_worker_id < count_workers; ++target_worker_id)
-            {
-                auto *barrier_task = mx::tasking::runtime::new_task<FinalizationBarrierTask<value_type>>(
-                    worker_id, _count_pending_workers, graph, this);
-                barrier_task->annotate(target_worker_id);
-                mx::tasking::runtime::spawn(*barrier_task, worker_id);
-            }
+            this->processed(worker_id, graph);
         }
     }
 
@@ -98,9 +94,36 @@ public:
         return std::string{"Task Skeleton ["} + typeid(DataTask).name() + "]";
     }
 
+    [[nodiscard]] std::uint64_t count_pending_tokens() const noexcept override
+    {
+        const auto count_pending = _count_pending_tokens.load();
+        return count_pending > 0U ? count_pending - 1U : 0U;
+    }
+
 private:
     std::atomic_int16_t _count_nodes_in{0U};
-    std::atomic_int16_t _count_pending_workers{0U};
+
+    /// Tokens consumed by spawning a task that did not execute, yet, and
+    /// one reference held until all incoming nodes completed.
+    alignas(64) std::atomic_uint64_t _count_pending_tokens{1U};
+
+    /**
+     * Releases a pending token (or the reference of the incoming nodes)
+     * and finalizes the node when it was the last one.
+     *
+     * @param worker_id Worker that processed the token.
+     * @param graph Graph where the node is located in.
+     */
+    void processed(const std::uint16_t worker_id, EmitterInterface<value_type> &graph)
+    {
+        /// Producers paused by this node may continue; the graph is alive while the token is pending.
+        graph.resume_producers(worker_id);
+
+        if (_count_pending_tokens.fetch_sub(1U) == 1U)
+        {
+            graph.finalize(worker_id, this);
+        }
+    }
 };
 
 /**
@@ -122,6 +145,8 @@ public:
         DataTask{}.execute(worker_id, _owning_node, _graph,
                            Token<typename DataTask::value_type>{std::move(_token_data), annotation()});
 
+        _owning_node->processed(worker_id, _graph);
+
         return TaskResult::make_remove();
     }
 
@@ -144,6 +169,9 @@ void TaskNode<DataTask>::consume(const std::uint16_t worker_id, EmitterInterface
     auto *node_task = runtime::new_task<NodeTask<DataTask>>(worker_id, this, graph, std::move(token));
     node_task->annotate(annotation);
 
+    /// The node finalizes when all pending tokens are processed; tasks may be stolen by any worker.
+    _count_pending_tokens.fetch_add(1U, std::memory_order_relaxed);
+
     runtime::spawn(*node_task, worker_id);
 }
 } // namespace mx::tasking::dataflow
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "token.h"
+#include <chrono>
 #include <cstdint>
 #include <mx/tasking/prefetch_descriptor.h>
 #include <vector>
@@ -14,5 +15,32 @@ public:
 
     [[nodiscard]] virtual std::vector<Token<T>> generate(std::uint16_t worker_id) = 0;
     [[nodiscard]] virtual std::uint64_t count() = 0;
+
+    /**
+     * Morsel-driven generators hand out small morsels of the data on demand:
+     * Workers pull morsels until the generator is exhausted, instead of
+     * receiving a static partition of the data by generate().
+     *
+     * @return True, if the data should be pulled by next_morsel().
+     */
+    [[nodiscard]] virtual bool is_morsel_driven() const noexcept { return false; }
+
+    /**
+     * @param worker_id Worker pulling the morsel.
+     * @return The next morsel, preferably local to the worker; empty when all data was handed out.
+     */
+    [[nodiscard]] virtual std::vector<Token<T>> next_morsel(std::uint16_t /*worker_id*/) { return {}; }
+
+    /**
+     * Reports the time a worker needed to process a morsel, used to adapt the size of morsels.
+     *
+     * @param worker_id Worker that processed the morsel.
+     * @param count_tokens Number of tokens of the morsel.
+     * @param duration Time needed to process the morsel.
+     */
+    virtual void processed_morsel(std::uint16_t /*worker_id*/, std::uint64_t /*count_tokens*/,
+                                  std::chrono::nanoseconds /*duration*/)
+    {
+    }
 };
 } // namespace mx::tasking::dataflow
\ No newline at end of file
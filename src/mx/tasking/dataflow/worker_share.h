@@ -0,0 +1,129 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace mx::tasking::dataflow {
+/**
+ * Range of workers that produce the data of a pipeline. Pipelines that
+ * run at the same time share the workers; the data partitions of all
+ * workers are mapped to the workers of the share.
+ */
+class WorkerShare
+{
+public:
+    constexpr WorkerShare(const std::uint16_t first_worker_id, const std::uint16_t count_workers) noexcept
+        : _first_worker_id(first_worker_id), _count_workers(count_workers)
+    {
+    }
+    constexpr WorkerShare(const WorkerShare &) noexcept = default;
+    ~WorkerShare() noexcept = default;
+
+    WorkerShare &operator=(const WorkerShare &) noexcept = default;
+
+    /**
+     * Splits the workers between pipelines that are started at the same time,
+     * proportional to the estimated work of the pipelines. Every pipeline with
+     * work receives at least one worker; pipelines without work (e.g., those
+     * producing sequentially) keep all workers.
+     *
+     * @param work Estimated work (e.g., number of tiles to scan) for every pipeline.
+     * @param count_workers Number of workers to split.
+     * @return One share for every pipeline.
+     */
+    [[nodiscard]] static std::vector<WorkerShare> allocate(const std::vector<std::uint64_t> &work,
+                                                           const std::uint16_t count_workers)
+    {
+        auto shares = std::vector<WorkerShare>(work.size(), WorkerShare{0U, count_workers});
+
+        auto working_pipelines = std::vector<std::size_t>{};
+        working_pipelines.reserve(work.size());
+        for (auto index = 0U; index < work.size(); ++index)
+        {
+            if (work[index] > 0U)
+            {
+                working_pipelines.emplace_back(index);
+            }
+        }
+
+        if (working_pipelines.size() < 2U || count_workers == 0U)
+        {
+            return shares;
+        }
+
+        /// More pipelines than workers: Every pipeline gets a single worker.
+        if (working_pipelines.size() >= count_workers)
+        {
+            for (auto index = 0U; index < working_pipelines.size(); ++index)
+            {
+                shares[working_pipelines[index]] = WorkerShare{std::uint16_t(index % count_workers), 1U};
+            }
+            return shares;
+        }
+
+        /// Every pipeline gets one worker, the remaining workers are split by the largest remainder.
+        const auto total_work =
+            std::accumulate(working_pipelines.begin(), working_pipelines.end(), 0.0,
+                            [&work](const auto sum, const auto index) { return sum + double(work[index]); });
+        const auto spare_workers = count_workers - working_pipelines.size();
+
+        auto counts = std::vector<std::uint16_t>(working_pipelines.size(), 1U);
+        auto remainders = std::vector<double>(working_pipelines.size(), 0.0);
+        auto assigned_workers = std::uint16_t(working_pipelines.size());
+        for (auto index = 0U; index < working_pipelines.size(); ++index)
+        {
+            const auto quota = spare_workers * (double(work[working_pipelines[index]]) / total_work);
+            const auto count = std::uint16_t(quota);
+            counts[index] += count;
+            remainders[index] = quota - count;
+            assigned_workers += count;
+        }
+
+        auto by_remainder = std::vector<std::size_t>(working_pipelines.size());
+        std::iota(by_remainder.begin(), by_remainder.end(), 0U);
+        std::stable_sort(by_remainder.begin(), by_remainder.end(), [&remainders](const auto left, const auto right) {
+            return remainders[left] > remainders[right];
+        });
+        for (auto index = 0U; assigned_workers < count_workers; ++index, ++assigned_workers)
+        {
+            ++counts[by_remainder[index % by_remainder.size()]];
+        }
+
+        /// Pipelines get contiguous ranges of workers, keeping the workers of a share on few NUMA nodes.
+        auto first_worker_id = std::uint16_t(0U);
+        for (auto index = 0U; index < working_pipelines.size(); ++index)
+        {
+            shares[working_pipelines[index]] = WorkerShare{first_worker_id, counts[index]};
+            first_worker_id += counts[index];
+        }
+
+        return shares;
+    }
+
+    [[nodiscard]] std::uint16_t first_worker_id() const noexcept { return _first_worker_id; }
+    [[nodiscard]] std::uint16_t count_workers() const noexcept { return _count_workers; }
+
+    /**
+     * Maps a data partition to the worker of the share that produces the partition.
+     * Neighboring partitions are mapped to the same worker.
+     *
+     * @param partition_id Id of the partition (the worker id the data is partitioned by).
+     * @param count_partitions Number of partitions (i.e., all workers).
+     * @return Id of the worker producing the partition.
+     */
+    [[nodiscard]] std::uint16_t worker_id(const std::uint16_t partition_id,
+                                          const std::uint16_t count_partitions) const noexcept
+    {
+        return _first_worker_id + std::uint16_t((std::uint32_t(partition_id) * _count_workers) / count_partitions);
+    }
+
+private:
+    /// First worker of the share.
+    std::uint16_t _first_worker_id;
+
+    /// Number of (contiguous) workers of the share.
+    std::uint16_t _count_workers;
+};
+} // namespace mx::tasking::dataflow
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mx/system/builtin.h>
+
+namespace mx::tasking {
+/**
+ * The idle backoff controls how a worker waits for new tasks
+ * when its task pool is empty: First, the worker spins for a
+ * few rounds to catch short gaps between tasks. Afterwards,
+ * the number of pause instructions per round grows exponentially.
+ * Finally, the worker should be parked until new tasks arrive.
+ */
+class IdleBackoff
+{
+public:
+    constexpr IdleBackoff() noexcept = default;
+    ~IdleBackoff() noexcept = default;
+
+    /**
+     * Waits for a single round.
+     *
+     * @return True, when the worker waited long enough and should be parked.
+     */
+    [[nodiscard]] bool wait() noexcept
+    {
+        if (_round < IdleBackoff::spin_rounds())
+        {
+            system::builtin::pause();
+            ++_round;
+            return false;
+        }
+
+        if (_round < IdleBackoff::spin_rounds() + IdleBackoff::backoff_rounds())
+        {
+            const auto count_pauses = 2U << (_round - IdleBackoff::spin_rounds());
+            for (auto i = 0U; i < count_pauses; ++i)
+            {
+                system::builtin::pause();
+            }
+            ++_round;
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Resets the backoff after the worker found tasks.
+     */
+    void reset() noexcept { _round = 0U; }
+
+    /**
+     * @return Time a parked worker sleeps before checking its task pool, even when not woken up.
+     */
+    [[nodiscard]] static constexpr std::chrono::microseconds park_timeout() { return std::chrono::milliseconds(10U); }
+
+private:
+    /// Number of rounds with a single pause instruction.
+    [[nodiscard]] static constexpr std::uint32_t spin_rounds() { return 64U; }
+
+    /// Number of rounds with exponentially growing pauses.
+    [[nodiscard]] static constexpr std::uint32_t backoff_rounds() { return 10U; }
+
+    std::uint32_t _round{0U};
+};
+} // namespace mx::tasking
@@ -0,0 +1,234 @@
+#pragma once
+
+#include "config.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <tsl/robin_map.h>
+
+namespace mx::tasking {
+/**
+ * Feedback controller that tunes the prefetch distance for every task type (trace id).
+ * The first distance of a task type is estimated from the cycles of the tasks in front
+ * of it (see TaskExecutionTimeHistory). Afterward, the controller measures the cycles
+ * of sampled tasks per window and moves the distance step by step into the direction
+ * that lowers the cycles (i.e., the stalls on memory): When a step increased the cycles,
+ * the controller steps back, holds the distance for some windows, and probes the other
+ * direction afterward.
+ *
+ * Every worker owns its controller; only the histogram of chosen distances is read
+ * by other threads.
+ */
+class PrefetchDistanceController
+{
+public:
+    PrefetchDistanceController() { _task_states.reserve(16U); }
+    ~PrefetchDistanceController() = default;
+
+    /**
+     * Returns the distance for the given task type and records it in the histogram.
+     *
+     * @param trace_id Trace id of the task.
+     * @param initial_distance Callback estimating the distance for task types seen the first time.
+     * @return Number of tasks the prefetch should be scheduled ahead.
+     */
+    template <typename F> [[nodiscard]] std::uint8_t distance(const std::uint64_t trace_id, F &&initial_distance)
+    {
+        auto distance = std::uint8_t(0U);
+        if (trace_id == 0U)
+        {
+            distance = std::min<std::uint8_t>(initial_distance(), config::max_prefetch_distance());
+        }
+        else if (trace_id == _last_trace_id)
+        {
+            distance = _last_distance;
+        }
+        else
+        {
+            auto iterator = _task_states.find(trace_id);
+            if (iterator == _task_states.end())
+            {
+                if (_task_states.size() >= PrefetchDistanceController::max_trace_ids()) [[unlikely]]
+                {
+                    _task_states.clear();
+                    _last_trace_id = 0U;
+                }
+
+                const auto initial = std::min<std::uint8_t>(initial_distance(), config::max_prefetch_distance());
+                iterator = _task_states.insert(std::make_pair(trace_id, State{initial})).first;
+            }
+
+            _last_trace_id = trace_id;
+            _last_distance = distance = iterator->second.distance;
+        }
+
+        auto &count = _histogram[distance];
+        count.store(count.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+
+        return distance;
+    }
+
+    /**
+     * Adds the cycles of a sampled task to the current window of its task type.
+     * When the window is complete, the controller adjusts the distance.
+     *
+     * @param trace_id Trace id of the sampled task.
+     * @param cycles Cycles of the task.
+     */
+    void add(const std::uint64_t trace_id, const std::uint64_t cycles)
+    {
+        if (trace_id == 0U)
+        {
+            return;
+        }
+
+        auto iterator = _task_states.find(trace_id);
+        if (iterator == _task_states.end())
+        {
+            return;
+        }
+
+        auto &state = iterator.value();
+        state.window_cycles += cycles;
+        if (++state.count_window_samples == PrefetchDistanceController::window_size())
+        {
+            PrefetchDistanceController::adjust(state);
+            if (trace_id == _last_trace_id)
+            {
+                _last_distance = state.distance;
+            }
+        }
+    }
+
+    /**
+     * @return Number of prefetches scheduled with every distance (index) since the last reset.
+     */
+    [[nodiscard]] std::array<std::uint64_t, config::max_prefetch_distance() + 1U> histogram() const noexcept
+    {
+        auto histogram = std::array<std::uint64_t, config::max_prefetch_distance() + 1U>{};
+        for (auto distance = 0U; distance < _histogram.size(); ++distance)
+        {
+            histogram[distance] = _histogram[distance].load(std::memory_order_relaxed);
+        }
+
+        return histogram;
+    }
+
+    void reset_histogram() noexcept
+    {
+        for (auto &count : _histogram)
+        {
+            count.store(0U, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @param trace_id Trace id of a task.
+     * @return The distance currently chosen for the task type, or zero if unknown.
+     */
+    [[nodiscard]] std::uint8_t current_distance(const std::uint64_t trace_id) const
+    {
+        if (const auto iterator = _task_states.find(trace_id); iterator != _task_states.end())
+        {
+            return iterator->second.distance;
+        }
+
+        return 0U;
+    }
+
+private:
+    /// Number of samples per window before adjusting the distance.
+    [[nodiscard]] static constexpr std::uint32_t window_size() { return 8U; }
+
+    /// Number of windows the distance is held after stepping back.
+    [[nodiscard]] static constexpr std::uint8_t hold_windows() { return 16U; }
+
+    /// Maximal number of task types; the states are reset when exceeding the limit.
+    [[nodiscard]] static constexpr std::size_t max_trace_ids() { return 1U << 12U; }
+
+    class State
+    {
+    public:
+        explicit State(const std::uint8_t distance_) noexcept : distance(distance_) {}
+        ~State() noexcept = default;
+
+        /// Distance chosen for the task type.
+        std::uint8_t distance;
+
+        /// Direction of the next step (+1 or -1).
+        std::int8_t direction{1};
+
+        /// Number of windows to hold the distance.
+        std::uint8_t count_hold_windows{0U};
+
+        /// Samples and cycles of the current window.
+        std::uint32_t count_window_samples{0U};
+        std::uint64_t window_cycles{0U};
+
+        /// Average cycles of the last window.
+        std::uint64_t last_average_cycles{0U};
+    };
+
+    class Hash
+    {
+    public:
+        std::size_t operator()(std::uint64_t key) const noexcept
+        {
+            key ^= key >> 33U;
+            key *= std::uint64_t(0xff51afd7ed558ccd);
+            key ^= key >> 33U;
+
+            return static_cast<std::size_t>(key);
+        }
+    };
+
+    /// State of the controller for every task type.
+    tsl::robin_map<std::uint64_t, State, Hash> _task_states;
+
+    /// Consecutive tasks often share their type; avoid the lookup.
+    std::uint64_t _last_trace_id{0U};
+    std::uint8_t _last_distance{0U};
+
+    /// Number of prefetches per chosen distance.
+    std::array<std::atomic_uint64_t, config::max_prefetch_distance() + 1U> _histogram{};
+
+    static void adjust(State &state) noexcept
+    {
+        const auto average_cycles = state.window_cycles / state.count_window_samples;
+        state.window_cycles = 0U;
+        state.count_window_samples = 0U;
+
+        if (state.count_hold_windows > 0U)
+        {
+            --state.count_hold_windows;
+        }
+        else if (state.last_average_cycles > 0U && average_cycles * 16U > state.last_average_cycles * 17U)
+        {
+            /// The last step made the tasks slower (by more than ~6%): Step back and hold.
+            state.direction = -state.direction;
+            state.count_hold_windows = PrefetchDistanceController::hold_windows();
+            PrefetchDistanceController::step(state);
+        }
+        else
+        {
+            PrefetchDistanceController::step(state);
+        }
+
+        state.last_average_cycles = average_cycles;
+    }
+
+    static void step(State &state) noexcept
+    {
+        const auto distance = std::int32_t(state.distance) + state.direction;
+        if (distance < 1 || distance > std::int32_t(config::max_prefetch_distance()))
+        {
+            /// Reached a bound; probe the other direction next time.
+            state.direction = -state.direction;
+            return;
+        }
+
+        state.distance = std::uint8_t(distance);
+    }
+};
+} // namespace mx::tasking
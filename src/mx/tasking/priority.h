@@ -6,6 +6,19 @@ namespace mx::tasking {
 enum priority : std::uint8_t
 {
     low = 0U,
-    normal = 1U
+    normal = 1U,
+    high = 2U,
+    critical = 3U
 };
-}
\ No newline at end of file
+
+/// Lowest and highest priority; task pools hold one queue for every level in between.
+inline constexpr auto min_priority = priority::low;
+inline constexpr auto max_priority = priority::critical;
+
+/// Lowest priority that is weighted when refilling the task buffer; low
+/// prioritized tasks run only when no task of a higher priority is waiting.
+inline constexpr auto min_weighted_priority = priority::normal;
+
+/// Number of priority levels.
+inline constexpr auto count_priorities = std::uint8_t(max_priority - min_priority + 1U);
+} // namespace mx::tasking
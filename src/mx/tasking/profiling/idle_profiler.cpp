@@ -1,110 +1,80 @@
 #include "idle_profiler.h"
-#include <mx/memory/global_heap.h>
-#include <mx/tasking/runtime.h>
+#include <algorithm>
 
 using namespace mx::tasking::profiling;
 
-IdleProfileTask::IdleProfileTask(util::maybe_atomic<bool> &is_running) : _is_profiler_running(is_running)
-{
-    _idle_ranges.reserve(1U << 16U);
-}
-
-mx::tasking::TaskResult IdleProfileTask::execute(const std::uint16_t /*worker_id*/)
-{
-    this->_is_task_running = true;
-
-    auto range = TimeRange{};
-
-    //    while (this->_is_profiler_running && this->_channel.empty())
-    //    {
-    //        this->_channel.fill();
-    //    }
-
-    range.stop();
-
-    if (range.nanoseconds() > 10U)
-    {
-        this->_idle_ranges.emplace_back(std::move(range));
-    }
-
-    this->_is_task_running = false;
-
-    if (this->_is_profiler_running)
-    {
-        return tasking::TaskResult::make_succeed(this);
-    }
-
-    return tasking::TaskResult::make_null();
-}
-
-IdleProfiler::~IdleProfiler()
-{
-    for (auto *task : this->_tasks)
-    {
-        delete task;
-    }
-}
-
-void IdleProfiler::start() noexcept
+void IdleProfiler::start(const std::uint16_t count_workers) noexcept
 {
     if (this->_is_running)
     {
         return;
     }
 
-    for (auto *task : this->_tasks)
+    this->_count_workers = count_workers;
+    for (auto worker_id = 0U; worker_id < count_workers; ++worker_id)
     {
-        delete task;
+        auto &record = this->_worker_records[worker_id].value();
+        record.lock().lock();
+        record.idle_ranges().clear();
+        record.idle_ranges().reserve(1U << 12U);
+        record.parking_times() = ParkingTimes{};
+        record.lock().unlock();
     }
-    this->_tasks.clear();
 
-    this->_start = std::chrono::steady_clock::now();
+    this->_start = std::chrono::system_clock::now();
     this->_is_running = true;
 }
 
-// void IdleProfiler::start() noexcept
-//{
-////    auto *task = new (memory::GlobalHeap::allocate_cache_line_aligned(sizeof(IdleProfileTask)))
-////        IdleProfileTask(this->_is_running);
-////    task->annotate(channel.id());
-////    task->annotate(mx::tasking::priority::low);
-////    this->_tasks.push_back(task);
-////    mx::tasking::runtime::spawn(*task);
-//}
-
 IdleTimes IdleProfiler::stop() noexcept
 {
     this->_is_running = false;
-    const auto end = std::chrono::steady_clock::now();
+    const auto end = std::chrono::system_clock::now();
     const auto start = this->_start;
 
     auto idle_ranges = std::vector<std::vector<NormalizedTimeRange>>{};
-    idle_ranges.reserve(mx::tasking::runtime::workers());
+    idle_ranges.reserve(this->_count_workers);
+
+    auto parking_times = std::vector<ParkingTimes>{};
+    parking_times.reserve(this->_count_workers);
 
-    for (auto *task : this->_tasks)
+    for (auto worker_id = 0U; worker_id < this->_count_workers; ++worker_id)
     {
-        if (task == nullptr)
-        {
-            continue;
-        }
+        auto &record = this->_worker_records[worker_id].value();
+        record.lock().lock();
 
-        // Wait for the task to finish.
-        //        while(channel_task->is_running());
+        auto normalized_ranges = std::vector<NormalizedTimeRange>{};
+        normalized_ranges.reserve(record.idle_ranges().size());
+        std::transform(record.idle_ranges().begin(), record.idle_ranges().end(), std::back_inserter(normalized_ranges),
+                       [start](const auto &time_range) { return time_range.normalize(start); });
+        idle_ranges.emplace_back(std::move(normalized_ranges));
+        parking_times.emplace_back(record.parking_times());
+
+        record.lock().unlock();
+    }
+
+    return IdleTimes{std::move(idle_ranges), end - start, std::move(parking_times)};
+}
 
-        if (task->idle_ranges().empty() == false)
-        {
-            //            const auto &idle_range = task->idle_ranges();
-            //            auto normalized_range = std::vector<NormalizedTimeRange>{};
-            //            std::transform(idle_range.begin(), idle_range.end(), std::back_inserter(normalized_range),
-            //                           [start](const auto &time_range) { return time_range.normalize(start); });
-            //
-            //            idle_ranges.emplace_back(std::move(normalized_range));
-        }
-        else
-        {
-            idle_ranges.emplace_back(std::vector<NormalizedTimeRange>{});
-        }
+void IdleProfiler::record_idle(const std::uint16_t worker_id, TimeRange &&idle_range,
+                               const std::chrono::nanoseconds parked_time, const std::uint64_t count_parks) noexcept
+{
+    if (this->_is_running)
+    {
+        auto &record = this->_worker_records[worker_id].value();
+        record.lock().lock();
+        record.idle_ranges().emplace_back(std::move(idle_range));
+        record.parking_times().park(count_parks, parked_time);
+        record.lock().unlock();
     }
+}
 
-    return IdleTimes{std::move(idle_ranges), end - start};
-}
\ No newline at end of file
+void IdleProfiler::record_wake_up(const std::uint16_t worker_id, const std::chrono::nanoseconds latency) noexcept
+{
+    if (this->_is_running)
+    {
+        auto &record = this->_worker_records[worker_id].value();
+        record.lock().lock();
+        record.parking_times().wake_up(latency);
+        record.lock().unlock();
+    }
+}
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "time.h"
+#include <array>
 #include <chrono>
-#include <mx/tasking/task.h>
+#include <mx/synchronization/spinlock.h>
+#include <mx/tasking/config.h>
+#include <mx/util/aligned_t.h>
 #include <mx/util/maybe_atomic.h>
 #include <optional>
 #include <utility>
@@ -11,61 +14,80 @@
 namespace mx::tasking::profiling {
 
 /**
- * Task, that is scheduled with low priority and gets CPU time,
- * whenever no other task is available.
- * Every time the task gets executed, it will record the time range,
- * until the channel has new tasks for execution.
- */
-class IdleProfileTask final : public TaskInterface
-{
-public:
-    IdleProfileTask(util::maybe_atomic<bool> &is_running);
-    ~IdleProfileTask() override = default;
-
-    TaskResult execute(std::uint16_t worker_id) override;
-
-    [[nodiscard]] std::vector<TimeRange> &idle_ranges() noexcept { return _idle_ranges; }
-
-    [[nodiscard]] bool is_running() const noexcept { return _is_task_running; }
-
-private:
-    util::maybe_atomic<bool> &_is_profiler_running;
-    util::maybe_atomic<bool> _is_task_running{false};
-    std::vector<TimeRange> _idle_ranges;
-};
-
-/**
- * Schedules the idle/profiling task to every channel and
- * writes the memory to a given file.
+ * The idle profiler records the time ranges every worker
+ * found no task to execute. Further, it records how long
+ * workers were parked (idle without consuming CPU) and how
+ * long it took to wake up a parked worker.
  */
 class IdleProfiler
 {
 public:
     IdleProfiler() noexcept = default;
-    ~IdleProfiler();
+    ~IdleProfiler() = default;
 
     /**
-     * Enable profiling and set the result file.
-     * @param profiling_output_file File, where results should be written to.
+     * Enable profiling.
+     *
+     * @param count_workers Number of workers to profile.
      */
-    void start() noexcept;
+    void start(std::uint16_t count_workers) noexcept;
 
     /**
-     * Normalizes all time ranges and writes them to the specified
-     * file.
+     * Disables profiling and normalizes all recorded time ranges.
+     *
+     * @return Idle times of all workers.
      */
     IdleTimes stop() noexcept;
 
     [[nodiscard]] bool is_running() const noexcept { return _is_running; }
 
+    /**
+     * Records a time range the given worker was idle.
+     *
+     * @param worker_id Worker that was idle.
+     * @param idle_range Time range the worker was idle.
+     * @param parked_time Part of the idle time the worker was parked.
+     * @param count_parks Number of times the worker was parked during the range.
+     */
+    void record_idle(std::uint16_t worker_id, TimeRange &&idle_range, std::chrono::nanoseconds parked_time,
+                     std::uint64_t count_parks) noexcept;
+
+    /**
+     * Records the time between dispatching a task to a parked worker
+     * and the worker resuming.
+     *
+     * @param worker_id Worker that was woken up.
+     * @param latency Time until the worker resumed.
+     */
+    void record_wake_up(std::uint16_t worker_id, std::chrono::nanoseconds latency) noexcept;
+
 private:
+    class WorkerRecord
+    {
+    public:
+        WorkerRecord() noexcept { _lock.unlock(); }
+        ~WorkerRecord() noexcept = default;
+
+        [[nodiscard]] synchronization::Spinlock &lock() noexcept { return _lock; }
+        [[nodiscard]] std::vector<TimeRange> &idle_ranges() noexcept { return _idle_ranges; }
+        [[nodiscard]] ParkingTimes &parking_times() noexcept { return _parking_times; }
+
+    private:
+        synchronization::Spinlock _lock;
+        std::vector<TimeRange> _idle_ranges;
+        ParkingTimes _parking_times;
+    };
+
     util::maybe_atomic<bool> _is_running{false};
 
-    // Time point of the runtime start.
-    alignas(64) std::chrono::steady_clock::time_point _start;
+    // Number of profiled workers.
+    std::uint16_t _count_workers{0U};
+
+    // Time point of the profiling start.
+    alignas(64) std::chrono::system_clock::time_point _start;
 
-    // List of all idle/profile tasks.
-    std::vector<IdleProfileTask *> _tasks;
+    // Records of every worker.
+    std::array<util::aligned_t<WorkerRecord>, config::max_cores()> _worker_records;
 };
 
-} // namespace mx::tasking::profiling
\ No newline at end of file
+} // namespace mx::tasking::profiling
@@ -67,7 +67,7 @@ private:
 class TaskCounter
 {
 public:
-    using counter_line_t = util::aligned_t<std::array<std::uint64_t, 7U>>;
+    using counter_line_t = util::aligned_t<std::array<std::uint64_t, 12U>>;
 
     enum Counter : std::uint8_t
     {
@@ -77,7 +77,12 @@ public:
         Executed,
         ExecutedReader,
         ExecutedWriter,
-        FilledBuffer
+        FilledBuffer,
+        StealAttempt,
+        Stolen,
+        StolenFromRemoteNode,
+        ExecutedOnLocalData,
+        ExecutedOnRemoteData
     };
 
     explicit TaskCounter(const std::uint16_t count_workers) noexcept : _count_workers(count_workers)
@@ -112,6 +117,16 @@ public:
         ++_counter[worker_id].value()[static_cast<std::uint8_t>(C)];
     }
 
+    /**
+     * Increment the template-given counter by the given value for the given channel.
+     * @param worker_id Worker to increment the statistics for.
+     * @param value Value to add.
+     */
+    template <Counter C> void add(const std::uint16_t worker_id, const std::uint64_t value) noexcept
+    {
+        _counter[worker_id].value()[static_cast<std::uint8_t>(C)] += value;
+    }
+
     /**
      * Read the given counter for a given channel.
      * @param counter Counter to read.
@@ -147,7 +162,7 @@ public:
     [[nodiscard]] std::unordered_map<Counter, WorkerTaskCounter> get() const noexcept
     {
         auto counter = std::unordered_map<Counter, WorkerTaskCounter>{};
-        counter.reserve(7U);
+        counter.reserve(12U);
 
         counter.insert(std::make_pair(Counter::Dispatched, get(Counter::Dispatched)));
         counter.insert(std::make_pair(Counter::DispatchedLocally, get(Counter::DispatchedLocally)));
@@ -156,10 +171,34 @@ public:
         counter.insert(std::make_pair(Counter::ExecutedReader, get(Counter::ExecutedReader)));
         counter.insert(std::make_pair(Counter::ExecutedWriter, get(Counter::ExecutedWriter)));
         counter.insert(std::make_pair(Counter::FilledBuffer, get(Counter::FilledBuffer)));
+        counter.insert(std::make_pair(Counter::StealAttempt, get(Counter::StealAttempt)));
+        counter.insert(std::make_pair(Counter::Stolen, get(Counter::Stolen)));
+        counter.insert(std::make_pair(Counter::StolenFromRemoteNode, get(Counter::StolenFromRemoteNode)));
+        counter.insert(std::make_pair(Counter::ExecutedOnLocalData, get(Counter::ExecutedOnLocalData)));
+        counter.insert(std::make_pair(Counter::ExecutedOnRemoteData, get(Counter::ExecutedOnRemoteData)));
 
         return counter;
     }
 
+    /**
+     * Calculates the share of executed tasks that accessed
+     * data allocated on a remote NUMA node.
+     *
+     * @param counter Counters, read by get().
+     * @return Ratio of remote data accesses; zero, if no task accessed annotated data.
+     */
+    [[nodiscard]] static double remote_access_ratio(const std::unordered_map<Counter, WorkerTaskCounter> &counter)
+    {
+        const auto local = counter.at(Counter::ExecutedOnLocalData).sum();
+        const auto remote = counter.at(Counter::ExecutedOnRemoteData).sum();
+        if (local + remote == 0U)
+        {
+            return 0.0;
+        }
+
+        return remote / double(local + remote);
+    }
+
 private:
     // Number of channels to monitor.
     const std::uint16_t _count_workers;
@@ -0,0 +1,92 @@
+#include "task_cycle_accounting.h"
+
+using namespace mx::tasking::profiling;
+
+void TaskCycleAccounting::flush(const std::uint16_t worker_id) noexcept
+{
+    auto &record = this->_worker_records[worker_id].value();
+    if (record.count_pending == 0U)
+    {
+        return;
+    }
+
+    record.lock.lock();
+    if (record.task_cycles.size() > TaskCycleAccounting::max_trace_ids()) [[unlikely]]
+    {
+        record.task_cycles.clear();
+    }
+
+    for (auto i = 0U; i < record.count_pending; ++i)
+    {
+        const auto &run = record.pending[i];
+        record.task_cycles[run.trace_id] += run.cycles;
+    }
+    record.lock.unlock();
+
+    record.count_pending = 0U;
+}
+
+std::unordered_map<std::uint64_t, TaskCycles> TaskCycleAccounting::get() const
+{
+    auto task_cycles = std::unordered_map<std::uint64_t, TaskCycles>{};
+
+    for (const auto &worker_record : this->_worker_records)
+    {
+        const auto &record = worker_record.value();
+        record.lock.lock();
+        for (const auto &[trace_id, cycles] : record.task_cycles)
+        {
+            task_cycles[trace_id] += cycles;
+        }
+        record.lock.unlock();
+    }
+
+    return task_cycles;
+}
+
+std::unordered_map<std::uint64_t, TaskCycles> TaskCycleAccounting::get(
+    const std::vector<std::uint64_t> &trace_ids) const
+{
+    auto task_cycles = std::unordered_map<std::uint64_t, TaskCycles>{};
+
+    for (const auto &worker_record : this->_worker_records)
+    {
+        const auto &record = worker_record.value();
+        record.lock.lock();
+        for (const auto trace_id : trace_ids)
+        {
+            if (auto iterator = record.task_cycles.find(trace_id); iterator != record.task_cycles.end())
+            {
+                task_cycles[trace_id] += iterator->second;
+            }
+        }
+        record.lock.unlock();
+    }
+
+    return task_cycles;
+}
+
+void TaskCycleAccounting::retire(const std::vector<std::uint64_t> &trace_ids)
+{
+    for (auto &worker_record : this->_worker_records)
+    {
+        auto &record = worker_record.value();
+        record.lock.lock();
+        for (const auto trace_id : trace_ids)
+        {
+            record.task_cycles.erase(trace_id);
+        }
+        record.lock.unlock();
+    }
+}
+
+void TaskCycleAccounting::clear()
+{
+    for (auto &worker_record : this->_worker_records)
+    {
+        auto &record = worker_record.value();
+        record.lock.lock();
+        record.task_cycles.clear();
+        record.lock.unlock();
+    }
+}
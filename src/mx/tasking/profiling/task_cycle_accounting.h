@@ -0,0 +1,196 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mx/synchronization/spinlock.h>
+#include <mx/tasking/config.h>
+#include <mx/util/aligned_t.h>
+#include <tsl/robin_map.h>
+#include <unordered_map>
+#include <vector>
+
+namespace mx::tasking::profiling {
+/**
+ * Cycles and number of executions accounted for a single trace id.
+ */
+class TaskCycles
+{
+public:
+    constexpr TaskCycles() noexcept = default;
+    constexpr TaskCycles(const std::uint64_t cycles, const std::uint64_t count) noexcept
+        : _cycles(cycles), _count(count)
+    {
+    }
+    ~TaskCycles() noexcept = default;
+
+    TaskCycles &operator+=(const TaskCycles &other) noexcept
+    {
+        _cycles += other._cycles;
+        _count += other._count;
+        return *this;
+    }
+
+    [[nodiscard]] std::uint64_t cycles() const noexcept { return _cycles; }
+    [[nodiscard]] std::uint64_t count() const noexcept { return _count; }
+    [[nodiscard]] std::uint64_t average() const noexcept { return _count > 0U ? _cycles / _count : 0U; }
+
+private:
+    /// Number of cycles spent executing tasks with the trace id.
+    std::uint64_t _cycles{0U};
+
+    /// Number of executed tasks with the trace id.
+    std::uint64_t _count{0U};
+};
+
+/**
+ * The task cycle accounting sums up the cycles spent per trace id
+ * (i.e., per dataflow node) on every worker. In contrast to the
+ * task tracer and the task cycle sampler, the accounting can be
+ * switched on and off while the runtime is running.
+ *
+ * Workers read the timestamp counter only when the trace id changes
+ * between two consecutive tasks; tasks of the same trace id are
+ * accounted as a single run. Runs are collected in a worker-local
+ * buffer that is published once per task buffer.
+ */
+class TaskCycleAccounting
+{
+public:
+    TaskCycleAccounting() noexcept = default;
+    ~TaskCycleAccounting() noexcept = default;
+
+    /**
+     * Switches the accounting on or off. Workers
+     * pick up the flag when refilling their task buffer.
+     *
+     * @param is_enabled True, to enable accounting.
+     */
+    void enable(const bool is_enabled) noexcept { _is_enabled.store(is_enabled, std::memory_order_relaxed); }
+
+    /**
+     * Enables the accounting until released, independent of the switch
+     * (e.g., for the lifetime of a query that reports its task cycles).
+     */
+    void acquire() noexcept { _count_holders.fetch_add(1U, std::memory_order_relaxed); }
+
+    /**
+     * Releases the accounting acquired before.
+     */
+    void release() noexcept { _count_holders.fetch_sub(1U, std::memory_order_relaxed); }
+
+    /**
+     * @return True, if the accounting is switched on or acquired by anyone.
+     */
+    [[nodiscard]] bool is_enabled() const noexcept
+    {
+        return _is_enabled.load(std::memory_order_relaxed) || _count_holders.load(std::memory_order_relaxed) > 0U;
+    }
+
+    /**
+     * Records a run of tasks with the same trace id on the given worker.
+     * The run becomes visible after the next flush.
+     *
+     * @param worker_id Worker that executed the tasks.
+     * @param trace_id Trace id of the tasks.
+     * @param cycles Cycles spent for the run.
+     * @param count Number of tasks in the run.
+     */
+    void record(const std::uint16_t worker_id, const std::uint64_t trace_id, const std::uint64_t cycles,
+                const std::uint32_t count) noexcept
+    {
+        if (trace_id == 0U || count == 0U)
+        {
+            return;
+        }
+
+        auto &record = _worker_records[worker_id].value();
+        if (record.count_pending == record.pending.size()) [[unlikely]]
+        {
+            this->flush(worker_id);
+        }
+
+        record.pending[record.count_pending++] = Run{trace_id, TaskCycles{cycles, count}};
+    }
+
+    /**
+     * Publishes the runs recorded by the given worker since the last flush.
+     *
+     * @param worker_id Worker.
+     */
+    void flush(std::uint16_t worker_id) noexcept;
+
+    /**
+     * @return Accounted cycles of all trace ids, summed up over all workers.
+     */
+    [[nodiscard]] std::unordered_map<std::uint64_t, TaskCycles> get() const;
+
+    /**
+     * @param trace_ids Trace ids of interest (e.g., the nodes of a single query).
+     * @return Accounted cycles of the given trace ids, summed up over all workers.
+     */
+    [[nodiscard]] std::unordered_map<std::uint64_t, TaskCycles> get(const std::vector<std::uint64_t> &trace_ids) const;
+
+    /**
+     * Removes the given trace ids, e.g., when the nodes of a finished query are
+     * freed and their ids may be reused.
+     *
+     * @param trace_ids Trace ids to remove.
+     */
+    void retire(const std::vector<std::uint64_t> &trace_ids);
+
+    /**
+     * Removes all accounted cycles.
+     */
+    void clear();
+
+private:
+    /// Maximal number of trace ids per worker. Runs of finished graphs that were
+    /// published after retiring their ids stay in the map; the map is reset when
+    /// exceeding the limit to bound the memory.
+    [[nodiscard]] static constexpr std::size_t max_trace_ids() { return 1U << 16U; }
+
+    class Hash
+    {
+    public:
+        std::size_t operator()(std::uint64_t key) const noexcept
+        {
+            key ^= key >> 33U;
+            key *= std::uint64_t(0xff51afd7ed558ccd);
+            key ^= key >> 33U;
+
+            return static_cast<std::size_t>(key);
+        }
+    };
+
+    class Run
+    {
+    public:
+        std::uint64_t trace_id{0U};
+        TaskCycles cycles;
+    };
+
+    class WorkerRecord
+    {
+    public:
+        WorkerRecord() noexcept { lock.unlock(); }
+        ~WorkerRecord() noexcept = default;
+
+        /// Runs recorded since the last flush, only accessed by the owning worker.
+        std::array<Run, config::task_buffer_size()> pending;
+        std::uint32_t count_pending{0U};
+
+        /// Published cycles per trace id, protected by the lock.
+        mutable synchronization::Spinlock lock;
+        tsl::robin_map<std::uint64_t, TaskCycles, Hash> task_cycles;
+    };
+
+    alignas(64) std::atomic_bool _is_enabled{false};
+
+    // Number of holders that acquired the accounting.
+    std::atomic_uint32_t _count_holders{0U};
+
+    // Records of every worker.
+    std::array<util::aligned_t<WorkerRecord>, config::max_cores()> _worker_records;
+};
+} // namespace mx::tasking::profiling
@@ -42,7 +42,9 @@ WorkerIdleFrames IdleTimes::group(const std::chrono::nanoseconds frame_size) con
         idle_frames.emplace_back(std::move(frames));
     }
 
-    return WorkerIdleFrames{std::move(idle_frames), this->_duration, frame_size};
+    auto parking_times = this->_parking_times;
+    return WorkerIdleFrames{std::move(idle_frames), this->_duration, frame_size, std::move(parking_times),
+                            this->busy_idle_time()};
 }
 
 nlohmann::json WorkerIdleFrames::to_json() const noexcept
@@ -64,6 +66,45 @@ nlohmann::json WorkerIdleFrames::to_json() const noexcept
         channels.emplace_back(std::move(channel));
     }
     idle_times["channels"] = std::move(channels);
+    idle_times["busy-idle"] = this->_busy_idle_time.count();
+
+    nlohmann::json parking_times = nlohmann::json::array();
+    for (const auto &channel_parking_times : this->_parking_times)
+    {
+        parking_times.emplace_back(channel_parking_times.to_json());
+    }
+    idle_times["parking"] = std::move(parking_times);
 
     return idle_times;
+}
+
+std::chrono::nanoseconds IdleTimes::busy_idle_time() const noexcept
+{
+    auto idle_time = std::chrono::nanoseconds{0U};
+    for (const auto &worker_idle_ranges : this->_idle_ranges)
+    {
+        for (const auto &time_range : worker_idle_ranges)
+        {
+            idle_time += time_range.duration();
+        }
+    }
+
+    for (const auto &parking_times : this->_parking_times)
+    {
+        idle_time -= parking_times.parked_time();
+    }
+
+    return idle_time;
+}
+
+nlohmann::json ParkingTimes::to_json() const noexcept
+{
+    nlohmann::json parking_times;
+    parking_times["count-parks"] = this->_count_parks;
+    parking_times["parked"] = this->_parked_time.count();
+    parking_times["count-wake-ups"] = this->_count_wake_ups;
+    parking_times["avg-wake-up-latency"] = this->average_wake_up_latency().count();
+    parking_times["max-wake-up-latency"] = this->_max_wake_up_latency.count();
+
+    return parking_times;
 }
\ No newline at end of file
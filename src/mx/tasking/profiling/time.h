@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <nlohmann/json.hpp>
@@ -74,12 +75,61 @@ private:
     std::chrono::system_clock::time_point _end;
 };
 
+/**
+ * Statistics about parking a single worker: How often and how long
+ * the worker was parked and how long it took to wake the worker up.
+ */
+class ParkingTimes
+{
+public:
+    constexpr ParkingTimes() noexcept = default;
+    constexpr ParkingTimes(const ParkingTimes &) noexcept = default;
+    ~ParkingTimes() noexcept = default;
+
+    ParkingTimes &operator=(const ParkingTimes &) noexcept = default;
+
+    void park(const std::uint64_t count_parks, const std::chrono::nanoseconds parked_time) noexcept
+    {
+        _count_parks += count_parks;
+        _parked_time += parked_time;
+    }
+
+    void wake_up(const std::chrono::nanoseconds latency) noexcept
+    {
+        ++_count_wake_ups;
+        _wake_up_latency += latency;
+        _max_wake_up_latency = std::max(_max_wake_up_latency, latency);
+    }
+
+    [[nodiscard]] std::uint64_t count_parks() const noexcept { return _count_parks; }
+    [[nodiscard]] std::chrono::nanoseconds parked_time() const noexcept { return _parked_time; }
+    [[nodiscard]] std::uint64_t count_wake_ups() const noexcept { return _count_wake_ups; }
+    [[nodiscard]] std::chrono::nanoseconds max_wake_up_latency() const noexcept { return _max_wake_up_latency; }
+    [[nodiscard]] std::chrono::nanoseconds average_wake_up_latency() const noexcept
+    {
+        return _count_wake_ups > 0U ? std::chrono::nanoseconds{_wake_up_latency.count() / std::int64_t(_count_wake_ups)}
+                                    : std::chrono::nanoseconds{0U};
+    }
+
+    [[nodiscard]] nlohmann::json to_json() const noexcept;
+
+private:
+    std::uint64_t _count_parks{0U};
+    std::chrono::nanoseconds _parked_time{0U};
+    std::uint64_t _count_wake_ups{0U};
+    std::chrono::nanoseconds _wake_up_latency{0U};
+    std::chrono::nanoseconds _max_wake_up_latency{0U};
+};
+
 class WorkerIdleFrames
 {
 public:
     WorkerIdleFrames(std::vector<std::vector<std::chrono::nanoseconds>> &&idle_frames,
-                     const std::chrono::nanoseconds duration, const std::chrono::nanoseconds frame_size) noexcept
-        : _duration(duration), _frame_size(frame_size), _idle_frames(std::move(idle_frames))
+                     const std::chrono::nanoseconds duration, const std::chrono::nanoseconds frame_size,
+                     std::vector<ParkingTimes> &&parking_times = {},
+                     const std::chrono::nanoseconds busy_idle_time = std::chrono::nanoseconds{0U}) noexcept
+        : _duration(duration), _frame_size(frame_size), _idle_frames(std::move(idle_frames)),
+          _parking_times(std::move(parking_times)), _busy_idle_time(busy_idle_time)
     {
     }
 
@@ -94,20 +144,33 @@ public:
     {
         return _idle_frames;
     }
+
+    /**
+     * @return Parking statistics for every worker; empty if workers were never parked.
+     */
+    [[nodiscard]] const std::vector<ParkingTimes> &parking_times() const noexcept { return _parking_times; }
+
+    /**
+     * @return The time workers were idle but not parked, i.e., the time burned by spinning.
+     */
+    [[nodiscard]] std::chrono::nanoseconds busy_idle_time() const noexcept { return _busy_idle_time; }
+
     [[nodiscard]] nlohmann::json to_json() const noexcept;
 
 private:
     const std::chrono::nanoseconds _duration;
     const std::chrono::nanoseconds _frame_size;
     std::vector<std::vector<std::chrono::nanoseconds>> _idle_frames;
+    std::vector<ParkingTimes> _parking_times;
+    const std::chrono::nanoseconds _busy_idle_time;
 };
 
 class IdleTimes
 {
 public:
-    IdleTimes(std::vector<std::vector<NormalizedTimeRange>> &&idle_ranges,
-              const std::chrono::nanoseconds duration) noexcept
-        : _duration(duration), _idle_ranges(std::move(idle_ranges))
+    IdleTimes(std::vector<std::vector<NormalizedTimeRange>> &&idle_ranges, const std::chrono::nanoseconds duration,
+              std::vector<ParkingTimes> &&parking_times = {}) noexcept
+        : _duration(duration), _idle_ranges(std::move(idle_ranges)), _parking_times(std::move(parking_times))
     {
     }
 
@@ -122,10 +185,21 @@ public:
         return _idle_ranges;
     }
 
+    /**
+     * @return Parking statistics for every worker; empty if workers were never parked.
+     */
+    [[nodiscard]] const std::vector<ParkingTimes> &parking_times() const noexcept { return _parking_times; }
+
+    /**
+     * @return The time workers were idle but not parked, i.e., the time burned by spinning.
+     */
+    [[nodiscard]] std::chrono::nanoseconds busy_idle_time() const noexcept;
+
     [[nodiscard]] WorkerIdleFrames group(std::chrono::nanoseconds frame_size) const noexcept;
 
 private:
     const std::chrono::nanoseconds _duration;
     std::vector<std::vector<NormalizedTimeRange>> _idle_ranges;
+    std::vector<ParkingTimes> _parking_times;
 };
 } // namespace mx::tasking::profiling
\ No newline at end of file
@@ -0,0 +1,40 @@
+#include "resource_boundness_classifier.h"
+
+using namespace mx::tasking;
+
+ResourceBoundnessClassifier::ResourceBoundnessClassifier() noexcept
+{
+    this->clear();
+}
+
+bool ResourceBoundnessClassifier::open(const std::uint16_t worker_id)
+{
+    auto &counter = this->_worker_counters[worker_id].value();
+    counter.emplace(perf::CounterDescription::LLC_LOAD_MISSES);
+    if (counter->open() && counter->start())
+    {
+        return true;
+    }
+
+    counter->close();
+    counter.reset();
+    return false;
+}
+
+void ResourceBoundnessClassifier::close(const std::uint16_t worker_id)
+{
+    auto &counter = this->_worker_counters[worker_id].value();
+    if (counter.has_value())
+    {
+        counter->close();
+        counter.reset();
+    }
+}
+
+void ResourceBoundnessClassifier::clear() noexcept
+{
+    for (auto &classification : this->_classifications)
+    {
+        classification.store(0U, std::memory_order_relaxed);
+    }
+}
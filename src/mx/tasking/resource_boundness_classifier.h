@@ -0,0 +1,156 @@
+#pragma once
+
+#include "annotation.h"
+#include "config.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mx/util/aligned_t.h>
+#include <optional>
+#include <perf/counter.h>
+
+namespace mx::tasking {
+/**
+ * The classifier determines the resource boundness of tasks online. Workers
+ * sample the cycles and last-level cache misses of every n-th task (per trace id,
+ * see TaskCycleSampler) and publish the classification into a table shared by
+ * all workers. The scheduler uses the published boundness for tasks that are not
+ * annotated with a boundness to place compute- and memory-bound tasks on the
+ * simultaneous multithreading siblings of a physical core.
+ *
+ * Every worker reads the cache misses of its own thread; workers that can not
+ * open the performance counter (e.g., due to perf_event_paranoid) do not classify.
+ */
+class ResourceBoundnessClassifier
+{
+public:
+    ResourceBoundnessClassifier() noexcept;
+    ~ResourceBoundnessClassifier() noexcept = default;
+
+    /**
+     * Opens the last-level cache miss counter for the calling worker thread.
+     *
+     * @param worker_id Worker calling.
+     * @return True, if the counter could be opened.
+     */
+    bool open(std::uint16_t worker_id);
+
+    /**
+     * Closes the counter of the calling worker thread.
+     *
+     * @param worker_id Worker calling.
+     */
+    void close(std::uint16_t worker_id);
+
+    /**
+     * @param worker_id Worker.
+     * @return True, if the worker has an opened counter and can classify tasks.
+     */
+    [[nodiscard]] bool is_open(const std::uint16_t worker_id) const noexcept
+    {
+        return _worker_counters[worker_id].value().has_value();
+    }
+
+    /**
+     * @param worker_id Worker calling.
+     * @return Last-level cache misses of the calling worker thread so far.
+     */
+    [[nodiscard]] std::uint64_t llc_misses(const std::uint16_t worker_id) const
+    {
+        return _worker_counters[worker_id].value()->now().value;
+    }
+
+    /**
+     * Classifies the task with the given trace id once every
+     * config::resource_boundness_samples() samples.
+     *
+     * @param trace_id Trace id of the sampled task.
+     * @param count_samples Number of samples of the task so far.
+     * @param cycles Cycles of all samples.
+     * @param llc_misses Last-level cache misses of all samples.
+     */
+    void update(const std::uint64_t trace_id, const std::uint64_t count_samples, const std::uint64_t cycles,
+                const std::uint64_t llc_misses) noexcept
+    {
+        if (trace_id != 0U && count_samples % config::resource_boundness_samples() == 0U)
+        {
+            const auto boundness = ResourceBoundnessClassifier::classify(cycles, llc_misses);
+            auto &slot = _classifications[ResourceBoundnessClassifier::slot(trace_id)];
+            const auto classification = (trace_id << 2U) | boundness;
+            if (slot.load(std::memory_order_relaxed) != classification)
+            {
+                slot.store(classification, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @param trace_id Trace id of a task.
+     * @return The classified boundness of the task or 'mixed', if the task was not classified (yet).
+     */
+    [[nodiscard]] enum annotation::resource_boundness get(const std::uint64_t trace_id) const noexcept
+    {
+        const auto classification = _classifications[ResourceBoundnessClassifier::slot(trace_id)].load(
+            std::memory_order_relaxed);
+        if (trace_id != 0U && (classification >> 2U) == ((trace_id << 2U) >> 2U))
+        {
+            return static_cast<enum annotation::resource_boundness>(classification & 0b11U);
+        }
+
+        return annotation::resource_boundness::mixed;
+    }
+
+    /**
+     * Forgets all classifications.
+     */
+    void clear() noexcept;
+
+    /**
+     * Classifies a task by the last-level cache misses per 10,000 cycles.
+     *
+     * @param cycles Sampled cycles.
+     * @param llc_misses Sampled last-level cache misses.
+     * @return Resource boundness of the task.
+     */
+    [[nodiscard]] static enum annotation::resource_boundness classify(const std::uint64_t cycles,
+                                                                      const std::uint64_t llc_misses) noexcept
+    {
+        if (cycles == 0U)
+        {
+            return annotation::resource_boundness::mixed;
+        }
+
+        const auto misses_per_cycles = (llc_misses * 10000U) / cycles;
+        if (misses_per_cycles >= config::memory_bound_llc_misses())
+        {
+            return annotation::resource_boundness::memory;
+        }
+
+        if (misses_per_cycles <= config::compute_bound_llc_misses())
+        {
+            return annotation::resource_boundness::compute;
+        }
+
+        return annotation::resource_boundness::mixed;
+    }
+
+private:
+    /// Number of slots in the table; trace ids sharing a slot overwrite each other.
+    constexpr static inline auto COUNT_SLOTS = std::size_t(1U) << 12U;
+
+    [[nodiscard]] static std::size_t slot(std::uint64_t trace_id) noexcept
+    {
+        trace_id ^= trace_id >> 33U;
+        trace_id *= std::uint64_t(0xff51afd7ed558ccd);
+        trace_id ^= trace_id >> 33U;
+
+        return static_cast<std::size_t>(trace_id) & (COUNT_SLOTS - 1U);
+    }
+
+    /// Classifications, encoded as trace id (shifted by two bits) and the boundness in the lowest two bits.
+    std::array<std::atomic_uint64_t, COUNT_SLOTS> _classifications;
+
+    /// Last-level cache miss counter of every worker thread.
+    std::array<util::aligned_t<std::optional<perf::Counter>>, config::max_cores()> _worker_counters;
+};
+} // namespace mx::tasking
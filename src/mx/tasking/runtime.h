@@ -3,10 +3,15 @@
 #include "scheduler.h"
 #include "task.h"
 #include "task_squad.h"
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <mx/io/network/server.h>
+#include <mx/memory/allocator_statistics.h>
 #include <mx/memory/fixed_size_allocator.h>
+#include <mx/memory/slab_allocator.h>
 #include <mx/memory/task_allocator_interface.h>
 #include <mx/memory/worker_local_dynamic_size_allocator.h>
 #include <mx/resource/annotation.h>
@@ -15,6 +20,7 @@
 #include <mx/system/thread.h>
 #include <mx/util/core_set.h>
 #include <mx/util/logger.h>
+#include <span>
 #include <utility>
 
 namespace mx::tasking {
@@ -33,20 +39,35 @@ public:
      * @param prefetch_distance Distance for prefetching.
      * @param channels_per_core Number of channels per core (more than one enables channel-stealing).
      * @param use_system_allocator Should we use the systems malloc interface or our allocator?
+     * @param configuration Settings of the runtime (queue backend, task buffer size, profiling, ...).
      * @return True, when the runtime was started successfully.
      */
     static bool init(const util::core_set &core_set, const PrefetchDistance prefetch_distance,
-                     const bool use_system_allocator)
+                     const bool use_system_allocator, runtime_config configuration = runtime_config{})
     {
         util::Logger::info_if(system::Environment::is_debug(), "Starting MxTasking in DEBUG mode.");
-        util::Logger::warn_if(system::Environment::is_debug() == false && config::is_use_task_counter(),
+        util::Logger::warn_if(system::Environment::is_debug() == false && configuration.is_use_task_counter(),
                               "Task statistics will be collected in RELEASE build.");
-        util::Logger::warn_if(system::Environment::is_debug() == false && config::is_collect_task_traces(),
+        util::Logger::warn_if(system::Environment::is_debug() == false && configuration.is_collect_task_traces(),
                               "Task traces will be collected in RELEASE build.");
         util::Logger::warn_if(system::Environment::is_debug() == false &&
                                   config::worker_mode() == config::worker_mode::PowerSave,
                               "Power safe mode activated in RELEASE build.");
 
+        if (configuration.queue() != config::queue() && configuration.queue() != config::queue_backend::NUMAShared)
+        {
+            util::Logger::warn("The worker-owned queue backend can only be changed in config::queue().");
+            configuration.queue(config::queue());
+        }
+
+        if (configuration.task_buffer_size() == 0U || configuration.task_buffer_size() > config::task_buffer_size())
+        {
+            util::Logger::warn("The task buffer size is limited to [1, " +
+                               std::to_string(config::task_buffer_size()) + "] (see config::task_buffer_size()).");
+            configuration.task_buffer_size(
+                std::clamp<std::uint16_t>(configuration.task_buffer_size(), 1U, config::task_buffer_size()));
+        }
+
         // Are we ready to re-initialize the scheduler?
         if (_scheduler != nullptr && _scheduler->is_running())
         {
@@ -88,11 +109,12 @@ public:
         }
 
         // Create a new scheduler.
-        const auto need_new_scheduler = _scheduler == nullptr || *_scheduler != core_set;
+        const auto need_new_scheduler =
+            _scheduler == nullptr || *_scheduler != core_set || _scheduler->configuration() != configuration;
         if (need_new_scheduler)
         {
             _scheduler.reset(new (memory::GlobalHeap::allocate_cache_line_aligned(sizeof(Scheduler)))
-                                 Scheduler(core_set, prefetch_distance, *_resource_allocator));
+                                 Scheduler(core_set, prefetch_distance, *_resource_allocator, configuration));
         }
         else
         {
@@ -138,6 +160,33 @@ public:
         _scheduler->dispatch(first_task, last_task, local_worker_id);
     }
 
+    /**
+     * Spawns a batch of tasks to the given worker. The tasks will be
+     * linked and handed over to the worker with a single queue operation.
+     *
+     * @param tasks Tasks to be scheduled.
+     * @param target_worker_id Worker the tasks will be scheduled to.
+     * @param local_worker_id Worker, the spawn request came from.
+     */
+    static void spawn_batch(const std::span<TaskInterface *> tasks, const std::uint16_t target_worker_id,
+                            const std::uint16_t local_worker_id) noexcept
+    {
+        _scheduler->dispatch(tasks, target_worker_id, local_worker_id);
+    }
+
+    /**
+     * Spawns a batch of tasks, every task with regard to its annotation.
+     * Tasks targeting the same worker will be handed over to that worker
+     * with a single queue operation.
+     *
+     * @param tasks Tasks to be scheduled.
+     * @param local_worker_id Worker, the spawn request came from.
+     */
+    static void spawn_batch(const std::span<TaskInterface *> tasks, const std::uint16_t local_worker_id) noexcept
+    {
+        _scheduler->dispatch(tasks, local_worker_id);
+    }
+
     /**
      * Spawns the given squad.
      *
@@ -163,15 +212,51 @@ public:
     }
 
     /**
-     * @return Number of available cores.
+     * @return Number of active workers.
+     */
+    [[nodiscard]] static std::uint16_t workers() noexcept { return _scheduler->count_active_workers(); }
+
+    /**
+     * @return Number of workers the runtime was initialized with; the upper
+     *  bound for resizing the set of active workers.
+     */
+    [[nodiscard]] static std::uint16_t max_workers() noexcept { return _scheduler->count_cores(); }
+
+    /**
+     * Resizes the set of active workers without stopping the runtime.
+     * Only available when config::is_allow_resizing_workers() is enabled.
+     *
+     * @param count_workers Number of workers that should execute tasks,
+     *  at most the number of cores the runtime was initialized with.
+     * @param resized_callback Called with the number of active workers once resized.
+     * @return Number of active workers after resizing; unchanged until running dataflow graphs completed.
+     */
+    static std::uint16_t resize(const std::uint16_t count_workers,
+                                std::function<void(std::uint16_t)> &&resized_callback = nullptr) noexcept
+    {
+        return _scheduler->resize(count_workers, std::move(resized_callback));
+    }
+
+    /**
+     * Registers a started dataflow graph; the set of workers is not resized while graphs are running.
+     */
+    static void register_running_graph() noexcept { _scheduler->register_running_graph(); }
+
+    /**
+     * Unregisters a completed dataflow graph.
      */
-    [[nodiscard]] static std::uint16_t workers() noexcept { return _scheduler->count_cores(); }
+    static void unregister_running_graph() noexcept { _scheduler->unregister_running_graph(); }
 
     /**
      * @return Prefetch distance.
      */
     static PrefetchDistance prefetch_distance() noexcept { return _scheduler->prefetch_distance(); }
 
+    /**
+     * @return Settings the runtime was initialized with.
+     */
+    [[nodiscard]] static const runtime_config &configuration() noexcept { return _scheduler->configuration(); }
+
     /**
      * Starts the runtime and suspends the starting thread until MxTasking is stopped.
      */
@@ -244,7 +329,7 @@ public:
     template <typename T>
     static mx::resource::ptr to_resource(T *object, mx::resource::annotation &&annotation) noexcept
     {
-        return _resource_builder->build<T>(object, annotation);
+        return _resource_builder->build<T>(object, std::move(annotation));
     }
 
     /**
@@ -324,6 +409,41 @@ public:
      */
     static void free(void *pointer) noexcept { _resource_allocator->free(_worker_id, pointer); }
 
+    /**
+     * Creates an arena, partitioned by the workers, for memory that is
+     * released at once (e.g., temporary data and state of a query).
+     *
+     * @param memory_limit Limit of the arena's budget in bytes; zero for no limit.
+     * @return The arena.
+     */
+    [[nodiscard]] static std::shared_ptr<memory::slab::Arena> new_slab_arena(const std::uint64_t memory_limit = 0U)
+    {
+        return std::make_shared<memory::slab::Arena>(
+            max_workers(), [](const std::uint16_t worker_id) { return numa_node_id(worker_id); }, memory_limit);
+    }
+
+    /**
+     * Releases the free memory of the calling worker's resource heap.
+     *
+     * @param worker_id Id of the calling worker.
+     */
+    static void compact_memory(const std::uint16_t worker_id)
+    {
+        _resource_allocator->clean_up_remote_freed_memory(worker_id);
+    }
+
+    /**
+     * @return Usage of the memory held by the resource and the task allocator.
+     */
+    [[nodiscard]] static std::vector<memory::AllocatorStatistics> allocator_statistics()
+    {
+        auto statistics = _resource_allocator->statistics();
+        auto task_statistics = _task_allocator->statistics();
+        std::move(task_statistics.begin(), task_statistics.end(), std::back_inserter(statistics));
+
+        return statistics;
+    }
+
     /**
      * Spawns a task for every worker thread to release the free memory.
      */
@@ -375,13 +495,115 @@ public:
      */
     [[nodiscard]] static profiling::IdleTimes stop_idle_profiler() { return _scheduler->stop_idle_profiler(); }
 
+    /**
+     * Histogram of the prefetch distances chosen by the workers since the runtime was started.
+     * Distances are only tuned when prefetching with an automatic distance.
+     *
+     * @return Number of prefetches (value) scheduled with every distance (index).
+     */
+    [[nodiscard]] static std::array<std::uint64_t, config::max_prefetch_distance() + 1U>
+    prefetch_distance_histogram() noexcept
+    {
+        return _scheduler->prefetch_distance_histogram();
+    }
+
+    /**
+     * @return Number of optimistic resources that are deleted logically but not reclaimed yet.
+     */
+    [[nodiscard]] static std::uint64_t count_garbage() noexcept { return _scheduler->epoch_manager().count_garbage(); }
+
+    /**
+     * @return Maximal number of optimistic resources that were deleted logically but not
+     *  reclaimed at a time, since the runtime was started.
+     */
+    [[nodiscard]] static std::uint64_t peak_garbage() noexcept { return _scheduler->epoch_manager().peak_garbage(); }
+
+    /**
+     * Switches the accounting of task cycles per trace id on or off.
+     * In contrast to task traces, the accounting needs no recompilation.
+     *
+     * @param is_enabled True, to enable the accounting.
+     */
+    static void account_task_cycles(const bool is_enabled) noexcept
+    {
+        _scheduler->task_cycle_accounting().enable(is_enabled);
+    }
+
+    /**
+     * Enables the accounting of task cycles until released, even when
+     * it is switched off (e.g., for the lifetime of a query).
+     */
+    static void acquire_task_cycle_accounting() noexcept { _scheduler->task_cycle_accounting().acquire(); }
+
+    /**
+     * Releases the accounting of task cycles acquired before.
+     */
+    static void release_task_cycle_accounting() noexcept { _scheduler->task_cycle_accounting().release(); }
+
+    /**
+     * Publishes the task cycles the calling worker accounted so far, including
+     * the runs of its current task buffer that precede the calling task.
+     *
+     * @param worker_id Calling worker.
+     */
+    static void flush_task_cycles(const std::uint16_t worker_id) noexcept
+    {
+        _scheduler->task_cycle_accounting().flush(worker_id);
+    }
+
+    /**
+     * @return True, when task cycles are accounted.
+     */
+    [[nodiscard]] static bool is_accounting_task_cycles() noexcept
+    {
+        return _scheduler->task_cycle_accounting().is_enabled();
+    }
+
+    /**
+     * @return Cycles accounted for every trace id so far.
+     */
+    [[nodiscard]] static std::unordered_map<std::uint64_t, profiling::TaskCycles> task_cycles()
+    {
+        return _scheduler->task_cycle_accounting().get();
+    }
+
+    /**
+     * @param trace_ids Trace ids of interest, e.g., the nodes of a query.
+     * @return Cycles accounted for the given trace ids so far.
+     */
+    [[nodiscard]] static std::unordered_map<std::uint64_t, profiling::TaskCycles> task_cycles(
+        const std::vector<std::uint64_t> &trace_ids)
+    {
+        return _scheduler->task_cycle_accounting().get(trace_ids);
+    }
+
+    /**
+     * Removes the accounted cycles of the given trace ids,
+     * e.g., when the nodes of a query are freed.
+     *
+     * @param trace_ids Trace ids to remove.
+     */
+    static void retire_task_cycles(const std::vector<std::uint64_t> &trace_ids)
+    {
+        _scheduler->task_cycle_accounting().retire(trace_ids);
+    }
+
+    /**
+     * @param trace_id Trace id of a task, e.g., a dataflow node.
+     * @return The boundness classified by sampling the task, 'mixed' if not classified (yet).
+     */
+    [[nodiscard]] static enum annotation::resource_boundness resource_boundness(const std::uint64_t trace_id) noexcept
+    {
+        return _scheduler->resource_boundness_classifier().get(trace_id);
+    }
+
     /**
      * Reads the task statistics for a given counter and all channels.
      * @return List of all counters for every channel.
      */
     static std::unordered_map<profiling::TaskCounter::Counter, profiling::WorkerTaskCounter> task_counter() noexcept
     {
-        if constexpr (config::is_use_task_counter())
+        if (_scheduler->task_counter().has_value())
         {
             return _scheduler->task_counter()->get();
         }
@@ -399,7 +621,7 @@ public:
     static profiling::WorkerTaskCounter task_counter(
         [[maybe_unused]] const profiling::TaskCounter::Counter counter) noexcept
     {
-        if constexpr (config::is_use_task_counter())
+        if (_scheduler->task_counter().has_value())
         {
             return _scheduler->task_counter()->get(counter);
         }
@@ -418,7 +640,7 @@ public:
     static std::uint64_t task_counter([[maybe_unused]] const profiling::TaskCounter::Counter counter,
                                       [[maybe_unused]] const std::uint16_t worker_id) noexcept
     {
-        if constexpr (config::is_use_task_counter())
+        if (_scheduler->task_counter().has_value())
         {
             return _scheduler->task_counter()->get(counter, worker_id);
         }
@@ -442,7 +664,7 @@ public:
 
     static void start_tracing()
     {
-        if constexpr (config::is_collect_task_traces())
+        if (_scheduler->configuration().is_collect_task_traces())
         {
             _scheduler->task_tracer()->start();
         }
@@ -450,7 +672,7 @@ public:
 
     [[nodiscard]] static profiling::TaskTraces stop_tracing()
     {
-        if constexpr (config::is_collect_task_traces())
+        if (_scheduler->configuration().is_collect_task_traces())
         {
             return _scheduler->task_tracer()->stop();
         }
@@ -473,6 +695,23 @@ public:
         _network_server->send(client_id, std::move(message));
     }
 
+    /**
+     * Number of bytes sent to a client that are still buffered by the socket,
+     * e.g., to pause sending while the client does not keep up.
+     *
+     * @param client_id Id of the client.
+     * @return Number of pending bytes.
+     */
+    [[nodiscard]] static std::uint64_t count_pending_message_bytes(const std::uint32_t client_id)
+    {
+        if (_network_server == nullptr)
+        {
+            return 0U;
+        }
+
+        return _network_server->count_pending_bytes(client_id);
+    }
+
     static bool is_listening()
     {
         if (_network_server == nullptr)
@@ -483,6 +722,35 @@ public:
         return _network_server->is_running();
     }
 
+    /**
+     * Hands over the tasks of a worker that left the set of active workers.
+     *
+     * @param worker_id Worker that left.
+     * @param tasks Tasks of that worker.
+     * @return Number of tasks that stay at the worker (synchronized by its scheduling).
+     */
+    static std::uint64_t migrate(const std::uint16_t worker_id, queue::List<TaskInterface> &tasks) noexcept
+    {
+        return _scheduler->migrate(worker_id, tasks);
+    }
+
+    /**
+     * Re-homes resources synchronized by scheduling after the set of workers was resized.
+     *
+     * @param worker_id Worker that holds no task.
+     */
+    static void rehome_resources(const std::uint16_t worker_id) noexcept { _scheduler->rehome_resources(worker_id); }
+
+    /**
+     * @param worker_id Worker about to execute the task.
+     * @param task Task to execute.
+     * @return True, if the resource of the task was re-homed to another worker.
+     */
+    [[nodiscard]] static bool is_rehomed(const std::uint16_t worker_id, const TaskInterface &task) noexcept
+    {
+        return _scheduler->is_rehomed(worker_id, task);
+    }
+
     static void initialize_worker(const std::uint16_t worker_id)
     {
         _worker_id = worker_id;
@@ -543,9 +811,10 @@ class runtime_guard
 {
 public:
     runtime_guard(const bool use_system_allocator, const util::core_set &core_set,
-                  const PrefetchDistance prefetch_distance = PrefetchDistance{0U}) noexcept
+                  const PrefetchDistance prefetch_distance = PrefetchDistance{0U},
+                  const runtime_config &configuration = runtime_config{}) noexcept
     {
-        runtime::init(core_set, prefetch_distance, use_system_allocator);
+        runtime::init(core_set, prefetch_distance, use_system_allocator, configuration);
     }
 
     runtime_guard(const util::core_set &core_set,
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "config.h"
+#include <cstdint>
+
+namespace mx::tasking {
+/**
+ * Settings of the runtime that are chosen when initializing the runtime
+ * (see runtime::init) instead of compiling them into the binary.
+ * Defaults are taken from the (compile-time) config. Workers specialize
+ * their execution loop for the chosen combination of settings; thus,
+ * disabled features do not cost anything while executing tasks.
+ */
+class runtime_config
+{
+public:
+    constexpr runtime_config() noexcept = default;
+    constexpr runtime_config(const runtime_config &) noexcept = default;
+    ~runtime_config() noexcept = default;
+
+    runtime_config &operator=(const runtime_config &) noexcept = default;
+
+    /**
+     * Backend of the task queues: Either the worker-owned backend
+     * compiled into the task pools (config::queue()) or queues shared
+     * by the workers of a NUMA region (config::queue_backend::NUMAShared).
+     */
+    void queue(const config::queue_backend queue_backend) noexcept { _queue = queue_backend; }
+
+    /**
+     * Number of tasks the workers fetch into their task buffer at once,
+     * limited by the capacity of the buffer (config::task_buffer_size()).
+     */
+    void task_buffer_size(const std::uint16_t task_buffer_size) noexcept { _task_buffer_size = task_buffer_size; }
+
+    /**
+     * Scheme to reclaim memory of resources that are synchronized optimistically.
+     */
+    void memory_reclamation(const config::memory_reclamation_scheme scheme) noexcept { _memory_reclamation = scheme; }
+
+    /**
+     * Interval (in milliseconds) in which idle workers return the empty blocks
+     * of their resource heap to the global heap; zero disables the compaction.
+     */
+    void memory_compaction_interval(const std::uint32_t milliseconds) noexcept
+    {
+        _memory_compaction_interval = milliseconds;
+    }
+
+    /**
+     * Record the number of executed and dispatched tasks per worker.
+     */
+    void use_task_counter(const bool is_use_task_counter) noexcept { _is_use_task_counter = is_use_task_counter; }
+
+    /**
+     * Record the runtime of every task.
+     */
+    void collect_task_traces(const bool is_collect) noexcept { _is_collect_task_traces = is_collect; }
+
+    /**
+     * Let dataflow graphs record start times of pipelines and finish times of nodes.
+     */
+    void record_graph_times(const bool is_record) noexcept { _is_record_graph_times = is_record; }
+
+    /**
+     * Dispatch memory- and compute-bound tasks to different hardware threads of a
+     * physical core (only when compiled in, see config::is_consider_resource_bound_workers()).
+     */
+    void consider_resource_bound_workers(const bool is_consider) noexcept
+    {
+        _is_consider_resource_bound_workers = is_consider;
+    }
+
+    [[nodiscard]] config::queue_backend queue() const noexcept { return _queue; }
+    [[nodiscard]] std::uint16_t task_buffer_size() const noexcept { return _task_buffer_size; }
+    [[nodiscard]] config::memory_reclamation_scheme memory_reclamation() const noexcept { return _memory_reclamation; }
+    [[nodiscard]] std::uint32_t memory_compaction_interval() const noexcept { return _memory_compaction_interval; }
+    [[nodiscard]] bool is_use_task_counter() const noexcept { return _is_use_task_counter; }
+    [[nodiscard]] bool is_collect_task_traces() const noexcept { return _is_collect_task_traces; }
+    [[nodiscard]] bool is_record_graph_times() const noexcept { return _is_record_graph_times; }
+    [[nodiscard]] bool is_consider_resource_bound_workers() const noexcept
+    {
+        return _is_consider_resource_bound_workers;
+    }
+
+    bool operator==(const runtime_config &other) const noexcept = default;
+
+private:
+    config::queue_backend _queue{config::queue()};
+    std::uint16_t _task_buffer_size{config::task_buffer_size()};
+    config::memory_reclamation_scheme _memory_reclamation{config::memory_reclamation()};
+    std::uint32_t _memory_compaction_interval{config::memory_compaction_interval()};
+    bool _is_use_task_counter{config::is_use_task_counter()};
+    bool _is_collect_task_traces{config::is_collect_task_traces()};
+    bool _is_record_graph_times{config::is_record_graph_times()};
+    bool _is_consider_resource_bound_workers{config::is_consider_resource_bound_workers()};
+};
+} // namespace mx::tasking
@@ -1,5 +1,6 @@
 #include "scheduler.h"
 #include "runtime.h"
+#include <algorithm>
 #include <mx/memory/global_heap.h>
 #include <mx/synchronization/synchronization.h>
 #include <mx/system/cpu.h>
@@ -10,18 +11,25 @@
 using namespace mx::tasking;
 
 Scheduler::Scheduler(const mx::util::core_set &core_set, const PrefetchDistance prefetch_distance,
-                     memory::dynamic::local::Allocator &resource_allocator) noexcept
-    : _core_set(core_set), _prefetch_distance(prefetch_distance), _worker({nullptr}),
+                     memory::dynamic::local::Allocator &resource_allocator,
+                     const runtime_config &configuration) noexcept
+    : _core_set(core_set), _prefetch_distance(prefetch_distance), _config(configuration), _worker({nullptr}),
+      _count_active_workers(core_set.count_cores()),
       _epoch_manager(core_set.count_cores(), resource_allocator, _is_running)
 {
     this->_worker_numa_node_map.fill(0U);
+    this->_resize_lock.unlock();
+    for (auto worker_id = std::uint16_t(0U); worker_id < config::max_cores(); ++worker_id)
+    {
+        this->_resource_home_worker_ids[worker_id].store(worker_id, std::memory_order_relaxed);
+    }
 
     /// Set up profiling utilities.
-    if constexpr (config::is_use_task_counter())
+    if (this->_config.is_use_task_counter())
     {
         this->_task_counter.emplace(profiling::TaskCounter{this->_core_set.count_cores()});
     }
-    if constexpr (config::is_collect_task_traces() || config::is_monitor_task_cycles_for_prefetching())
+    if (this->_config.is_collect_task_traces() || config::is_monitor_task_cycles_for_prefetching())
     {
         this->_task_tracer.emplace(profiling::TaskTracer{this->_core_set.count_cores()});
     }
@@ -38,8 +46,70 @@ Scheduler::Scheduler(const mx::util::core_set &core_set, const PrefetchDistance
 
         this->_worker[worker_id] = new (memory::GlobalHeap::allocate(numa_node_id, sizeof(Worker)))
             Worker(this->_core_set.count_cores(), worker_id, core_id, this->_is_running, prefetch_distance,
-                   this->_epoch_manager[worker_id], this->_epoch_manager.global_epoch(), this->_task_counter,
-                   this->_task_tracer);
+                   this->_epoch_manager, this->_task_counter, this->_task_tracer, this->_idle_profiler,
+                   this->_task_cycle_accounting, this->_resource_boundness_classifier, this->_config);
+
+        if (this->_numa_worker_ids.size() <= numa_node_id)
+        {
+            this->_numa_worker_ids.resize(numa_node_id + 1U);
+        }
+        this->_numa_worker_ids[numa_node_id].emplace_back(worker_id);
+    }
+
+    /// Connect the workers of every NUMA region to a shared queue.
+    if (this->_config.queue() == config::queue_backend::NUMAShared)
+    {
+        this->_shared_queues.resize(this->_numa_worker_ids.size(), nullptr);
+        for (auto numa_node_id = std::uint8_t(0U); numa_node_id < this->_numa_worker_ids.size(); ++numa_node_id)
+        {
+            if (this->_numa_worker_ids[numa_node_id].empty() == false)
+            {
+                this->_shared_queues[numa_node_id] =
+                    new (memory::GlobalHeap::allocate(numa_node_id, sizeof(NUMASharedTaskQueue)))
+                        NUMASharedTaskQueue();
+                for (const auto worker_id : this->_numa_worker_ids[numa_node_id])
+                {
+                    this->_worker[worker_id]->queues().share(this->_shared_queues[numa_node_id]);
+                }
+            }
+        }
+    }
+
+    /// Set up the victims for work stealing: Siblings on the same
+    /// NUMA node first, workers on remote nodes afterwards. Every
+    /// worker starts with its right neighbour to spread the pressure.
+    if constexpr (config::is_use_work_stealing())
+    {
+        const auto count_workers = this->_core_set.count_cores();
+        for (auto worker_id = std::uint16_t(0U); worker_id < count_workers; ++worker_id)
+        {
+            const auto numa_node_id = this->_worker_numa_node_map[worker_id];
+
+            auto victims = std::vector<TaskPool *>{};
+            victims.reserve(count_workers - 1U);
+
+            for (auto offset = 1U; offset < count_workers; ++offset)
+            {
+                const auto victim_id = (worker_id + offset) % count_workers;
+                if (this->_worker_numa_node_map[victim_id] == numa_node_id)
+                {
+                    victims.emplace_back(&this->_worker[victim_id]->queues());
+                }
+            }
+
+            const auto count_local_victims = victims.size();
+
+            for (auto offset = 1U; offset < count_workers; ++offset)
+            {
+                const auto victim_id = (worker_id + offset) % count_workers;
+                if (this->_worker_numa_node_map[victim_id] != numa_node_id)
+                {
+                    victims.emplace_back(&this->_worker[victim_id]->queues());
+                }
+            }
+
+            this->_worker[worker_id]->steal_from(std::move(victims), count_local_victims);
+        }
     }
 
     /// Create map of resource workers on a physical core.
@@ -82,13 +152,25 @@ Scheduler::~Scheduler() noexcept
         worker->~Worker();
         memory::GlobalHeap::free(worker, sizeof(Worker));
     });
+
+    for (auto *shared_queue : this->_shared_queues)
+    {
+        if (shared_queue != nullptr)
+        {
+            shared_queue->~NUMASharedTaskQueue();
+            memory::GlobalHeap::free(shared_queue, sizeof(NUMASharedTaskQueue));
+        }
+    }
 }
 
 void Scheduler::start_and_wait()
 {
     // Create threads for worker...
+    /// Quiescent-state-based reclamation is driven by the workers.
+    const auto is_reclaiming_memory = this->_config.memory_reclamation() != config::None &&
+                                      this->_config.memory_reclamation() != config::QuiescentStateBased;
     std::vector<std::thread> worker_threads(this->_core_set.count_cores() +
-                                            static_cast<std::uint16_t>(config::memory_reclamation() != config::None));
+                                            static_cast<std::uint16_t>(is_reclaiming_memory));
     for (auto worker_id = 0U; worker_id < this->_core_set.count_cores(); ++worker_id)
     {
         auto *worker = this->_worker[worker_id];
@@ -99,7 +181,7 @@ void Scheduler::start_and_wait()
     }
 
     // ... and epoch management (if enabled).
-    if constexpr (config::memory_reclamation() != config::None)
+    if (is_reclaiming_memory)
     {
         const auto memory_reclamation_thread_id = this->_core_set.count_cores();
 
@@ -122,7 +204,7 @@ void Scheduler::start_and_wait()
         worker_thread.join();
     }
 
-    if constexpr (config::memory_reclamation() != config::None)
+    if (this->_config.memory_reclamation() != config::None)
     {
         // At this point, no task will execute on any resource;
         // but the epoch manager has joined, too. Therefore,
@@ -138,7 +220,7 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
     /// or just using the worker_id as worker_id (virtualization off).
     const auto has_local_worker_id = local_worker_id != std::numeric_limits<std::uint16_t>::max();
 
-    if constexpr (config::is_use_task_counter())
+    if (this->_task_counter.has_value())
     {
         if (has_local_worker_id) [[likely]]
         {
@@ -166,8 +248,8 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
             return resource_worker_id;
         }
 
-        /// Consider resource boundness.
-        resource_worker_id = this->bound_aware_worker_id(resource_worker_id, annotation.resource_boundness());
+        /// Consider resource boundness and the home of resources synchronized by scheduling.
+        resource_worker_id = this->executing_worker_id(task, annotated_resource);
 
         // For performance reasons, we prefer the local (not synchronized) queue
         // whenever possible to spawn the task. The decision is based on the
@@ -177,7 +259,7 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
                                        resource_worker_id, local_worker_id))
         {
             this->_worker[local_worker_id]->queues().push_back_local(&task);
-            if constexpr (config::is_use_task_counter())
+            if (this->_task_counter.has_value())
             {
                 this->_task_counter->increment<profiling::TaskCounter::DispatchedLocally>(local_worker_id);
             }
@@ -188,14 +270,16 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
         {
             this->_worker[resource_worker_id]->queues().push_back_remote(&task, this->numa_node_id(local_worker_id),
                                                                          local_worker_id);
+            this->wake_up(resource_worker_id);
         }
         else
         {
             this->_worker[resource_worker_id]->queues().push_back_remote(&task, system::cpu::node_id(),
                                                                          runtime::worker_id());
+            this->wake_up(resource_worker_id);
         }
 
-        if constexpr (config::is_use_task_counter())
+        if (this->_task_counter.has_value())
         {
             if (has_local_worker_id) [[likely]]
             {
@@ -205,11 +289,14 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
         return resource_worker_id;
     }
 
-    // The developer assigned a fixed channel to the task.
-    if (annotation.has_worker_id())
+    // The developer assigned a fixed channel or NUMA region to the task.
+    if (annotation.has_worker_id() || annotation.has_numa_node_id())
     {
+        const auto worker_id = annotation.has_worker_id()
+                                   ? annotation.worker_id()
+                                   : this->numa_worker_id(annotation.numa_node_id(), local_worker_id);
         const auto target_worker_id =
-            this->bound_aware_worker_id(annotation.worker_id(), annotation.resource_boundness());
+            this->active_worker_id(this->bound_aware_worker_id(worker_id, this->resource_boundness(task)));
 
         if (has_local_worker_id)
         {
@@ -218,7 +305,7 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
             if (local_worker_id == target_worker_id)
             {
                 this->_worker[target_worker_id]->queues().push_back_local(&task);
-                if constexpr (config::is_use_task_counter())
+                if (this->_task_counter.has_value())
                 {
                     this->_task_counter->increment<profiling::TaskCounter::DispatchedLocally>(target_worker_id);
                 }
@@ -228,14 +315,16 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
 
             this->_worker[target_worker_id]->queues().push_back_remote(&task, this->numa_node_id(local_worker_id),
                                                                        local_worker_id);
+            this->wake_up(target_worker_id);
         }
         else
         {
             this->_worker[target_worker_id]->queues().push_back_remote(&task, system::cpu::node_id(),
                                                                        runtime::worker_id());
+            this->wake_up(target_worker_id);
         }
 
-        if constexpr (config::is_use_task_counter())
+        if (this->_task_counter.has_value())
         {
             if (has_local_worker_id) [[likely]]
             {
@@ -246,32 +335,17 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
         return target_worker_id;
     }
 
-    // The developer assigned a fixed NUMA region to the task.
-    //    if (annotation.has_numa_node_id())
-    //    {
-    //        this->_numa_node_queues[annotation.numa_node_id()].get(annotation.priority()).push_back(&task);
-    //        if constexpr (config::is_use_task_counter())
-    //        {
-    //            if (current_channel_id != std::numeric_limits<std::uint16_t>::max()) [[likely]]
-    //            {
-    //                this->_task_counter->increment<profiling::TaskCounter::DispatchedRemotely>(current_channel_id);
-    //            }
-    //        }
-    //
-    //        /// TODO: What to return?
-    //        return 0U;
-    //    }
-
     // The task should be spawned on the local channel.
     if (annotation.is_locally())
     {
         if (has_local_worker_id) [[likely]]
         {
-            const auto target_worker_id = this->bound_aware_worker_id(local_worker_id, annotation.resource_boundness());
+            const auto target_worker_id = this->active_worker_id(this->bound_aware_worker_id(
+                this->locality_aware_worker_id(annotation, local_worker_id), this->resource_boundness(task)));
             if (target_worker_id == local_worker_id)
             {
                 this->_worker[local_worker_id]->queues().push_back_local(&task);
-                if constexpr (config::is_use_task_counter())
+                if (this->_task_counter.has_value())
                 {
                     this->_task_counter->increment<profiling::TaskCounter::DispatchedLocally>(local_worker_id);
                 }
@@ -281,7 +355,8 @@ std::uint16_t Scheduler::dispatch(TaskInterface &task, const std::uint16_t local
 
             this->_worker[target_worker_id]->queues().push_back_remote(&task, this->numa_node_id(local_worker_id),
                                                                        local_worker_id);
-            if constexpr (config::is_use_task_counter())
+            this->wake_up(target_worker_id);
+            if (this->_task_counter.has_value())
             {
                 this->_task_counter->increment<profiling::TaskCounter::DispatchedRemotely>(local_worker_id);
             }
@@ -312,6 +387,194 @@ std::uint16_t Scheduler::dispatch(TaskInterface &first, TaskInterface &last, con
     return local_worker_id;
 }
 
+void Scheduler::dispatch(const std::span<TaskInterface *> tasks, const std::uint16_t target_worker_id,
+                         const std::uint16_t local_worker_id) noexcept
+{
+    const auto worker_id = this->active_worker_id(target_worker_id);
+
+    /// Link the tasks, every change of the priority starts a new list. Tasks annotated
+    /// with a resource are dispatched with regard to the synchronization of the resource.
+    TaskInterface *first = nullptr;
+    TaskInterface *last = nullptr;
+    auto count_batched_tasks = std::uint64_t(0U);
+    for (auto *task : tasks)
+    {
+        if (task->annotation().has_resource())
+        {
+            this->dispatch(*task, local_worker_id);
+            continue;
+        }
+
+        if (first == nullptr)
+        {
+            first = task;
+        }
+        else if (task->annotation().priority() != first->annotation().priority())
+        {
+            this->push_back(first, last, worker_id, local_worker_id);
+            first = task;
+        }
+        else
+        {
+            last->next(task);
+        }
+        last = task;
+        ++count_batched_tasks;
+    }
+
+    if (count_batched_tasks == 0U)
+    {
+        return;
+    }
+    this->push_back(first, last, worker_id, local_worker_id);
+
+    if (this->_task_counter.has_value())
+    {
+        if (local_worker_id != std::numeric_limits<std::uint16_t>::max()) [[likely]]
+        {
+            this->count_batch(worker_id, local_worker_id, count_batched_tasks);
+        }
+    }
+
+    if (worker_id != local_worker_id)
+    {
+        this->wake_up(worker_id);
+    }
+}
+
+void Scheduler::dispatch(const std::span<TaskInterface *> tasks, const std::uint16_t local_worker_id) noexcept
+{
+    /// Batches are built by workers only.
+    if (local_worker_id == std::numeric_limits<std::uint16_t>::max()) [[unlikely]]
+    {
+        for (auto *task : tasks)
+        {
+            this->dispatch(*task, local_worker_id);
+        }
+        return;
+    }
+
+    /// Group the tasks by the worker and priority they are dispatched to.
+    auto &groups = this->_worker[local_worker_id]->batch_groups();
+    for (auto *task : tasks)
+    {
+        const auto target_worker_id = this->batch_worker_id(*task, local_worker_id);
+        if (target_worker_id.has_value())
+        {
+            groups.add(target_worker_id.value(), task);
+        }
+        else
+        {
+            this->dispatch(*task, local_worker_id);
+        }
+    }
+
+    /// Hand over the lists of every touched worker.
+    groups.flush([this, local_worker_id](const std::uint16_t worker_id,
+                                         const std::array<TaskBatchGroups::list, count_priorities> &lists,
+                                         const std::uint64_t count_tasks) {
+        for (const auto [first, last] : lists)
+        {
+            if (first != nullptr)
+            {
+                this->push_back(first, last, worker_id, local_worker_id);
+            }
+        }
+
+        if (this->_task_counter.has_value())
+        {
+            this->count_batch(worker_id, local_worker_id, count_tasks);
+        }
+
+        if (worker_id != local_worker_id)
+        {
+            this->wake_up(worker_id);
+        }
+    });
+}
+
+void Scheduler::count_batch(const std::uint16_t target_worker_id, const std::uint16_t local_worker_id,
+                            const std::uint64_t count_tasks) noexcept
+{
+    this->_task_counter->add<profiling::TaskCounter::Dispatched>(local_worker_id, count_tasks);
+    if (target_worker_id == local_worker_id)
+    {
+        this->_task_counter->add<profiling::TaskCounter::DispatchedLocally>(local_worker_id, count_tasks);
+    }
+    else
+    {
+        this->_task_counter->add<profiling::TaskCounter::DispatchedRemotely>(local_worker_id, count_tasks);
+    }
+}
+
+std::optional<std::uint16_t> Scheduler::batch_worker_id(const TaskInterface &task,
+                                                        const std::uint16_t local_worker_id) noexcept
+{
+    /// Batches are built by workers only.
+    if (local_worker_id == std::numeric_limits<std::uint16_t>::max()) [[unlikely]]
+    {
+        return std::nullopt;
+    }
+
+    const auto &annotation = task.annotation();
+    if (annotation.has_resource())
+    {
+        const auto annotated_resource = annotation.resource();
+        if (annotated_resource.synchronization_primitive() == synchronization::primitive::Batched)
+        {
+            return std::nullopt;
+        }
+
+        const auto resource_worker_id = this->executing_worker_id(task, annotated_resource);
+        if (Scheduler::keep_task_local(annotation.is_readonly(), annotated_resource.synchronization_primitive(),
+                                       resource_worker_id, local_worker_id))
+        {
+            return local_worker_id;
+        }
+
+        return resource_worker_id;
+    }
+
+    if (annotation.has_worker_id())
+    {
+        return this->active_worker_id(
+            this->bound_aware_worker_id(annotation.worker_id(), this->resource_boundness(task)));
+    }
+
+    if (annotation.has_numa_node_id())
+    {
+        return this->active_worker_id(this->bound_aware_worker_id(
+            this->numa_worker_id(annotation.numa_node_id(), local_worker_id), this->resource_boundness(task)));
+    }
+
+    if (annotation.is_locally())
+    {
+        return this->active_worker_id(this->bound_aware_worker_id(
+            this->locality_aware_worker_id(annotation, local_worker_id), this->resource_boundness(task)));
+    }
+
+    return std::nullopt;
+}
+
+void Scheduler::push_back(TaskInterface *first, TaskInterface *last, const std::uint16_t target_worker_id,
+                          const std::uint16_t local_worker_id) noexcept
+{
+    if (target_worker_id == local_worker_id)
+    {
+        this->_worker[local_worker_id]->queues().push_back_local(first, last);
+    }
+    else if (local_worker_id != std::numeric_limits<std::uint16_t>::max()) [[likely]]
+    {
+        this->_worker[target_worker_id]->queues().push_back_remote(first, last, this->numa_node_id(local_worker_id),
+                                                                   local_worker_id);
+    }
+    else
+    {
+        this->_worker[target_worker_id]->queues().push_back_remote(first, last, system::cpu::node_id(),
+                                                                   runtime::worker_id());
+    }
+}
+
 std::uint16_t Scheduler::dispatch(const mx::resource::ptr squad, const enum annotation::resource_boundness boundness,
                                   const std::uint16_t local_worker_id) noexcept
 {
@@ -320,9 +583,125 @@ std::uint16_t Scheduler::dispatch(const mx::resource::ptr squad, const enum anno
     return this->dispatch(*dispatch_task, local_worker_id);
 }
 
+std::uint64_t Scheduler::migrate(const std::uint16_t worker_id, queue::List<TaskInterface> &tasks) noexcept
+{
+    const auto numa_node_id = this->numa_node_id(worker_id);
+    auto next_worker_id = std::uint16_t(0U);
+    auto count_kept_tasks = std::uint64_t(0U);
+
+    while (auto *task = tasks.pop_front())
+    {
+        const auto &annotation = task->annotation();
+
+        auto target_worker_id = std::uint16_t(0U);
+        if (annotation.has_resource())
+        {
+            target_worker_id = this->active_worker_id(annotation.resource().worker_id(),
+                                                      annotation.resource().synchronization_primitive());
+        }
+        else if (annotation.has_worker_id())
+        {
+            target_worker_id = this->active_worker_id(annotation.worker_id());
+        }
+        else
+        {
+            /// Tasks that were spawned locally may run on any active worker.
+            target_worker_id = next_worker_id++ % this->count_active_workers();
+        }
+
+        /// The leaving worker migrates its own tasks and owns the local queue.
+        if (target_worker_id == worker_id)
+        {
+            this->_worker[worker_id]->queues().push_back_local(task);
+            ++count_kept_tasks;
+            continue;
+        }
+
+        this->_worker[target_worker_id]->queues().push_back_remote(task, numa_node_id, worker_id);
+        this->wake_up(target_worker_id);
+    }
+
+    return count_kept_tasks;
+}
+
+std::uint16_t Scheduler::resize(const std::uint16_t count_workers,
+                                std::function<void(std::uint16_t)> &&resized_callback) noexcept
+{
+    if constexpr (config::is_allow_resizing_workers())
+    {
+        this->_resize_lock.lock();
+        this->_count_pending_active_workers.store(
+            std::clamp<std::uint16_t>(count_workers, 1U, this->_core_set.count_cores()));
+        this->_resized_callback = std::move(resized_callback);
+
+        /// Running graphs partitioned their work (and worker-local state) by the number of workers.
+        if (this->_count_running_graphs.load() == 0U)
+        {
+            this->apply_resize();
+        }
+
+        const auto count_active_workers = this->_count_active_workers.load();
+        this->_resize_lock.unlock();
+
+        return count_active_workers;
+    }
+    else
+    {
+        return this->_core_set.count_cores();
+    }
+}
+
+void Scheduler::apply_resize() noexcept
+{
+    const auto count_old_active_workers = this->_count_active_workers.load();
+    const auto count_active_workers = this->_count_pending_active_workers.exchange(0U);
+
+    /// Joining workers are activated before tasks are dispatched to them.
+    for (auto worker_id = count_old_active_workers; worker_id < count_active_workers; ++worker_id)
+    {
+        this->_worker[worker_id]->activate();
+    }
+
+    this->_count_active_workers.store(count_active_workers);
+
+    /// Leaving workers will hand over their tasks and suspend.
+    for (auto worker_id = count_active_workers; worker_id < count_old_active_workers; ++worker_id)
+    {
+        this->_worker[worker_id]->deactivate();
+    }
+
+    if (this->_resized_callback)
+    {
+        auto resized_callback = std::move(this->_resized_callback);
+        this->_resized_callback = nullptr;
+        resized_callback(count_active_workers);
+    }
+}
+
+void Scheduler::rehome_resources(const std::uint16_t worker_id) noexcept
+{
+    if constexpr (config::is_allow_resizing_workers())
+    {
+        for (auto resource_worker_id = std::uint16_t(0U); resource_worker_id < this->_core_set.count_cores();
+             ++resource_worker_id)
+        {
+            auto &home_worker_id = this->_resource_home_worker_ids[resource_worker_id];
+            if (home_worker_id.load(std::memory_order_relaxed) == worker_id)
+            {
+                /// Tasks queued at this worker afterwards will follow the resource (see is_rehomed()).
+                const auto active_worker_id = this->active_worker_id(resource_worker_id);
+                if (active_worker_id != worker_id)
+                {
+                    home_worker_id.store(active_worker_id, std::memory_order_release);
+                }
+            }
+        }
+    }
+}
+
 void Scheduler::reset() noexcept
 {
-    if constexpr (config::is_use_task_counter())
+    if (this->_task_counter.has_value())
     {
         this->_task_counter->clear();
     }
@@ -332,12 +711,23 @@ void Scheduler::reset() noexcept
 
 void Scheduler::start_idle_profiler()
 {
-    // TODO: Should we measure idle times?
-    //    this->_idle_profiler.start();
-    //    for (auto worker_id = 0U; worker_id < this->_core_set.count_cores(); ++worker_id)
-    //    {
-    //        this->_idle_profiler.start(this->_worker[worker_id]->channel());
-    //    }
+    this->_idle_profiler.start(this->_core_set.count_cores());
+}
+
+std::array<std::uint64_t, config::max_prefetch_distance() + 1U> Scheduler::prefetch_distance_histogram()
+    const noexcept
+{
+    auto histogram = std::array<std::uint64_t, config::max_prefetch_distance() + 1U>{};
+    for (auto worker_id = 0U; worker_id < this->_core_set.count_cores(); ++worker_id)
+    {
+        const auto worker_histogram = this->_worker[worker_id]->prefetch_distance_controller().histogram();
+        for (auto distance = 0U; distance < histogram.size(); ++distance)
+        {
+            histogram[distance] += worker_histogram[distance];
+        }
+    }
+
+    return histogram;
 }
 
 std::unordered_map<std::string, std::vector<std::pair<std::uintptr_t, std::uintptr_t>>> Scheduler::memory_tags()
@@ -1,5 +1,7 @@
 #pragma once
 #include "prefetch_distance.h"
+#include "resource_boundness_classifier.h"
+#include "runtime_config.h"
 #include "shared_task_queue.h"
 #include "task.h"
 #include "task_squad.h"
@@ -8,19 +10,25 @@
 #include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mx/memory/config.h>
 #include <mx/memory/reclamation/epoch_manager.h>
 #include <mx/memory/worker_local_dynamic_size_allocator.h>
+#include <mx/queue/list.h>
 #include <mx/resource/ptr.h>
+#include <mx/synchronization/spinlock.h>
 #include <mx/tasking/profiling/idle_profiler.h>
+#include <mx/tasking/profiling/task_cycle_accounting.h>
 #include <mx/tasking/profiling/task_counter.h>
 #include <mx/tasking/profiling/task_tracer.h>
 #include <mx/util/core_set.h>
 #include <mx/util/random.h>
 #include <optional>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace mx::tasking {
 /**
@@ -31,7 +39,8 @@ class Scheduler
 {
 public:
     Scheduler(const util::core_set &core_set, PrefetchDistance prefetch_distance,
-              memory::dynamic::local::Allocator &resource_allocator) noexcept;
+              memory::dynamic::local::Allocator &resource_allocator,
+              const runtime_config &configuration = runtime_config{}) noexcept;
     ~Scheduler() noexcept;
 
     /**
@@ -54,6 +63,30 @@ public:
      */
     std::uint16_t dispatch(TaskInterface &first, TaskInterface &last, std::uint16_t local_worker_id) noexcept;
 
+    /**
+     * Schedules a batch of tasks to the given worker. The tasks are linked
+     * and handed over to the worker with a single queue operation per priority.
+     * Tasks annotated with a resource are dispatched one by one with regard to
+     * the synchronization of the resource.
+     *
+     * @param tasks Tasks to be scheduled.
+     * @param target_worker_id Worker the tasks are scheduled to.
+     * @param local_worker_id Worker, the request came from.
+     */
+    void dispatch(std::span<TaskInterface *> tasks, std::uint16_t target_worker_id,
+                  std::uint16_t local_worker_id) noexcept;
+
+    /**
+     * Schedules a batch of tasks, each with regard to its annotation. Tasks
+     * are grouped by their target worker and priority; every group is handed
+     * over to the worker with a single queue operation. Tasks that need
+     * special treatment (e.g., tasks on squads) are dispatched one by one.
+     *
+     * @param tasks Tasks to be scheduled.
+     * @param local_worker_id Worker, the request came from.
+     */
+    void dispatch(std::span<TaskInterface *> tasks, std::uint16_t local_worker_id) noexcept;
+
     /**
      * Schedules all tasks of a given squad.
      * @param squad Squad to be scheduled.
@@ -63,6 +96,114 @@ public:
     std::uint16_t dispatch(mx::resource::ptr squad, enum annotation::resource_boundness boundness,
                            std::uint16_t local_worker_id) noexcept;
 
+    /**
+     * Hands over tasks of a worker that left the set of active workers
+     * to the active workers. Tasks are dispatched to the worker that took
+     * over the annotated resource or worker; others are distributed
+     * round robin. Tasks of resources that are synchronized by scheduling
+     * stay at the leaving worker, which executes them before suspending;
+     * afterwards, the resources are re-homed (see rehome_resources()).
+     *
+     * @param worker_id Worker that left and hands over the tasks.
+     * @param tasks Tasks to hand over.
+     * @return Number of tasks that stay at the leaving worker.
+     */
+    std::uint64_t migrate(std::uint16_t worker_id, queue::List<TaskInterface> &tasks) noexcept;
+
+    /**
+     * Resizes the set of active workers to the first count_workers workers
+     * of the core set while the runtime is running. Leaving workers hand over
+     * their tasks and suspend; joining workers resume. Tasks dispatched to
+     * inactive workers are redirected to active workers. Since dataflow graphs
+     * partition their work by the number of workers, the resize waits until
+     * the running graphs completed: It is applied by the last completing graph
+     * or before the next graph starts, whichever comes first.
+     *
+     * @param count_workers Number of workers that should be active.
+     * @param resized_callback Called with the number of active workers once the
+     *  workers were resized, before any graph starts on the resized set (e.g.,
+     *  to re-home data partitioned by the workers).
+     * @return The number of active workers; unchanged until running graphs completed.
+     */
+    std::uint16_t resize(std::uint16_t count_workers, std::function<void(std::uint16_t)> &&resized_callback) noexcept;
+
+    /**
+     * Registers a dataflow graph that is started; a pending resize is applied first,
+     * if no other graph is running. Otherwise, it waits until the graph completed.
+     */
+    void register_running_graph() noexcept
+    {
+        if constexpr (config::is_allow_resizing_workers())
+        {
+            this->_resize_lock.lock();
+            if (this->_count_running_graphs.fetch_add(1U, std::memory_order_relaxed) == 0U &&
+                this->_count_pending_active_workers.load(std::memory_order_relaxed) > 0U) [[unlikely]]
+            {
+                this->apply_resize();
+            }
+            this->_resize_lock.unlock();
+        }
+    }
+
+    /**
+     * Unregisters a dataflow graph that completed; the last running graph
+     * applies a pending resize.
+     */
+    void unregister_running_graph() noexcept
+    {
+        if constexpr (config::is_allow_resizing_workers())
+        {
+            if (this->_count_running_graphs.fetch_sub(1U) == 1U &&
+                this->_count_pending_active_workers.load() > 0U) [[unlikely]]
+            {
+                this->_resize_lock.lock();
+                if (this->_count_running_graphs.load(std::memory_order_relaxed) == 0U &&
+                    this->_count_pending_active_workers.load(std::memory_order_relaxed) > 0U)
+                {
+                    this->apply_resize();
+                }
+                this->_resize_lock.unlock();
+            }
+        }
+    }
+
+    /**
+     * Hands the resources synchronized by scheduling (ScheduleAll, ScheduleWriter)
+     * that are homed at the given worker over to the worker they belong to:
+     * Resources of workers that left are re-homed to an active worker, resources
+     * of workers that joined again return to their worker. Called by the worker
+     * while it holds no task (e.g., when idling); thus, tasks of a resource are
+     * never executed by two workers at the same time.
+     *
+     * @param worker_id Worker that holds no task.
+     */
+    void rehome_resources(std::uint16_t worker_id) noexcept;
+
+    /**
+     * Checks if the given task accesses a resource synchronized by scheduling that was
+     * re-homed to another worker while the task was queued; the task has to follow.
+     *
+     * @param worker_id Worker about to execute the task.
+     * @param task Task to execute.
+     * @return True, if the task has to be dispatched to the home worker of its resource.
+     */
+    [[nodiscard]] bool is_rehomed(const std::uint16_t worker_id, const TaskInterface &task) const noexcept
+    {
+        const auto &annotation = task.annotation();
+        if (annotation.has_resource())
+        {
+            const auto resource = annotation.resource();
+            const auto primitive = resource.synchronization_primitive();
+            if (primitive == synchronization::primitive::ScheduleAll ||
+                (primitive == synchronization::primitive::ScheduleWriter && annotation.is_readonly() == false))
+            {
+                return this->home_worker_id(resource.worker_id()) != worker_id;
+            }
+        }
+
+        return false;
+    }
+
     /**
      * Starts all worker threads and waits until they finish.
      */
@@ -75,6 +216,16 @@ public:
     void interrupt() noexcept
     {
         _is_running = false;
+
+        /// Parked and suspended workers have to notice the interrupt.
+        if constexpr (config::worker_mode() == config::worker_mode::Adaptive || config::is_allow_resizing_workers())
+        {
+            for (auto worker_id = std::uint16_t(0U); worker_id < _core_set.count_cores(); ++worker_id)
+            {
+                _worker[worker_id]->wake_up();
+            }
+        }
+
         if (this->_idle_profiler.is_running())
         {
             this->_idle_profiler.stop();
@@ -101,6 +252,22 @@ public:
      */
     [[nodiscard]] std::uint16_t count_cores() const noexcept { return _core_set.count_cores(); }
 
+    /**
+     * @return Number of workers that execute tasks; equals the number of cores
+     *  unless the set of workers was resized.
+     */
+    [[nodiscard]] std::uint16_t count_active_workers() const noexcept
+    {
+        if constexpr (config::is_allow_resizing_workers())
+        {
+            return _count_active_workers.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            return _core_set.count_cores();
+        }
+    }
+
     /**
      * @return Number of all numa regions.
      */
@@ -111,6 +278,11 @@ public:
      */
     [[nodiscard]] PrefetchDistance prefetch_distance() const noexcept { return _prefetch_distance; }
 
+    /**
+     * @return The settings the scheduler and its workers were created with.
+     */
+    [[nodiscard]] const runtime_config &configuration() const noexcept { return _config; }
+
     /**
      * Reads the NUMA region of a given worker thread.
      * @param worker_id Worker.
@@ -170,6 +342,12 @@ public:
      */
     [[nodiscard]] profiling::IdleTimes stop_idle_profiler() { return this->_idle_profiler.stop(); }
 
+    /**
+     * @return Number of prefetches scheduled with every distance (index), summed up over all workers.
+     */
+    [[nodiscard]] std::array<std::uint64_t, config::max_prefetch_distance() + 1U> prefetch_distance_histogram()
+        const noexcept;
+
     /**
      * @return Statistic.
      */
@@ -180,6 +358,19 @@ public:
      */
     [[nodiscard]] std::optional<profiling::TaskTracer> &task_tracer() noexcept { return _task_tracer; }
 
+    /**
+     * @return Accounting of task cycles per trace id.
+     */
+    [[nodiscard]] profiling::TaskCycleAccounting &task_cycle_accounting() noexcept { return _task_cycle_accounting; }
+
+    /**
+     * @return Online classification of tasks into compute- and memory-bound.
+     */
+    [[nodiscard]] const ResourceBoundnessClassifier &resource_boundness_classifier() const noexcept
+    {
+        return _resource_boundness_classifier;
+    }
+
     [[nodiscard]] std::unordered_map<std::string, std::vector<std::pair<std::uintptr_t, std::uintptr_t>>> memory_tags();
 
     bool operator==(const util::core_set &cores) const noexcept { return _core_set == cores; }
@@ -240,15 +431,43 @@ private:
     // Number of tasks a resource will be prefetched in front of.
     const PrefetchDistance _prefetch_distance;
 
+    // Settings chosen at runtime.
+    const runtime_config _config;
+
     // All initialized workers.
     std::array<Worker *, config::max_cores()> _worker{nullptr};
 
     // Map of worker id to NUMA region id.
     std::array<std::uint8_t, config::max_cores()> _worker_numa_node_map{0U};
 
+    // Workers of every NUMA region, used to dispatch tasks to the region of their data.
+    std::vector<std::vector<std::uint16_t>> _numa_worker_ids;
+
+    // Queues shared by the workers of a NUMA region (only when selected as queue backend).
+    std::vector<NUMASharedTaskQueue *> _shared_queues;
+
     // Map of worker id to physical resource worker ids.
     std::array<PhysicalCoreResourceWorkerIds, config::max_cores()> _resource_worker_ids;
 
+    // Number of active workers; workers with a higher id are suspended.
+    alignas(64) std::atomic_uint16_t _count_active_workers;
+
+    // Map of worker id to the worker executing tasks of resources synchronized by scheduling
+    // that are mapped to the worker (differs while the worker left the active workers).
+    std::array<std::atomic_uint16_t, config::max_cores()> _resource_home_worker_ids;
+
+    // Lock to serialize resizing of the active workers.
+    synchronization::Spinlock _resize_lock;
+
+    // Number of active workers of a resize waiting for running graphs; zero if none is pending.
+    std::atomic_uint16_t _count_pending_active_workers{0U};
+
+    // Callback of the pending resize.
+    std::function<void(std::uint16_t)> _resized_callback;
+
+    // Number of dataflow graphs that were started and did not complete, yet.
+    std::atomic_uint32_t _count_running_graphs{0U};
+
     // Flag for the worker threads. If false, the worker threads will stop.
     // This is atomic for hardware that does not guarantee atomic reads/writes of booleans.
     alignas(64) util::maybe_atomic<bool> _is_running{false};
@@ -265,6 +484,43 @@ private:
     // Recorder for tracing task run times.
     alignas(64) std::optional<profiling::TaskTracer> _task_tracer{std::nullopt};
 
+    // Accounting of task cycles, can be switched on and off at runtime.
+    alignas(64) profiling::TaskCycleAccounting _task_cycle_accounting;
+
+    // Classification of tasks into compute- and memory-bound, filled by the workers.
+    alignas(64) ResourceBoundnessClassifier _resource_boundness_classifier;
+
+    /**
+     * Calculates the worker a task of a batch will be scheduled to.
+     *
+     * @param task Task to schedule.
+     * @param local_worker_id Worker, the request came from.
+     * @return The target worker or std::nullopt, if the task has to be dispatched on its own.
+     */
+    [[nodiscard]] std::optional<std::uint16_t> batch_worker_id(const TaskInterface &task,
+                                                               std::uint16_t local_worker_id) noexcept;
+
+    /**
+     * Hands over a list of linked tasks with the same priority to the given worker.
+     *
+     * @param first First task of the list.
+     * @param last Last task of the list.
+     * @param target_worker_id Worker the tasks are scheduled to.
+     * @param local_worker_id Worker, the request came from.
+     */
+    void push_back(TaskInterface *first, TaskInterface *last, std::uint16_t target_worker_id,
+                   std::uint16_t local_worker_id) noexcept;
+
+    /**
+     * Counts the tasks of a batch handed over to the given worker as dispatched
+     * (locally or remotely). Requires the task counter.
+     *
+     * @param target_worker_id Worker the tasks are scheduled to.
+     * @param local_worker_id Worker, the request came from.
+     * @param count_tasks Number of tasks handed over.
+     */
+    void count_batch(std::uint16_t target_worker_id, std::uint16_t local_worker_id, std::uint64_t count_tasks) noexcept;
+
     /**
      * Make a decision whether a task should be scheduled to the local
      * channel or a remote.
@@ -285,18 +541,222 @@ private:
                 primitive != synchronization::primitive::ScheduleWriter);
     }
 
-    [[nodiscard]] inline std::uint16_t bound_aware_worker_id(
-        const std::uint16_t worker_id, [[maybe_unused]] const enum annotation::resource_boundness boundness)
+    /**
+     * Chooses a worker on the given NUMA region. The local worker is preferred;
+     * otherwise, every worker is mapped to a fixed worker of the region to
+     * spread the tasks of different spawning workers.
+     *
+     * @param numa_node_id NUMA region the task should be executed on.
+     * @param local_worker_id Worker, the request came from (may be invalid).
+     * @return Id of a worker on the given region; the local worker, if the region has no worker.
+     */
+    [[nodiscard]] std::uint16_t numa_worker_id(const std::uint8_t numa_node_id,
+                                               const std::uint16_t local_worker_id) const noexcept
+    {
+        const auto is_local_worker = local_worker_id < _core_set.count_cores();
+        if (numa_node_id >= _numa_worker_ids.size() || _numa_worker_ids[numa_node_id].empty())
+        {
+            return is_local_worker ? local_worker_id : 0U;
+        }
+
+        if (is_local_worker && _worker_numa_node_map[local_worker_id] == numa_node_id)
+        {
+            return local_worker_id;
+        }
+
+        const auto &worker_ids = _numa_worker_ids[numa_node_id];
+        return worker_ids[is_local_worker ? local_worker_id % worker_ids.size() : 0U];
+    }
+
+    /**
+     * Calculates the worker for a task that should be executed locally. When
+     * locality aware dispatching is enabled and the task references data by
+     * its prefetch hint, a worker on the NUMA region of the data is chosen.
+     * The region is derived from the placement of the data's memory (not the
+     * worker the data was created for, which differs for replicas or tiles
+     * allocated from another worker's arena); data interleaved over all
+     * regions stays with the spawning worker.
+     *
+     * @param annotation Annotation of the task.
+     * @param local_worker_id Worker, the request came from.
+     * @return Id of the worker the task should be executed on.
+     */
+    [[nodiscard]] std::uint16_t locality_aware_worker_id([[maybe_unused]] const annotation &annotation,
+                                                         const std::uint16_t local_worker_id) const noexcept
+    {
+        if constexpr (config::is_use_locality_aware_dispatch())
+        {
+            const auto accessed_resource = annotation.accessed_resource();
+            if (accessed_resource != nullptr && local_worker_id < _core_set.count_cores())
+            {
+                const auto numa_node_id = _worker[local_worker_id]->numa_node_cache().lookup(accessed_resource.get());
+                if (numa_node_id.has_value())
+                {
+                    return this->numa_worker_id(numa_node_id.value(), local_worker_id);
+                }
+            }
+        }
+
+        return local_worker_id;
+    }
+
+    /**
+     * Wakes up the given worker after dispatching a task to its queues,
+     * in case the worker is parked.
+     *
+     * @param worker_id Worker that received a task.
+     */
+    void wake_up([[maybe_unused]] const std::uint16_t worker_id) noexcept
+    {
+        if constexpr (config::worker_mode() == config::worker_mode::Adaptive)
+        {
+            /// Order the push of the task before reading the park state of the worker.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            _worker[worker_id]->wake_up();
+        }
+    }
+
+    /**
+     * Redirects the given worker id to an active worker,
+     * if the worker left the set of active workers.
+     *
+     * @param worker_id Worker id a task is dispatched to.
+     * @return Id of an active worker.
+     */
+    [[nodiscard]] std::uint16_t active_worker_id(const std::uint16_t worker_id) const noexcept
+    {
+        if constexpr (config::is_allow_resizing_workers())
+        {
+            const auto count_active_workers = _count_active_workers.load(std::memory_order_relaxed);
+            return worker_id < count_active_workers ? worker_id : worker_id % count_active_workers;
+        }
+        else
+        {
+            return worker_id;
+        }
+    }
+
+    /**
+     * Redirects the worker of a resource to an active worker, if the worker left
+     * the set of active workers. Resources that are synchronized by scheduling go
+     * to their home worker: They stay at a leaving worker until it executed their
+     * queued tasks, which would otherwise run concurrently to tasks of the substitute.
+     *
+     * @param worker_id Worker the resource is mapped to.
+     * @param primitive Synchronization primitive of the resource.
+     * @return Id of the worker executing tasks of the resource.
+     */
+    [[nodiscard]] std::uint16_t active_worker_id(const std::uint16_t worker_id,
+                                                 const synchronization::primitive primitive) const noexcept
+    {
+        if (Scheduler::is_synchronized_by_scheduling(primitive))
+        {
+            return this->home_worker_id(worker_id);
+        }
+
+        return this->active_worker_id(worker_id);
+    }
+
+    /**
+     * @param worker_id Worker a resource synchronized by scheduling is mapped to.
+     * @return Worker executing the tasks of the resource (see rehome_resources()).
+     */
+    [[nodiscard]] std::uint16_t home_worker_id(const std::uint16_t worker_id) const noexcept
+    {
+        if constexpr (config::is_allow_resizing_workers())
+        {
+            return _resource_home_worker_ids[worker_id].load(std::memory_order_acquire);
+        }
+        else
+        {
+            return worker_id;
+        }
+    }
+
+    /**
+     * Chooses the worker executing a task that accesses the given resource. Tasks of
+     * resources synchronized by scheduling are executed by the home worker of the
+     * resource only; other tasks consider their resource boundness.
+     *
+     * @param task Task to dispatch.
+     * @param resource Resource annotated to the task.
+     * @return Id of the worker executing the task.
+     */
+    [[nodiscard]] std::uint16_t executing_worker_id(const TaskInterface &task,
+                                                    const mx::resource::ptr resource) const noexcept
+    {
+        const auto primitive = resource.synchronization_primitive();
+        if (Scheduler::is_synchronized_by_scheduling(primitive))
+        {
+            return this->home_worker_id(resource.worker_id());
+        }
+
+        return this->active_worker_id(
+            this->bound_aware_worker_id(resource.worker_id(), this->resource_boundness(task)));
+    }
+
+    /**
+     * Activates the first workers and deactivates the others, according to the
+     * pending resize, and calls the callback of the resize. The caller holds the resize lock.
+     */
+    void apply_resize() noexcept;
+
+    [[nodiscard]] static bool is_synchronized_by_scheduling(const synchronization::primitive primitive) noexcept
+    {
+        return primitive == synchronization::primitive::ScheduleAll ||
+               primitive == synchronization::primitive::ScheduleWriter;
+    }
+
+    /**
+     * The boundness annotated to the task wins. Tasks annotated as 'mixed' that are
+     * free to run on any worker fall back to the boundness classified online.
+     *
+     * @param task Task to dispatch.
+     * @return Resource boundness of the task.
+     */
+    [[nodiscard]] inline enum annotation::resource_boundness resource_boundness(
+        const TaskInterface &task) const noexcept
     {
+        const auto boundness = task.annotation().resource_boundness();
         if constexpr (config::is_consider_resource_bound_workers())
         {
-            //            if (_worker[worker_id]->load() < .25)
-            //            {
-            //                return worker_id;
-            //            }
+            if (boundness == annotation::resource_boundness::mixed && _config.is_consider_resource_bound_workers() &&
+                TaskStealing::is_stealable(&task))
+            {
+                return _resource_boundness_classifier.get(task.trace_id());
+            }
+        }
 
-            return _resource_worker_ids[worker_id][boundness];
-            //            return worker_id;
+        return boundness;
+    }
+
+    /**
+     * Chooses the hardware thread of the physical core of the given worker that executes
+     * tasks of the given boundness. While the thread of the class is busy and the given
+     * worker idles (e.g., only tasks of one class are queued), the task stays at the worker.
+     *
+     * @param worker_id Worker the task was dispatched to.
+     * @param boundness Resource boundness of the task.
+     * @return Worker that executes the task.
+     */
+    [[nodiscard]] inline std::uint16_t bound_aware_worker_id(
+        const std::uint16_t worker_id, [[maybe_unused]] const enum annotation::resource_boundness boundness) const
+    {
+        if constexpr (config::is_consider_resource_bound_workers())
+        {
+            if (_config.is_consider_resource_bound_workers() == false)
+            {
+                return worker_id;
+            }
+
+            const auto bound_worker_id = _resource_worker_ids[worker_id][boundness];
+            if (bound_worker_id != worker_id && _worker[worker_id]->load() < .25F &&
+                _worker[bound_worker_id]->load() >= .5F)
+            {
+                return worker_id;
+            }
+
+            return bound_worker_id;
         }
         else
         {
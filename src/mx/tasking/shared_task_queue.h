@@ -6,13 +6,22 @@
 #include <mx/queue/priority_queue.h>
 
 namespace mx::tasking {
+/**
+ * Bounded queue that can be produced and consumed by multiple workers.
+ */
 template <std::size_t CAPACITY> class SharedTaskQueue
 {
 public:
     SharedTaskQueue() : _queue(CAPACITY) {}
     ~SharedTaskQueue() = default;
 
-    void push_back(TaskInterface *task) noexcept { _queue.try_push_back(task); }
+    /**
+     * Tries to insert the task.
+     *
+     * @param task Task to insert.
+     * @return True, if the task was inserted; false, if the queue is full.
+     */
+    [[nodiscard]] bool push_back(TaskInterface *task) noexcept { return _queue.try_push_back(task); }
 
     [[nodiscard]] TaskInterface *pop_front() noexcept
     {
@@ -28,5 +37,5 @@ private:
 };
 
 using GlobalSharedTaskQueue = queue::PriorityQueue<SharedTaskQueue<1U << 22U>, priority::low, priority::normal>;
-using NUMASharedTaskQueue = queue::PriorityQueue<SharedTaskQueue<1U << 20U>, priority::low, priority::normal>;
+using NUMASharedTaskQueue = queue::PriorityQueue<SharedTaskQueue<1U << 18U>, min_priority, max_priority>;
 } // namespace mx::tasking
\ No newline at end of file
@@ -209,7 +209,7 @@ public:
     void annotate(const std::uint8_t node_id) noexcept { _annotation.set(node_id); }
 
     /**
-     * Annotate the task with a run priority (low, normal, high).
+     * Annotate the task with a run priority (low, normal, high, critical).
      *
      * @param priority_ Priority the task should run with.
      */
@@ -246,6 +246,14 @@ public:
      */
     void annotate(const annotation::access_intention access_intention) noexcept { _annotation.set(access_intention); }
 
+    /**
+     * Annotate the task whether it has to be executed by the worker it is dispatched to
+     * or may be stolen by other workers, even if annotated with a worker id.
+     *
+     * @param worker_binding Binding of the task to the worker (unbound by default).
+     */
+    void annotate(const annotation::worker_binding worker_binding) noexcept { _annotation.set(worker_binding); }
+
     /**
      * @return Pointer to the next task in spawn queue.
      */
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "config.h"
+#include "priority.h"
+#include "task.h"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace mx::tasking {
+/**
+ * Groups the tasks of a batch by the worker and priority they are dispatched to.
+ * Every group links its tasks to a list that is handed over to the task pool
+ * of the worker with a single queue operation. Only workers that receive tasks
+ * are touched; the groups are reset while they are handed over. The groups are
+ * not thread-safe, every worker owns its groups.
+ */
+class TaskBatchGroups
+{
+public:
+    /// List of linked tasks (first and last task).
+    using list = std::pair<TaskInterface *, TaskInterface *>;
+
+    TaskBatchGroups() noexcept { _group_ids.fill(std::numeric_limits<std::uint16_t>::max()); }
+    ~TaskBatchGroups() noexcept = default;
+
+    /**
+     * Appends the task to the group of the given worker.
+     *
+     * @param worker_id Worker the task will be dispatched to.
+     * @param task Task to append.
+     */
+    void add(const std::uint16_t worker_id, TaskInterface *task) noexcept
+    {
+        auto group_id = _group_ids[worker_id];
+        if (group_id == std::numeric_limits<std::uint16_t>::max())
+        {
+            group_id = _count_groups++;
+            _group_ids[worker_id] = group_id;
+            _groups[group_id].worker_id = worker_id;
+            _groups[group_id].lists.fill(list{nullptr, nullptr});
+        }
+
+        auto &[first, last] = _groups[group_id].lists[std::uint8_t(task->annotation().priority())];
+        if (first == nullptr)
+        {
+            first = task;
+        }
+        else
+        {
+            last->next(task);
+        }
+        last = task;
+        ++_groups[group_id].count_tasks;
+    }
+
+    /**
+     * @return Number of workers that receive tasks.
+     */
+    [[nodiscard]] std::uint16_t count_groups() const noexcept { return _count_groups; }
+
+    /**
+     * Calls the callback for every group in the order the workers were touched
+     * and resets the groups afterward.
+     *
+     * @param callback Callback receiving the worker id, the lists (one per priority), and the number of tasks.
+     */
+    template <typename F> void flush(F &&callback) noexcept
+    {
+        for (auto group_id = std::uint16_t(0U); group_id < _count_groups; ++group_id)
+        {
+            auto &group = _groups[group_id];
+            callback(group.worker_id, group.lists, group.count_tasks);
+            _group_ids[group.worker_id] = std::numeric_limits<std::uint16_t>::max();
+            group.count_tasks = 0U;
+        }
+        _count_groups = 0U;
+    }
+
+private:
+    struct Group
+    {
+        // Worker the tasks of the group are dispatched to.
+        std::uint16_t worker_id;
+
+        // Number of tasks in all lists.
+        std::uint64_t count_tasks{0U};
+
+        // Linked tasks, one list per priority.
+        std::array<list, count_priorities> lists;
+    };
+
+    // Group of every worker, or max if the worker has no group.
+    std::array<std::uint16_t, config::max_cores()> _group_ids;
+
+    // Groups of the touched workers, in the order they were touched.
+    std::array<Group, config::max_cores()> _groups;
+
+    // Number of touched workers.
+    std::uint16_t _count_groups{0U};
+};
+} // namespace mx::tasking
@@ -1,10 +1,12 @@
 #pragma once
 #include "load.h"
 #include "prefetch_distance.h"
+#include "prefetch_distance_controller.h"
 #include "prefetch_slot.h"
 #include "task.h"
 #include "task_cycle_sampler.h"
 #include "task_execution_time_history.h"
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <mx/memory/config.h>
@@ -16,6 +18,8 @@ namespace mx::tasking {
 /**
  * The task buffer holds tasks that are ready to execute.
  * The buffer is realized as a ring buffer with a fixed size.
+ * The number of tasks held at once can be limited to a capacity
+ * below that size, chosen when the runtime is initialized.
  * All empty slots are null pointers.
  */
 template <std::size_t S> class TaskBuffer
@@ -64,8 +68,8 @@ public:
     };
 
 public:
-    constexpr explicit TaskBuffer(const PrefetchDistance prefetch_distance) noexcept
-        : _prefetch_distance(prefetch_distance)
+    constexpr explicit TaskBuffer(const PrefetchDistance prefetch_distance, const std::uint16_t capacity = S) noexcept
+        : _prefetch_distance(prefetch_distance), _capacity(std::min<std::uint16_t>(capacity, S))
     {
     }
     ~TaskBuffer() noexcept = default;
@@ -86,12 +90,12 @@ public:
     /**
      * @return Number of maximal tasks of the buffer.
      */
-    [[nodiscard]] constexpr auto max_size() const noexcept { return S; }
+    [[nodiscard]] std::uint16_t max_size() const noexcept { return _capacity; }
 
     /**
      * @return Number of free slots.
      */
-    [[nodiscard]] std::uint16_t available_slots() const noexcept { return S - size(); }
+    [[nodiscard]] std::uint16_t available_slots() const noexcept { return _capacity - size(); }
 
     Slot &next() noexcept
     {
@@ -119,6 +123,11 @@ public:
     {
         if (this->_prefetch_distance.is_enabled())
         {
+            if (this->is_tuning_prefetch_distance())
+            {
+                return std::max<std::uint8_t>(this->_task_cycles.size(), config::max_prefetch_distance());
+            }
+
             return this->_prefetch_distance.is_automatic() ? this->_task_cycles.size()
                                                            : this->_prefetch_distance.fixed_distance();
         }
@@ -128,12 +137,33 @@ public:
 
     [[nodiscard]] bool is_prefetching_enabled() const noexcept { return this->_prefetch_distance.is_enabled(); }
 
+    /**
+     * @return True, if the automatic prefetch distance is tuned per task type.
+     */
+    [[nodiscard]] bool is_tuning_prefetch_distance() const noexcept
+    {
+        return config::is_tune_prefetch_distance() && this->_prefetch_distance.is_automatic();
+    }
+
     [[nodiscard]] TaskCycleSampler &sampler() noexcept { return _task_cycle_sampler; }
 
+    [[nodiscard]] PrefetchDistanceController &prefetch_distance_controller() noexcept
+    {
+        return _prefetch_distance_controller;
+    }
+
+    [[nodiscard]] const PrefetchDistanceController &prefetch_distance_controller() const noexcept
+    {
+        return _prefetch_distance_controller;
+    }
+
 private:
     /// Prefetch distance.
     const PrefetchDistance _prefetch_distance;
 
+    /// Maximal number of tasks held at once (at most S).
+    const std::uint16_t _capacity;
+
     /// Index of the first element in the buffer.
     std::uint16_t _head{0U};
 
@@ -149,6 +179,9 @@ private:
     /// Sample for monitoring task cycles.
     TaskCycleSampler _task_cycle_sampler;
 
+    /// Prefetch distances tuned per task type.
+    PrefetchDistanceController _prefetch_distance_controller;
+
     /**
      * Normalizes the index with respect to the size.
      * @param index Index.
@@ -206,7 +239,7 @@ std::uint16_t TaskBuffer<S>::fill(Q &from_queue, std::uint16_t count) noexcept
         return 0U;
     }
 
-    const auto size = S - count;
+    const auto size = this->size();
     TaskInterface *task;
 
     if constexpr (std::is_same<Q, mx::queue::List<TaskInterface>>::value)
@@ -251,8 +284,19 @@ std::uint16_t TaskBuffer<S>::fill(Q &from_queue, std::uint16_t count) noexcept
                     const auto needed_cycles_latency =
                         prefetched_cache_lines * memory::config::latency_per_prefetched_cache_line();
 
-                    /// Go back (towards head) until latency is hidden by task executions.
-                    const auto prefetch_distance = this->_task_cycles.prefetch_distance(needed_cycles_latency);
+                    /// Go back (towards head) until latency is hidden by task executions;
+                    /// when tuning, the history only estimates the distance of unknown task types.
+                    auto prefetch_distance = std::uint8_t(0U);
+                    if (this->is_tuning_prefetch_distance())
+                    {
+                        prefetch_distance = this->_prefetch_distance_controller.distance(task->trace_id(), [&] {
+                            return this->_task_cycles.prefetch_distance(needed_cycles_latency);
+                        });
+                    }
+                    else
+                    {
+                        prefetch_distance = this->_task_cycles.prefetch_distance(needed_cycles_latency);
+                    }
 
                     /// Schedule the prefetch to tail - prefetch distance.
                     this->_buffer[TaskBuffer<S>::normalize_backward(task_buffer_index, prefetch_distance)].prefetch(
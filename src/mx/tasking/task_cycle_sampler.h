@@ -10,7 +10,7 @@
 namespace mx::tasking {
 class TaskCycleSampler
 {
-private:
+public:
     class Sample
     {
     public:
@@ -32,12 +32,20 @@ private:
             _average_cycles = _cycles / _count;
         }
 
+        void add(const std::uint32_t cycles, const std::uint64_t llc_misses) noexcept
+        {
+            this->add(cycles);
+            _llc_misses += llc_misses;
+        }
+
         [[nodiscard]] std::uint32_t average() const noexcept { return _average_cycles; }
 
         [[nodiscard]] std::uint64_t count() const noexcept { return _count; }
 
         [[nodiscard]] std::uint64_t cycles() const noexcept { return _cycles; }
 
+        [[nodiscard]] std::uint64_t llc_misses() const noexcept { return _llc_misses; }
+
     private:
         /// Number of how many times this task was sampled.
         std::uint64_t _count{0U};
@@ -45,11 +53,14 @@ private:
         /// Number of cycles sampled for this task.
         std::uint64_t _cycles{0U};
 
+        /// Number of last-level cache misses sampled for this task
+        /// (only when classifying the resource boundness).
+        std::uint64_t _llc_misses{0U};
+
         /// Number of cycles in average (_count/_cycles).
         std::uint32_t _average_cycles{0U};
     };
 
-public:
     TaskCycleSampler() { _task_cycles.reserve(16U); }
 
     ~TaskCycleSampler() = default;
@@ -69,6 +80,27 @@ public:
         }
     }
 
+    /**
+     * Adds a sample including the last-level cache misses of the task.
+     *
+     * @param task_id Trace id of the sampled task.
+     * @param cycles Cycles of the task.
+     * @param llc_misses Last-level cache misses of the task.
+     * @return All samples of the task, or nullptr if the task has no trace id.
+     */
+    const Sample *add(const std::uint64_t task_id, const std::uint64_t cycles, const std::uint64_t llc_misses)
+    {
+        if (task_id == 0U)
+        {
+            return nullptr;
+        }
+
+        auto iterator = _task_cycles.try_emplace(task_id).first;
+        iterator.value().add(cycles, llc_misses);
+
+        return &iterator->second;
+    }
+
     [[nodiscard]] std::uint32_t cycles(TaskInterface *task) const
     {
         if constexpr (config::is_monitor_task_cycles_for_prefetching())
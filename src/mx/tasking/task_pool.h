@@ -1,10 +1,12 @@
 #pragma once
 
 #include "config.h"
+#include "shared_task_queue.h"
 #include "task.h"
 #include "task_buffer.h"
 #include "task_pool_occupancy.h"
 #include "task_queues.h"
+#include <algorithm>
 #include <array>
 #include <mx/memory/config.h>
 #include <mx/queue/list.h>
@@ -14,26 +16,123 @@
 namespace mx::tasking {
 class alignas(64) TaskPool
 {
+    static_assert(config::queue() != config::queue_backend::NUMAShared,
+                  "The shared queues complement the worker-owned queues and are selected at runtime.");
+
 public:
     explicit TaskPool(const std::uint16_t count_workers, const std::uint16_t worker_id, const std::uint8_t numa_id)
         : _queues(worker_id, numa_id, count_workers)
     {
     }
 
+    /**
+     * Fills the task buffer with tasks of all priorities. Every priority
+     * (but low) earns credits proportional to its weight for each refill,
+     * which are spent for taking tasks of that priority (highest priority
+     * first). Slots that are left free afterwards are filled with tasks of
+     * the highest priority available. Since unspent credits of non-empty
+     * priorities are carried over, every weighted priority will be served.
+     * Low prioritized tasks run in the background: they are taken only
+     * when no task of a higher priority is waiting.
+     *
+     * @param task_buffer Task buffer to fill.
+     * @return Number of occupied slots in the task buffer.
+     */
     [[nodiscard]] std::uint64_t withdraw(TaskBuffer<config::task_buffer_size()> &task_buffer) noexcept
     {
-        // Fill with normal prioritized.
-        const auto size = _queues.fill<priority::normal>(task_buffer, task_buffer.available_slots());
+        const auto available_slots = std::uint64_t(task_buffer.available_slots());
+        auto available = available_slots;
+
+        // 1) Fill every weighted priority according to its credit.
+        for (auto level = std::int16_t(max_priority); level >= std::int16_t(min_weighted_priority); --level)
+        {
+            auto &credit = _priority_credits[level - min_priority];
+            credit = std::min(credit + available_slots * config::priority_weight(level),
+                              task_buffer.max_size() * TaskPool::sum_priority_weights());
+
+            const auto quota = std::min(available, credit / TaskPool::sum_priority_weights());
+            const auto count_filled = this->fill(static_cast<enum priority>(level), task_buffer, quota);
+            if (count_filled < quota)
+            {
+                // The queues are drained; do not save credit for an idle priority.
+                credit = 0U;
+            }
+            else
+            {
+                credit -= count_filled * TaskPool::sum_priority_weights();
+            }
+
+            available -= count_filled;
+        }
+
+        // 2) Fill up the remaining slots, highest priority first.
+        for (auto level = std::int16_t(max_priority); level >= std::int16_t(min_weighted_priority) && available > 0U;
+             --level)
+        {
+            available -= this->fill(static_cast<enum priority>(level), task_buffer, available);
+        }
 
-        // Fill with low prioritized.
+        // 3) Fill with low prioritized tasks, when the worker would idle otherwise.
         if (task_buffer.empty()) [[unlikely]]
         {
-            return _queues.fill<priority::low>(task_buffer, config::task_buffer_size());
+            available -= this->fill(priority::low, task_buffer, available);
+        }
+
+        return task_buffer.max_size() - available;
+    }
+
+    /**
+     * Steals tasks from this pool into the task buffer of another
+     * (idle) worker. Only tasks that are allowed to run on a foreign
+     * worker will be stolen.
+     *
+     * @param task_buffer Task buffer of the stealing worker.
+     * @return Number of stolen tasks.
+     */
+    [[nodiscard]] std::uint16_t steal(TaskBuffer<config::task_buffer_size()> &task_buffer) noexcept
+    {
+        /// Leave some work for the owning worker.
+        const auto count = std::max<std::uint16_t>(1U, task_buffer.available_slots() / 2U);
+
+        for (auto level = std::int16_t(max_priority); level >= std::int16_t(min_priority); --level)
+        {
+            const auto count_stolen = _queues.steal(static_cast<enum priority>(level), task_buffer, count);
+            if (count_stolen > 0U)
+            {
+                return count_stolen;
+            }
         }
 
-        return size;
+        return 0U;
+    }
+
+    /**
+     * Takes all tasks out of this pool. Only the owning worker
+     * should drain its pool, e.g., when it leaves the set of
+     * active workers.
+     *
+     * @param tasks List where the tasks are appended to.
+     */
+    void drain(queue::List<TaskInterface> &tasks) noexcept { _queues.drain(tasks); }
+
+    /**
+     * @return True, when no task is waiting in any queue of this pool.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _queues.empty() && (_shared_queue == nullptr || _shared_queue->empty());
     }
 
+    /**
+     * Connects the pool to the queue shared by all workers of its NUMA region.
+     * Tasks that may run on any worker and are dispatched by other workers
+     * go to the shared queue; workers will take tasks from the shared queue
+     * after their own queues.
+     *
+     * @param shared_queue Queue of the NUMA region; nullptr to use the worker-owned queues only.
+     */
+    void share(NUMASharedTaskQueue *shared_queue) noexcept { _shared_queue = shared_queue; }
+
     /**
      * Schedules the task to thread-safe queue with regard to the NUMA region
      * of the producer. Producer of different NUMA regions should not share
@@ -45,12 +144,45 @@ public:
     void push_back_remote(TaskInterface *task, const std::uint8_t local_numa_node_id,
                           const std::uint16_t local_worker_id) noexcept
     {
-        _queues.push_back_remote(task, local_numa_node_id, local_worker_id);
+        if (this->try_push_back_shared(task) == false)
+        {
+            _queues.push_back_remote(task, local_numa_node_id, local_worker_id);
+        }
+    }
+
+    /**
+     * Schedules a list of linked tasks to the thread-safe queue with a single
+     * operation. All tasks of the list have to share the same priority.
+     * @param first First task to be scheduled.
+     * @param last Last task of the list.
+     * @param local_numa_node_id NUMA region of the producer.
+     * @param local_worker_id Worker ID of the producer.
+     */
+    void push_back_remote(TaskInterface *first, TaskInterface *last, const std::uint8_t local_numa_node_id,
+                          const std::uint16_t local_worker_id) noexcept
+    {
+        if (_shared_queue == nullptr)
+        {
+            _queues.push_back_remote(first, last, local_numa_node_id, local_worker_id);
+            return;
+        }
+
+        /// The shared queue holds single tasks; the list is split up.
+        auto *task = first;
+        while (task != nullptr)
+        {
+            auto *next = task != last ? task->next() : nullptr;
+            this->push_back_remote(task, local_numa_node_id, local_worker_id);
+            task = next;
+        }
     }
 
     /**
      * Schedules a task to the local queue, which is not thread-safe. Only
      * the channel owner should spawn tasks this way.
+     * Local tasks never go to the shared queue: The owner executes the tasks
+     * it spawned in order (e.g., tasks of a dataflow node before the pinned
+     * task finalizing that node).
      * @param task Task to be scheduled.
      */
     void push_back_local(TaskInterface *task) noexcept { _queues.push_back_local(task); }
@@ -98,9 +230,63 @@ public:
     }
 
 private:
+    /**
+     * Fills the task buffer with tasks of the given priority; tasks
+     * of the worker-owned queues are preferred over shared tasks.
+     *
+     * @param priority Priority of the tasks.
+     * @param task_buffer Task buffer to fill.
+     * @param count Maximal number of tasks.
+     * @return Number of tasks inserted into the task buffer.
+     */
+    [[nodiscard]] std::uint64_t fill(const enum priority priority, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                     const std::uint64_t count) noexcept
+    {
+        auto count_filled = _queues.fill(priority, task_buffer, count);
+        if (_shared_queue != nullptr && count_filled < count)
+        {
+            count_filled += task_buffer.fill(_shared_queue->get(priority), count - count_filled);
+        }
+
+        return count_filled;
+    }
+
+    /**
+     * Inserts the task into the shared queue, if the pool is connected to
+     * a shared queue and the task may be executed by any worker.
+     *
+     * @param task Task to insert.
+     * @return True, if the task was inserted into the shared queue.
+     */
+    [[nodiscard]] bool try_push_back_shared(TaskInterface *task) noexcept
+    {
+        return _shared_queue != nullptr && TaskStealing::is_stealable(task) &&
+               _shared_queue->get(task->annotation().priority()).push_back(task);
+    }
+
+    /**
+     * @return Sum of the weights of all weighted priorities.
+     */
+    [[nodiscard]] static constexpr std::uint64_t sum_priority_weights() noexcept
+    {
+        auto sum = std::uint64_t(0U);
+        for (auto level = std::uint8_t(min_weighted_priority); level <= std::uint8_t(max_priority); ++level)
+        {
+            sum += config::priority_weight(level);
+        }
+
+        return sum;
+    }
+
     /// Backend queues.
     TaskQueues<config::queue()> _queues;
 
+    /// Queue shared by all workers of the NUMA region, if enabled at runtime.
+    NUMASharedTaskQueue *_shared_queue{nullptr};
+
+    /// Credits of every priority, earned for each refill of the task buffer.
+    std::array<std::uint64_t, count_priorities> _priority_credits{};
+
     // Holder of resource predictions of this channel.
     alignas(64) TaskPoolOccupancy _occupancy;
 };
@@ -3,12 +3,124 @@
 #include "config.h"
 #include "task.h"
 #include "task_buffer.h"
+#include <algorithm>
 #include <mx/memory/config.h>
 #include <mx/queue/list.h>
 #include <mx/queue/mpsc.h>
 #include <mx/queue/priority_queue.h>
+#include <mx/synchronization/spinlock.h>
 
 namespace mx::tasking {
+/**
+ * Decides which tasks may be stolen by other workers and
+ * moves stealable tasks from a victims queue into the task
+ * buffer of the stealing worker.
+ */
+class TaskStealing
+{
+public:
+    /**
+     * Checks whether a task may be executed on a worker other than the
+     * one it was dispatched to. Tasks pinned or bound to a worker and tasks
+     * on resources that rely on being executed by the owning worker are not
+     * stealable. Tasks annotated as stealable may be stolen even though they
+     * were annotated with a worker id.
+     *
+     * @param task Task to check.
+     * @return True, when the task may be stolen.
+     */
+    [[nodiscard]] static bool is_stealable(const TaskInterface *task) noexcept
+    {
+        const auto &annotation = task->annotation();
+        if (annotation.is_bound_to_worker())
+        {
+            return false;
+        }
+
+        if (annotation.has_resource())
+        {
+            switch (annotation.resource().synchronization_primitive())
+            {
+            case synchronization::primitive::None:
+            case synchronization::primitive::ExclusiveLatch:
+            case synchronization::primitive::ReaderWriterLatch:
+            case synchronization::primitive::OLFIT:
+            case synchronization::primitive::RestrictedTransactionalMemory:
+                return true;
+            case synchronization::primitive::ScheduleWriter:
+                return annotation.is_readonly();
+            case synchronization::primitive::ScheduleAll:
+            case synchronization::primitive::Batched:
+                return false;
+            }
+        }
+
+        return annotation.has_worker_id() == false || annotation.is_stealable_from_worker();
+    }
+
+    /**
+     * Takes stealable tasks from the front of the given queue and inserts
+     * them into the task buffer. Stealing stops at the first task that is
+     * not stealable to keep the order of the remaining tasks.
+     * The caller has to ensure that no other consumer accesses the queue.
+     *
+     * @param from_queue Queue to steal from.
+     * @param task_buffer Task buffer of the stealing worker.
+     * @param count Maximal number of tasks to steal.
+     * @return Number of stolen tasks.
+     */
+    template <class Q>
+    [[nodiscard]] static std::uint16_t steal(Q &from_queue, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                             const std::uint16_t count) noexcept
+    {
+        auto stolen_tasks = queue::List<TaskInterface>{};
+        auto count_stolen_tasks = std::uint16_t(0U);
+
+        while (count_stolen_tasks < count)
+        {
+            auto *task = from_queue.front();
+            if (task == nullptr || TaskStealing::is_stealable(task) == false)
+            {
+                break;
+            }
+
+            task = from_queue.pop_front();
+            if (task == nullptr) [[unlikely]]
+            {
+                break;
+            }
+
+            stolen_tasks.push_back(task);
+            ++count_stolen_tasks;
+        }
+
+        return task_buffer.fill(stolen_tasks, count_stolen_tasks);
+    }
+};
+
+/**
+ * Takes all tasks out of a queue, e.g., to hand them
+ * over to other workers when a worker leaves.
+ */
+class TaskDrain
+{
+public:
+    /**
+     * Moves all tasks from the given queue to the given list.
+     * The caller has to ensure that no other consumer accesses the queue.
+     *
+     * @param from_queue Queue to take all tasks from.
+     * @param tasks List to append the tasks to.
+     */
+    template <class Q> static void drain(Q &from_queue, queue::List<TaskInterface> &tasks) noexcept
+    {
+        while (auto *task = from_queue.pop_front())
+        {
+            tasks.push_back(task);
+        }
+    }
+};
+
 template <config::queue_backend M> class TaskQueues
 {
 };
@@ -19,6 +131,7 @@ public:
     TaskQueues(const std::uint16_t /*worker_id*/, const std::uint8_t /*numa_node_id*/,
                const std::uint16_t /*count_workers*/)
     {
+        _consumer_lock.unlock();
     }
     ~TaskQueues() = default;
 
@@ -28,6 +141,12 @@ public:
         _queue.get(task->annotation().priority()).push_back(task);
     }
 
+    void push_back_remote(TaskInterface *first, TaskInterface *last, const std::uint8_t /*numa_node_id*/,
+                          const std::uint16_t /*local_worker_id*/) noexcept
+    {
+        _queue.get(first->annotation().priority()).push_back(first, last);
+    }
+
     void push_back_local(TaskInterface *task) noexcept { _queue.get(task->annotation().priority()).push_back(task); }
 
     void push_back_local(TaskInterface *first, TaskInterface *last) noexcept
@@ -35,19 +154,61 @@ public:
         _queue.get(first->annotation().priority()).push_back(first, last);
     }
 
-    template <priority P>
-    [[nodiscard]] std::uint64_t fill(TaskBuffer<config::task_buffer_size()> &task_buffer,
-                                     std::uint64_t available) noexcept
+    [[nodiscard]] bool empty() const noexcept { return _queue.empty(); }
+
+    [[nodiscard]] std::uint64_t fill(const enum priority priority, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                     const std::uint64_t count) noexcept
     {
-        available -= task_buffer.template fill(_queue.template get<P>(), available);
-        return task_buffer.max_size() - available;
+        auto available = count;
+
+        if constexpr (config::is_use_work_stealing())
+        {
+            _consumer_lock.lock();
+        }
+
+        available -= task_buffer.template fill(_queue.get(priority), available);
+
+        if constexpr (config::is_use_work_stealing())
+        {
+            _consumer_lock.unlock();
+        }
+
+        return count - available;
+    }
+
+    [[nodiscard]] std::uint16_t steal(const enum priority priority, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                      const std::uint16_t count) noexcept
+    {
+        auto &queue = _queue.get(priority);
+        if (queue.empty() || _consumer_lock.try_lock() == false)
+        {
+            return 0U;
+        }
+
+        const auto count_stolen = TaskStealing::steal(queue, task_buffer, count);
+        _consumer_lock.unlock();
+
+        return count_stolen;
+    }
+
+    void drain(queue::List<TaskInterface> &tasks) noexcept
+    {
+        _consumer_lock.lock();
+        for (auto level = std::uint8_t(min_priority); level <= std::uint8_t(max_priority); ++level)
+        {
+            TaskDrain::drain(_queue.get(static_cast<enum priority>(level)), tasks);
+        }
+        _consumer_lock.unlock();
     }
 
 private:
-    using MPSC = queue::PriorityQueue<queue::MPSC<TaskInterface>, priority::low, priority::normal>;
+    using MPSC = queue::PriorityQueue<queue::MPSC<TaskInterface>, min_priority, max_priority>;
 
     /// Single queue per worker.
     MPSC _queue;
+
+    /// Lock for consuming the queue, only used when other workers may steal tasks.
+    alignas(64) synchronization::Spinlock _consumer_lock;
 };
 
 template <> class TaskQueues<config::queue_backend::NUMALocal>
@@ -57,6 +218,7 @@ public:
                const std::uint16_t /*count_workers*/)
         : _numa_node_id(numa_node_id)
     {
+        _consumer_lock.unlock();
     }
     ~TaskQueues() = default;
 
@@ -66,6 +228,12 @@ public:
         _remote_queues[numa_node_id].get(task->annotation().priority()).push_back(task);
     }
 
+    void push_back_remote(TaskInterface *first, TaskInterface *last, const std::uint8_t numa_node_id,
+                          const std::uint16_t /*local_worker_id*/) noexcept
+    {
+        _remote_queues[numa_node_id].get(first->annotation().priority()).push_back(first, last);
+    }
+
     void push_back_local(TaskInterface *task) noexcept
     {
         _local_queue.get(task->annotation().priority()).push_back(task);
@@ -76,31 +244,88 @@ public:
         _local_queue.get(first->annotation().priority()).push_back(first, last);
     }
 
-    template <priority P>
-    [[nodiscard]] std::uint64_t fill(TaskBuffer<config::task_buffer_size()> &task_buffer,
-                                     std::uint64_t available) noexcept
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _local_queue.empty() && std::all_of(_remote_queues.begin(), _remote_queues.end(),
+                                                   [](const auto &queue) { return queue.empty(); });
+    }
+
+    [[nodiscard]] std::uint64_t fill(const enum priority priority, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                     const std::uint64_t count) noexcept
     {
+        auto available = count;
+
         // 1) Fill up from the local queue.
-        available -= task_buffer.fill(_local_queue.get<P>(), available);
+        available -= task_buffer.fill(_local_queue.get(priority), available);
 
         if (available > 0U)
         {
+            if constexpr (config::is_use_work_stealing())
+            {
+                _consumer_lock.lock();
+            }
+
             // 2) Fill up from remote queues; start with the NUMA-local one.
             for (auto numa_index = 0U; numa_index < memory::config::max_numa_nodes(); ++numa_index)
             {
                 static_assert((memory::config::max_numa_nodes() & (memory::config::max_numa_nodes() - 1U)) == 0U);
 
                 const auto numa_id = (_numa_node_id + numa_index) & (memory::config::max_numa_nodes() - 1U);
-                available -= task_buffer.fill(_remote_queues[numa_id].get<P>(), available);
+                available -= task_buffer.fill(_remote_queues[numa_id].get(priority), available);
+            }
+
+            if constexpr (config::is_use_work_stealing())
+            {
+                _consumer_lock.unlock();
             }
         }
 
-        return task_buffer.max_size() - available;
+        return count - available;
+    }
+
+    /**
+     * Steals tasks from the remote queues. The local queue is not
+     * thread-safe and, therefore, never stolen from.
+     */
+    [[nodiscard]] std::uint16_t steal(const enum priority priority, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                      std::uint16_t count) noexcept
+    {
+        if (_consumer_lock.try_lock() == false)
+        {
+            return 0U;
+        }
+
+        auto count_stolen = std::uint16_t(0U);
+        for (auto numa_id = 0U; numa_id < memory::config::max_numa_nodes() && count > 0U; ++numa_id)
+        {
+            const auto count_stolen_from_queue =
+                TaskStealing::steal(_remote_queues[numa_id].get(priority), task_buffer, count);
+            count_stolen += count_stolen_from_queue;
+            count -= count_stolen_from_queue;
+        }
+
+        _consumer_lock.unlock();
+
+        return count_stolen;
+    }
+
+    void drain(queue::List<TaskInterface> &tasks) noexcept
+    {
+        _consumer_lock.lock();
+        for (auto level = std::uint8_t(min_priority); level <= std::uint8_t(max_priority); ++level)
+        {
+            TaskDrain::drain(_local_queue.get(static_cast<enum priority>(level)), tasks);
+            for (auto &remote_queue : _remote_queues)
+            {
+                TaskDrain::drain(remote_queue.get(static_cast<enum priority>(level)), tasks);
+            }
+        }
+        _consumer_lock.unlock();
     }
 
 private:
-    using List = queue::PriorityQueue<queue::List<TaskInterface>, priority::low, priority::normal>;
-    using MPSC = queue::PriorityQueue<queue::MPSC<TaskInterface>, priority::low, priority::normal>;
+    using List = queue::PriorityQueue<queue::List<TaskInterface>, min_priority, max_priority>;
+    using MPSC = queue::PriorityQueue<queue::MPSC<TaskInterface>, min_priority, max_priority>;
 
     const std::uint8_t _numa_node_id;
 
@@ -109,6 +334,9 @@ private:
 
     // Backend queues for multiple produces in different NUMA regions and different priorities,
     alignas(64) std::array<MPSC, memory::config::max_numa_nodes()> _remote_queues;
+
+    // Lock for consuming the remote queues, only used when other workers may steal tasks.
+    alignas(64) synchronization::Spinlock _consumer_lock;
 };
 
 template <> class TaskQueues<config::queue_backend::WorkerLocal>
@@ -117,6 +345,7 @@ public:
     TaskQueues(const std::uint16_t worker_id, const std::uint8_t /*numa_node_id*/, const std::uint16_t count_workers)
         : _worker_id(worker_id), _count_workers(count_workers)
     {
+        _consumer_lock.unlock();
     }
     ~TaskQueues() = default;
 
@@ -126,6 +355,12 @@ public:
         _queues[local_worker_id].get(task->annotation().priority()).push_back(task);
     }
 
+    void push_back_remote(TaskInterface *first, TaskInterface *last, const std::uint8_t /*numa_node_id*/,
+                          const std::uint16_t local_worker_id) noexcept
+    {
+        _queues[local_worker_id].get(first->annotation().priority()).push_back(first, last);
+    }
+
     void push_back_local(TaskInterface *task) noexcept
     {
         _queues[_worker_id].get(task->annotation().priority()).push_back(task);
@@ -136,33 +371,83 @@ public:
         _queues[_worker_id].get(first->annotation().priority()).push_back(first, last);
     }
 
-    template <priority P>
-    [[nodiscard]] std::uint64_t fill(TaskBuffer<config::task_buffer_size()> &task_buffer,
-                                     std::uint64_t available) noexcept
+    [[nodiscard]] bool empty() const noexcept
     {
+        return std::all_of(_queues.begin(), _queues.begin() + _count_workers,
+                           [](const auto &queue) { return queue.empty(); });
+    }
+
+    [[nodiscard]] std::uint64_t fill(const enum priority priority, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                     const std::uint64_t count) noexcept
+    {
+        auto available = count;
+
+        if constexpr (config::is_use_work_stealing())
+        {
+            _consumer_lock.lock();
+        }
+
         auto worker_id = _worker_id;
-        for (auto i = 0U; i < _count_workers; ++i)
+        for (auto i = 0U; i < _count_workers && available > 0U; ++i)
         {
             const auto target_worker_id = (worker_id + i) % _count_workers;
-            available -= task_buffer.fill(_queues[target_worker_id].get<P>(), available);
+            available -= task_buffer.fill(_queues[target_worker_id].get(priority), available);
+        }
 
-            if (available == 0U)
+        if constexpr (config::is_use_work_stealing())
+        {
+            _consumer_lock.unlock();
+        }
+
+        return count - available;
+    }
+
+    [[nodiscard]] std::uint16_t steal(const enum priority priority, TaskBuffer<config::task_buffer_size()> &task_buffer,
+                                      std::uint16_t count) noexcept
+    {
+        if (_consumer_lock.try_lock() == false)
+        {
+            return 0U;
+        }
+
+        auto count_stolen = std::uint16_t(0U);
+        for (auto worker_id = 0U; worker_id < _count_workers && count > 0U; ++worker_id)
+        {
+            const auto count_stolen_from_queue =
+                TaskStealing::steal(_queues[worker_id].get(priority), task_buffer, count);
+            count_stolen += count_stolen_from_queue;
+            count -= count_stolen_from_queue;
+        }
+
+        _consumer_lock.unlock();
+
+        return count_stolen;
+    }
+
+    void drain(queue::List<TaskInterface> &tasks) noexcept
+    {
+        _consumer_lock.lock();
+        for (auto level = std::uint8_t(min_priority); level <= std::uint8_t(max_priority); ++level)
+        {
+            for (auto worker_id = 0U; worker_id < _count_workers; ++worker_id)
             {
-                return task_buffer.max_size();
+                TaskDrain::drain(_queues[worker_id].get(static_cast<enum priority>(level)), tasks);
             }
         }
-
-        return task_buffer.max_size() - available;
+        _consumer_lock.unlock();
     }
 
 private:
-    using MPSC = queue::PriorityQueue<queue::MPSC<TaskInterface>, priority::low, priority::normal>;
+    using MPSC = queue::PriorityQueue<queue::MPSC<TaskInterface>, min_priority, max_priority>;
 
     const std::uint16_t _worker_id;
     const std::uint16_t _count_workers;
 
     // One queue per worker.
     std::array<MPSC, config::max_cores()> _queues;
+
+    // Lock for consuming the queues, only used when other workers may steal tasks.
+    alignas(64) synchronization::Spinlock _consumer_lock;
 };
 
 } // namespace mx::tasking
\ No newline at end of file
@@ -11,13 +11,17 @@ using namespace mx::tasking;
 
 Worker::Worker(const std::uint16_t count_workers, const std::uint16_t worker_id, const std::uint16_t target_core_id,
                const util::maybe_atomic<bool> &is_running, const PrefetchDistance prefetch_distance,
-               memory::reclamation::LocalEpoch &local_epoch,
-               const std::atomic<memory::reclamation::epoch_t> &global_epoch,
-               std::optional<profiling::TaskCounter> &statistic,
-               std::optional<profiling::TaskTracer> &task_tracer) noexcept
-    : _id(worker_id), _target_core_id(target_core_id), _task_buffer(prefetch_distance),
-      _task_pool(count_workers, worker_id, system::cpu::node_id(target_core_id)), _local_epoch(local_epoch),
-      _global_epoch(global_epoch), _task_counter(statistic), _task_tracer(task_tracer), _is_running(is_running)
+               memory::reclamation::EpochManager &epoch_manager, std::optional<profiling::TaskCounter> &statistic,
+               std::optional<profiling::TaskTracer> &task_tracer, profiling::IdleProfiler &idle_profiler,
+               profiling::TaskCycleAccounting &task_cycle_accounting,
+               ResourceBoundnessClassifier &resource_boundness_classifier, const runtime_config &configuration) noexcept
+    : _id(worker_id), _target_core_id(target_core_id),
+      _task_buffer(prefetch_distance, configuration.task_buffer_size()),
+      _task_pool(count_workers, worker_id, system::cpu::node_id(target_core_id)),
+      _epoch_manager(epoch_manager), _local_epoch(epoch_manager[worker_id]),
+      _global_epoch(epoch_manager.global_epoch()), _task_counter(statistic), _task_tracer(task_tracer),
+      _idle_profiler(idle_profiler), _task_cycle_accounting(task_cycle_accounting),
+      _resource_boundness_classifier(resource_boundness_classifier), _is_running(is_running), _config(configuration)
 {
 }
 
@@ -25,9 +29,8 @@ void Worker::execute()
 {
     runtime::initialize_worker(this->_id);
 
-    decltype(std::chrono::system_clock::now()) trace_start;
-
-    const auto refill_treshold = this->_task_buffer.refill_treshold();
+    /// The histogram of prefetch distances covers a single run of the runtime.
+    this->_task_buffer.prefetch_distance_controller().reset_histogram();
 
     while (this->_is_running == false)
     {
@@ -35,49 +38,143 @@ void Worker::execute()
     }
 
     assert(this->_target_core_id == system::cpu::core_id() && "Worker not pinned to correct core.");
+
+    /// The counter for last-level cache misses has to be opened by the worker thread.
+    if constexpr (config::is_consider_resource_bound_workers())
+    {
+        if (this->_config.is_consider_resource_bound_workers())
+        {
+            this->_resource_boundness_classifier.open(this->_id);
+        }
+    }
+
+    switch (this->_config.memory_reclamation())
+    {
+    case config::None:
+        this->execute<config::None>();
+        break;
+    case config::UpdateEpochOnRead:
+        this->execute<config::UpdateEpochOnRead>();
+        break;
+    case config::UpdateEpochPeriodically:
+        this->execute<config::UpdateEpochPeriodically>();
+        break;
+    case config::QuiescentStateBased:
+        this->execute<config::QuiescentStateBased>();
+        break;
+    }
+
+    if constexpr (config::is_consider_resource_bound_workers())
+    {
+        if (this->_config.is_consider_resource_bound_workers())
+        {
+            this->_resource_boundness_classifier.close(this->_id);
+        }
+    }
+}
+
+template <config::memory_reclamation_scheme R> void Worker::execute()
+{
+    if (this->_config.is_use_task_counter())
+    {
+        if (this->_config.is_collect_task_traces())
+        {
+            this->execute<R, true, true>();
+        }
+        else
+        {
+            this->execute<R, true, false>();
+        }
+    }
+    else
+    {
+        if (this->_config.is_collect_task_traces())
+        {
+            this->execute<R, false, true>();
+        }
+        else
+        {
+            this->execute<R, false, false>();
+        }
+    }
+}
+
+template <config::memory_reclamation_scheme R, bool IsCountTasks, bool IsCollectTraces> void Worker::execute()
+{
+    decltype(std::chrono::system_clock::now()) trace_start;
+
+    const auto refill_treshold = this->_task_buffer.refill_treshold();
+
     const auto worker_id = this->_id;
+    [[maybe_unused]] const auto numa_node_id = runtime::numa_node_id(worker_id);
 
-    /// Period the task sampler for monitoring task cycles becomes active.
-    constexpr auto sample_period = 4096U;
+    /// Period the task sampler for monitoring task cycles (and cache misses) becomes active.
+    constexpr auto is_sample_tasks =
+        config::is_monitor_task_cycles_for_prefetching() || config::is_consider_resource_bound_workers();
+    constexpr auto sample_period =
+        config::is_consider_resource_bound_workers() ? config::resource_boundness_sample_period() : 4096U;
 
     /// Store frequently used pool and buffer on the stack.
     auto &pool = this->_task_pool;
     auto &buffer = this->_task_buffer;
     auto &sampler = buffer.sampler();
+    auto &cycle_accounting = this->_task_cycle_accounting;
+    auto &classifier = this->_resource_boundness_classifier;
+
+    /// Workers without a cache miss counter sample cycles only.
+    [[maybe_unused]] const auto is_classifying = classifier.is_open(worker_id);
+
+    /// Controller tuning the prefetch distance of every task type.
+    auto &prefetch_distance_controller = buffer.prefetch_distance_controller();
+    [[maybe_unused]] const auto is_tuning_prefetch_distance = buffer.is_tuning_prefetch_distance();
 
     const auto is_prefetching_enabled = this->_task_buffer.is_prefetching_enabled();
     auto task_counter = 0U;
 
     while (this->_is_running)
     {
-        if constexpr (config::memory_reclamation() == config::UpdateEpochPeriodically)
+        /// Workers that left the set of active workers only execute tasks synchronized by their scheduling.
+        if constexpr (config::is_allow_resizing_workers())
+        {
+            if (this->_is_active.load(std::memory_order_relaxed) == false) [[unlikely]]
+            {
+                if (this->suspend(worker_id) == false)
+                {
+                    continue;
+                }
+            }
+        }
+
+        if constexpr (R == config::UpdateEpochPeriodically)
         {
             this->_local_epoch.enter(this->_global_epoch);
         }
+        else if constexpr (R == config::QuiescentStateBased)
+        {
+            /// All tasks of the former buffer are executed; the worker holds no reference.
+            this->_epoch_manager.quiescent(worker_id);
+        }
 
         /// Fill the task buffer with tasks.
         auto task_buffer_size = pool.withdraw(buffer);
-        if constexpr (config::is_use_task_counter())
+        if constexpr (IsCountTasks)
         {
             this->_task_counter->increment<profiling::TaskCounter::FilledBuffer>(worker_id);
         }
 
         if (task_buffer_size == 0U) [[unlikely]]
         {
-            do
-            {
-                mx::system::builtin::pause();
+            task_buffer_size = this->wait_for_tasks(worker_id);
+        }
 
-                task_buffer_size = pool.withdraw(buffer);
-                if constexpr (config::is_use_task_counter())
-                {
-                    this->_task_counter->increment<profiling::TaskCounter::FilledBuffer>(worker_id);
-                }
-            } while (task_buffer_size == 0U && this->_is_running);
+        /// The load lets the scheduler fall back to this worker when it idles (see resource bound workers).
+        if constexpr (config::is_consider_resource_bound_workers())
+        {
+            this->_load.set(std::uint16_t(task_buffer_size));
         }
 
-        /// Enter epoch when increased periodically.
-        if constexpr (config::memory_reclamation() == config::UpdateEpochPeriodically)
+        /// Enter epoch when increased periodically (or re-enter after parking).
+        if constexpr (R == config::UpdateEpochPeriodically || R == config::QuiescentStateBased)
         {
             this->_local_epoch.enter(this->_global_epoch);
         }
@@ -88,21 +185,46 @@ void Worker::execute()
 
         auto task_trace_id = std::uint64_t(0U);
         auto is_sampling = false;
+        auto is_tuning = false;
         std::uint64_t sample_cycles;
+        [[maybe_unused]] std::uint64_t sample_llc_misses;
+
+        /// Cycle accounting is switched at runtime; the flag is read once per buffer.
+        /// Consecutive tasks with the same trace id are accounted as a single run.
+        const auto is_accounting_cycles = cycle_accounting.is_enabled();
+        auto run_trace_id = std::uint64_t(0U);
+        auto run_count_tasks = std::uint32_t(0U);
+        auto run_start = is_accounting_cycles ? system::RDTSCP::now() : std::uint64_t(0U);
 
         for (; task_counter < count_available_tasks; ++task_counter)
         {
-            if constexpr (config::is_monitor_task_cycles_for_prefetching())
+            if constexpr (is_sample_tasks)
             {
                 is_sampling = (task_counter & (sample_period - 1U)) == 0U;
             }
 
+            if constexpr (config::is_tune_prefetch_distance())
+            {
+                is_tuning = is_tuning_prefetch_distance &&
+                            (task_counter & (config::prefetch_distance_sample_period() - 1U)) == 0U;
+            }
+
             /// Get the next slot with task and prefetch hint.
             auto &slot = buffer.next();
 
             /// Get the task to execute.
             auto *task = slot.get();
 
+            /// Tasks of resources that were re-homed while the task was queued follow their resource.
+            if constexpr (config::is_allow_resizing_workers())
+            {
+                if (runtime::is_rehomed(worker_id, *task)) [[unlikely]]
+                {
+                    runtime::spawn(*task, worker_id);
+                    continue;
+                }
+            }
+
             /// Prefetching
             if (is_prefetching_enabled)
             {
@@ -116,7 +238,7 @@ void Worker::execute()
             }
 
             /// Increase task execution counter.
-            if constexpr (config::is_use_task_counter())
+            if constexpr (IsCountTasks)
             {
                 this->_task_counter->increment<profiling::TaskCounter::Executed>(worker_id);
                 if (task->annotation().has_resource())
@@ -130,21 +252,56 @@ void Worker::execute()
                         this->_task_counter->increment<profiling::TaskCounter::ExecutedWriter>(worker_id);
                     }
                 }
+
+                /// Compare the NUMA node the accessed data is placed on with the node of the worker;
+                /// interleaved data has no home node.
+                const auto accessed_resource = task->annotation().accessed_resource();
+                if (accessed_resource != nullptr)
+                {
+                    const auto data_numa_node_id = this->_numa_node_cache.lookup(accessed_resource.get());
+                    if (data_numa_node_id == numa_node_id)
+                    {
+                        this->_task_counter->increment<profiling::TaskCounter::ExecutedOnLocalData>(worker_id);
+                    }
+                    else if (data_numa_node_id.has_value())
+                    {
+                        this->_task_counter->increment<profiling::TaskCounter::ExecutedOnRemoteData>(worker_id);
+                    }
+                }
+            }
+
+            /// Account the cycles of the previous run when the trace id changes.
+            if (is_accounting_cycles)
+            {
+                const auto trace_id = task->trace_id();
+                if (trace_id != run_trace_id)
+                {
+                    const auto run_end = system::RDTSCP::now();
+                    cycle_accounting.record(worker_id, run_trace_id, run_end - run_start, run_count_tasks);
+                    run_trace_id = trace_id;
+                    run_count_tasks = 0U;
+                    run_start = run_end;
+                }
+                ++run_count_tasks;
             }
 
             /// Collect task times, when tracing.
-            if constexpr (config::is_collect_task_traces())
+            if constexpr (IsCollectTraces)
             {
                 task_trace_id = task->trace_id();
                 trace_start = std::chrono::system_clock::now();
             }
 
-            /// Sample the task, if monitoring.
-            if constexpr (config::is_monitor_task_cycles_for_prefetching())
+            /// Sample the task, if monitoring or tuning the prefetch distance.
+            if constexpr (is_sample_tasks || config::is_tune_prefetch_distance())
             {
-                if (is_sampling)
+                if (is_sampling || is_tuning)
                 {
                     task_trace_id = task->trace_id();
+                    if constexpr (config::is_consider_resource_bound_workers())
+                    {
+                        sample_llc_misses = is_sampling && is_classifying ? classifier.llc_misses(worker_id) : 0U;
+                    }
                     sample_cycles = system::RDTSCP::begin();
                 }
             }
@@ -155,10 +312,10 @@ void Worker::execute()
             switch (Worker::synchronization_primitive(task))
             {
             case synchronization::primitive::ScheduleWriter:
-                result = this->execute_optimistic(worker_id, task);
+                result = this->execute_optimistic<R, IsCountTasks>(worker_id, task);
                 break;
             case synchronization::primitive::OLFIT:
-                result = this->execute_olfit(worker_id, task);
+                result = this->execute_olfit<R, IsCountTasks>(worker_id, task);
                 break;
             case synchronization::primitive::ScheduleAll:
             case synchronization::primitive::Batched:
@@ -176,16 +333,45 @@ void Worker::execute()
                 break;
             }
 
-            if constexpr (config::is_monitor_task_cycles_for_prefetching())
+            if constexpr (is_sample_tasks || config::is_tune_prefetch_distance())
             {
-                if (is_sampling)
+                if (is_sampling || is_tuning)
                 {
-                    const auto end_sample_cycles = system::RDTSCP::end();
-                    sampler.add(task_trace_id, end_sample_cycles - sample_cycles);
+                    const auto task_cycles = system::RDTSCP::end() - sample_cycles;
+
+                    if constexpr (config::is_tune_prefetch_distance())
+                    {
+                        if (is_tuning)
+                        {
+                            prefetch_distance_controller.add(task_trace_id, task_cycles);
+                        }
+                    }
+
+                    if constexpr (config::is_consider_resource_bound_workers())
+                    {
+                        if (is_sampling && is_classifying)
+                        {
+                            const auto llc_misses = classifier.llc_misses(worker_id) - sample_llc_misses;
+                            const auto *sample = sampler.add(task_trace_id, task_cycles, llc_misses);
+                            if (sample != nullptr)
+                            {
+                                classifier.update(task_trace_id, sample->count(), sample->cycles(),
+                                                  sample->llc_misses());
+                            }
+                        }
+                        else if (is_sampling)
+                        {
+                            sampler.add(task_trace_id, task_cycles);
+                        }
+                    }
+                    else if (is_sampling)
+                    {
+                        sampler.add(task_trace_id, task_cycles);
+                    }
                 }
             }
 
-            if constexpr (config::is_collect_task_traces())
+            if constexpr (IsCollectTraces)
             {
                 const auto trace_end = std::chrono::system_clock::now();
                 this->_task_tracer->emplace_back(worker_id, task_trace_id,
@@ -206,6 +392,12 @@ void Worker::execute()
                 runtime::delete_task(worker_id, task);
             }
         }
+
+        if (is_accounting_cycles)
+        {
+            cycle_accounting.record(worker_id, run_trace_id, system::RDTSCP::now() - run_start, run_count_tasks);
+            cycle_accounting.flush(worker_id);
+        }
     }
 
     //    if (worker_id == 0U)
@@ -219,6 +411,201 @@ void Worker::execute()
     //    }
 }
 
+std::uint64_t Worker::wait_for_tasks(const std::uint16_t worker_id)
+{
+    auto &pool = this->_task_pool;
+    auto &buffer = this->_task_buffer;
+
+    /// Idle times are only recorded while the profiler is running.
+    auto idle_range = std::optional<profiling::TimeRange>{std::nullopt};
+    if (this->_idle_profiler.is_running())
+    {
+        idle_range.emplace();
+    }
+    auto parked_time = std::chrono::nanoseconds{0U};
+    auto count_parks = std::uint64_t(0U);
+
+    /// Idle workers hold no reference and must not hold back reclamation.
+    const auto is_quiescent_state_based = this->_config.memory_reclamation() == config::QuiescentStateBased;
+
+    /// Idle workers return the empty blocks of their heap in the background.
+    const auto is_compacting_memory = this->_config.memory_compaction_interval() > 0U;
+
+    /// The worker holds no task and may hand over resources that were re-homed to it.
+    if constexpr (config::is_allow_resizing_workers())
+    {
+        runtime::rehome_resources(worker_id);
+    }
+
+    auto backoff = IdleBackoff{};
+    auto task_buffer_size = std::uint64_t(0U);
+    do
+    {
+        if (is_quiescent_state_based)
+        {
+            this->_epoch_manager.quiescent(worker_id);
+        }
+
+        if (is_compacting_memory)
+        {
+            this->compact_memory(worker_id);
+        }
+
+        if constexpr (config::worker_mode() == config::worker_mode::Adaptive)
+        {
+            if (backoff.wait())
+            {
+                parked_time += this->park(worker_id);
+                ++count_parks;
+            }
+        }
+        else
+        {
+            mx::system::builtin::pause();
+        }
+
+        task_buffer_size = pool.withdraw(buffer);
+        if (this->_task_counter.has_value())
+        {
+            this->_task_counter->increment<profiling::TaskCounter::FilledBuffer>(worker_id);
+        }
+
+        if constexpr (config::is_use_work_stealing())
+        {
+            if (task_buffer_size == 0U)
+            {
+                task_buffer_size = this->steal(worker_id);
+            }
+        }
+    } while (task_buffer_size == 0U && this->_is_running && this->is_active());
+
+    if (idle_range.has_value())
+    {
+        idle_range->stop();
+        this->_idle_profiler.record_idle(worker_id, std::move(idle_range.value()), parked_time, count_parks);
+    }
+
+    return task_buffer_size;
+}
+
+void Worker::compact_memory(const std::uint16_t worker_id)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now - this->_last_memory_compaction >= std::chrono::milliseconds(this->_config.memory_compaction_interval()))
+    {
+        runtime::compact_memory(worker_id);
+        this->_last_memory_compaction = now;
+    }
+}
+
+std::chrono::nanoseconds Worker::park(const std::uint16_t worker_id)
+{
+    /// A parked worker should not hold back memory reclamation.
+    if (this->_config.memory_reclamation() == config::UpdateEpochPeriodically ||
+        this->_config.memory_reclamation() == config::QuiescentStateBased)
+    {
+        this->_local_epoch.leave();
+    }
+
+    const auto park_start = std::chrono::steady_clock::now();
+
+    /// Announce the park before checking the queues one last time.
+    /// Dispatchers push first and check the park state afterwards;
+    /// thus, either we see the task or the dispatcher sees us parked.
+    this->_park_state.store(1U, std::memory_order_seq_cst);
+    if (this->_task_pool.empty() && this->_is_running)
+    {
+        system::futex::wait(this->_park_state, 1U, IdleBackoff::park_timeout());
+    }
+    this->_park_state.store(0U, std::memory_order_relaxed);
+
+    const auto park_end = std::chrono::steady_clock::now();
+
+    /// Record the latency from dispatching a task to resuming the worker.
+    const auto wake_up_time = this->_wake_up_time.exchange(0U, std::memory_order_relaxed);
+    if (wake_up_time > 0U)
+    {
+        const auto wake_up_time_point =
+            std::chrono::steady_clock::time_point{std::chrono::steady_clock::duration{wake_up_time}};
+        this->_idle_profiler.record_wake_up(
+            worker_id, std::chrono::duration_cast<std::chrono::nanoseconds>(park_end - wake_up_time_point));
+    }
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(park_end - park_start);
+}
+
+bool Worker::suspend(const std::uint16_t worker_id)
+{
+    /// A suspended worker should not hold back memory reclamation.
+    if (this->_config.memory_reclamation() != config::None)
+    {
+        this->_local_epoch.leave();
+    }
+
+    while (this->_is_running && this->_is_active.load(std::memory_order_seq_cst) == false)
+    {
+        /// Hand over the tasks that were withdrawn but not executed and all queued tasks.
+        auto tasks = queue::List<TaskInterface>{};
+        while (this->_task_buffer.empty() == false)
+        {
+            tasks.push_back(this->_task_buffer.next().get());
+        }
+        this->_task_pool.drain(tasks);
+
+        if (tasks.empty() == false)
+        {
+            if (runtime::migrate(worker_id, tasks) > 0U)
+            {
+                return true;
+            }
+            continue;
+        }
+
+        /// The worker executed all tasks of its resources; they are re-homed to an active worker.
+        runtime::rehome_resources(worker_id);
+
+        /// Sleep until the worker is activated again. Tasks that were dispatched
+        /// to this worker while leaving will wake it up and get handed over.
+        this->_park_state.store(1U, std::memory_order_seq_cst);
+        if (this->_is_active.load(std::memory_order_seq_cst) == false && this->_task_pool.empty() &&
+            this->_is_running)
+        {
+            system::futex::wait(this->_park_state, 1U, IdleBackoff::park_timeout());
+        }
+        this->_park_state.store(0U, std::memory_order_relaxed);
+    }
+
+    return false;
+}
+
+std::uint64_t Worker::steal(const std::uint16_t worker_id)
+{
+    if (this->_task_counter.has_value())
+    {
+        this->_task_counter->increment<profiling::TaskCounter::StealAttempt>(worker_id);
+    }
+
+    for (auto victim_index = 0U; victim_index < this->_steal_victims.size(); ++victim_index)
+    {
+        const auto count_stolen = this->_steal_victims[victim_index]->steal(this->_task_buffer);
+        if (count_stolen > 0U)
+        {
+            if (this->_task_counter.has_value())
+            {
+                this->_task_counter->add<profiling::TaskCounter::Stolen>(worker_id, count_stolen);
+                if (victim_index >= this->_count_local_steal_victims)
+                {
+                    this->_task_counter->add<profiling::TaskCounter::StolenFromRemoteNode>(worker_id, count_stolen);
+                }
+            }
+
+            return count_stolen;
+        }
+    }
+
+    return 0U;
+}
+
 TaskResult Worker::execute_exclusive_latched(const std::uint16_t worker_id, mx::tasking::TaskInterface *const task)
 {
     auto *resource = mx::resource::ptr_cast<mx::resource::ResourceInterface>(task->annotation().resource());
@@ -246,6 +633,7 @@ TaskResult Worker::execute_reader_writer_latched(const std::uint16_t worker_id,
     }
 }
 
+template <config::memory_reclamation_scheme R, bool IsCountTasks>
 TaskResult Worker::execute_optimistic(const std::uint16_t worker_id, mx::tasking::TaskInterface *const task)
 {
     auto *optimistic_resource = task->annotation().resource().get<mx::resource::ResourceInterface>();
@@ -258,7 +646,7 @@ TaskResult Worker::execute_optimistic(const std::uint16_t worker_id, mx::tasking
         // re-running the task, whenever the version check failed.
         if (task->annotation().resource().worker_id() != worker_id)
         {
-            return this->execute_optimistic_read(worker_id, optimistic_resource, task);
+            return this->execute_optimistic_read<R, IsCountTasks>(worker_id, optimistic_resource, task);
         }
 
         // Whenever the task is executed at the same channel
@@ -277,13 +665,14 @@ TaskResult Worker::execute_optimistic(const std::uint16_t worker_id, mx::tasking
     }
 }
 
+template <config::memory_reclamation_scheme R, bool IsCountTasks>
 TaskResult Worker::execute_olfit(const std::uint16_t worker_id, TaskInterface *const task)
 {
     auto *optimistic_resource = task->annotation().resource().get<mx::resource::ResourceInterface>();
 
     if (task->annotation().is_readonly())
     {
-        return this->execute_optimistic_read(worker_id, optimistic_resource, task);
+        return this->execute_optimistic_read<R, IsCountTasks>(worker_id, optimistic_resource, task);
     }
 
     // Writers, however, need to acquire the version to tell readers, that
@@ -296,11 +685,12 @@ TaskResult Worker::execute_olfit(const std::uint16_t worker_id, TaskInterface *c
     }
 }
 
+template <config::memory_reclamation_scheme R, bool IsCountTasks>
 TaskResult Worker::execute_optimistic_read(const std::uint16_t worker_id,
                                            mx::resource::ResourceInterface *optimistic_resource,
                                            TaskInterface *const task)
 {
-    if constexpr (config::memory_reclamation() == config::UpdateEpochOnRead)
+    if constexpr (R == config::UpdateEpochOnRead)
     {
         this->_local_epoch.enter(this->_global_epoch);
     }
@@ -317,14 +707,14 @@ TaskResult Worker::execute_optimistic_read(const std::uint16_t worker_id,
 
         if (optimistic_resource->is_version_valid(version))
         {
-            if constexpr (config::memory_reclamation() == config::UpdateEpochOnRead)
+            if constexpr (R == config::UpdateEpochOnRead)
             {
                 this->_local_epoch.leave();
             }
             return result;
         }
 
-        if constexpr (config::is_use_task_counter())
+        if constexpr (IsCountTasks)
         {
             if (task->annotation().is_readonly())
             {
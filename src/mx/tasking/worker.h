@@ -1,19 +1,28 @@
 #pragma once
 
 #include "config.h"
+#include "idle_backoff.h"
 #include "load.h"
 #include "prefetch_distance.h"
+#include "profiling/idle_profiler.h"
+#include "profiling/task_cycle_accounting.h"
 #include "profiling/task_counter.h"
 #include "profiling/task_tracer.h"
+#include "resource_boundness_classifier.h"
+#include "runtime_config.h"
 #include "task.h"
+#include "task_batch.h"
 #include "task_buffer.h"
 #include "task_pool.h"
 #include "task_pool_occupancy.h"
 #include "task_stack.h"
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <memory>
+#include <mx/memory/numa_node_cache.h>
 #include <mx/memory/reclamation/epoch_manager.h>
+#include <mx/system/futex.h>
 #include <mx/util/maybe_atomic.h>
 #include <optional>
 #include <variant>
@@ -28,9 +37,10 @@ class alignas(64) Worker
 public:
     Worker(std::uint16_t count_workers, std::uint16_t worker_id, std::uint16_t target_core_id,
            const util::maybe_atomic<bool> &is_running, PrefetchDistance prefetch_distance,
-           memory::reclamation::LocalEpoch &local_epoch, const std::atomic<memory::reclamation::epoch_t> &global_epoch,
-           std::optional<profiling::TaskCounter> &statistic,
-           std::optional<profiling::TaskTracer> &task_tracer) noexcept;
+           memory::reclamation::EpochManager &epoch_manager, std::optional<profiling::TaskCounter> &statistic,
+           std::optional<profiling::TaskTracer> &task_tracer, profiling::IdleProfiler &idle_profiler,
+           profiling::TaskCycleAccounting &task_cycle_accounting,
+           ResourceBoundnessClassifier &resource_boundness_classifier, const runtime_config &configuration) noexcept;
 
     ~Worker() = default;
 
@@ -46,11 +56,86 @@ public:
 
     [[nodiscard]] TaskPool &queues() noexcept { return _task_pool; }
 
+    /**
+     * @return Controller tuning the prefetch distance per task type.
+     */
+    [[nodiscard]] const PrefetchDistanceController &prefetch_distance_controller() const noexcept
+    {
+        return _task_buffer.prefetch_distance_controller();
+    }
+
+    /**
+     * Wakes up the worker, if it is parked.
+     * Called after dispatching a task to the workers queues.
+     */
+    void wake_up() noexcept
+    {
+        if (_park_state.load(std::memory_order_relaxed) == 1U && _park_state.exchange(0U) == 1U)
+        {
+            if (_idle_profiler.is_running())
+            {
+                _wake_up_time.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                                    std::memory_order_relaxed);
+            }
+
+            system::futex::wake(_park_state);
+        }
+    }
+
+    /**
+     * Adds the worker to the set of active workers.
+     * A suspended worker will resume executing tasks.
+     */
+    void activate() noexcept
+    {
+        _is_active.store(true, std::memory_order_seq_cst);
+        wake_up();
+    }
+
+    /**
+     * Removes the worker from the set of active workers. The worker will
+     * finish the tasks it is executing, hand over all queued tasks to
+     * the remaining workers, and suspend until it is activated again.
+     */
+    void deactivate() noexcept
+    {
+        _is_active.store(false, std::memory_order_seq_cst);
+        wake_up();
+    }
+
+    /**
+     * @return True, when the worker is part of the set of active workers.
+     */
+    [[nodiscard]] bool is_active() const noexcept { return _is_active.load(std::memory_order_relaxed); }
+
+    /**
+     * Sets the task pools this worker will steal tasks from when it runs out of tasks.
+     *
+     * @param victims Task pools of other workers, ordered by preference (NUMA-local first).
+     * @param count_local_victims Number of victims located on the same NUMA node.
+     */
+    void steal_from(std::vector<TaskPool *> &&victims, const std::uint16_t count_local_victims) noexcept
+    {
+        _steal_victims = std::move(victims);
+        _count_local_steal_victims = count_local_victims;
+    }
+
     [[nodiscard]] float load() const noexcept { return _load.get(); }
 
     [[nodiscard]] const TaskPoolOccupancy &occupancy() const noexcept { return _occupancy; }
     [[nodiscard]] TaskPoolOccupancy &occupancy() noexcept { return _occupancy; }
 
+    /**
+     * @return Cache for the NUMA node of data accessed by tasks, used only by
+     *         the worker itself (e.g., when dispatching tasks to the node of their data).
+     */
+    [[nodiscard]] memory::NumaNodeCache &numa_node_cache() noexcept { return _numa_node_cache; }
+
+    /**
+     * @return Groups for batches of tasks spawned by this worker, used only by the worker itself.
+     */
+    [[nodiscard]] TaskBatchGroups &batch_groups() noexcept { return _batch_groups; }
+
 private:
     // Id of the worker.
     const std::uint16_t _id;
@@ -72,6 +157,9 @@ private:
 
     alignas(64) TaskPoolOccupancy _occupancy;
 
+    // Epoch manager for quiescent-state-based reclamation.
+    memory::reclamation::EpochManager &_epoch_manager;
+
     // Local epoch of this worker.
     memory::reclamation::LocalEpoch &_local_epoch;
 
@@ -84,9 +172,110 @@ private:
     // Task tracer if task tracing is enabled.
     std::optional<profiling::TaskTracer> &_task_tracer;
 
+    // Profiler for idle times.
+    profiling::IdleProfiler &_idle_profiler;
+
+    // Accounting of task cycles per trace id.
+    profiling::TaskCycleAccounting &_task_cycle_accounting;
+
+    // Classification of tasks into compute- and memory-bound.
+    ResourceBoundnessClassifier &_resource_boundness_classifier;
+
     // Flag for "running" state of MxTasking.
     const util::maybe_atomic<bool> &_is_running;
 
+    // Settings of the runtime, owned by the scheduler.
+    const runtime_config &_config;
+
+    // Task pools of other workers to steal from, NUMA-local workers first.
+    std::vector<TaskPool *> _steal_victims;
+
+    // Number of victims on the same NUMA node as this worker.
+    std::uint16_t _count_local_steal_victims{0U};
+
+    // Futex word; 1 while the worker is parked.
+    alignas(64) std::atomic_uint32_t _park_state{0U};
+
+    // Time the worker was woken up, only recorded while idle profiling.
+    std::atomic_uint64_t _wake_up_time{0U};
+
+    // Flag whether the worker belongs to the set of active workers.
+    std::atomic_bool _is_active{true};
+
+    // Time the free memory of the worker's resource heap was released.
+    std::chrono::steady_clock::time_point _last_memory_compaction{std::chrono::steady_clock::now()};
+
+    // NUMA nodes of the pages accessed by tasks.
+    memory::NumaNodeCache _numa_node_cache;
+
+    // Groups of tasks spawned as a batch, by target worker and priority.
+    TaskBatchGroups _batch_groups;
+
+    /**
+     * Executes tasks until the runtime stops. The loop is specialized for the
+     * settings of the runtime; features that are switched off are not part of
+     * the specialization.
+     *
+     * @tparam R Memory reclamation scheme.
+     * @tparam IsCountTasks True, when the task counter is used.
+     * @tparam IsCollectTraces True, when task traces are collected.
+     */
+    template <config::memory_reclamation_scheme R, bool IsCountTasks, bool IsCollectTraces> void execute();
+
+    /**
+     * Chooses the specialization of the execution loop for counting tasks
+     * and collecting traces.
+     *
+     * @tparam R Memory reclamation scheme.
+     */
+    template <config::memory_reclamation_scheme R> void execute();
+
+    /**
+     * Waits until the task pool (or, if enabled, another worker) provides
+     * tasks. Depending on the worker mode, the worker spins or backs off
+     * and parks.
+     *
+     * @param worker_id Id of this worker.
+     * @return Number of tasks in the task buffer.
+     */
+    std::uint64_t wait_for_tasks(std::uint16_t worker_id);
+
+    /**
+     * Parks the worker until a task is dispatched to the worker
+     * or the park timeout expires.
+     *
+     * @param worker_id Id of this worker.
+     * @return Time the worker was parked.
+     */
+    std::chrono::nanoseconds park(std::uint16_t worker_id);
+
+    /**
+     * Releases the free memory of the worker's resource heap,
+     * if the compaction interval elapsed since the last compaction.
+     *
+     * @param worker_id Id of this worker.
+     */
+    void compact_memory(std::uint16_t worker_id);
+
+    /**
+     * Hands over all tasks of the task buffer and the task pool
+     * to the active workers and sleeps until the worker is
+     * activated again. Tasks of resources that are synchronized
+     * by the scheduling of this worker stay at the worker.
+     *
+     * @param worker_id Id of this worker.
+     * @return True, if tasks stayed at the worker and have to be executed.
+     */
+    bool suspend(std::uint16_t worker_id);
+
+    /**
+     * Tries to steal tasks from other workers into the task buffer.
+     *
+     * @param worker_id Id of this worker.
+     * @return Number of stolen tasks.
+     */
+    std::uint64_t steal(std::uint16_t worker_id);
+
     /**
      * Analyzes the given task and chooses the execution method regarding synchronization.
      * @param task Task to be executed.
@@ -128,6 +317,7 @@ private:
      * @param task Task to be executed.
      * @return Task to be scheduled after execution.
      */
+    template <config::memory_reclamation_scheme R, bool IsCountTasks>
     TaskResult execute_optimistic(std::uint16_t worker_id, TaskInterface *task);
 
     /**
@@ -136,6 +326,7 @@ private:
      * @param task Task to be executed.
      * @return Task to be scheduled after execution.
      */
+    template <config::memory_reclamation_scheme R, bool IsCountTasks>
     TaskResult execute_olfit(std::uint16_t worker_id, TaskInterface *task);
 
     /**
@@ -145,6 +336,7 @@ private:
      * @param task Task to be executed.
      * @return Task to be scheduled after execution.
      */
+    template <config::memory_reclamation_scheme R, bool IsCountTasks>
     TaskResult execute_optimistic_read(std::uint16_t worker_id, mx::resource::ResourceInterface *resource,
                                        TaskInterface *task);
 };
@@ -0,0 +1,90 @@
+#include <db/io/query_result_stream.h>
+#include <gtest/gtest.h>
+
+namespace {
+db::execution::RecordSet make_records(const db::topology::PhysicalSchema &schema, const std::uint64_t count_records)
+{
+    auto records = db::execution::RecordSet::make_client_record_set(schema);
+    std::ignore = records.tile().get<db::data::PaxTile>()->allocate(count_records);
+    return records;
+}
+} // namespace
+
+TEST(DB, QueryResultStreamSealsChunks)
+{
+    auto schema = db::topology::PhysicalSchema{};
+    schema.emplace_back(db::expression::Term::make_attribute("ID"), db::type::Type::make_bigint());
+
+    auto stream = db::io::QueryResultStream{0U, schema, 100U, 8U};
+
+    /// The first sealed chunk starts the sender.
+    ASSERT_FALSE(stream.add(make_records(schema, 60U), nullptr));
+    ASSERT_TRUE(stream.add(make_records(schema, 60U), nullptr));
+    ASSERT_EQ(stream.count_pending_tiles(), 2U);
+
+    /// Chunks sealed while sending do not start another sender.
+    ASSERT_FALSE(stream.add(make_records(schema, 100U), nullptr));
+    ASSERT_FALSE(stream.add(make_records(schema, 10U), nullptr));
+
+    auto first_chunk = stream.next();
+    ASSERT_TRUE(first_chunk.has_value());
+    ASSERT_FALSE(first_chunk->is_last());
+    ASSERT_EQ(first_chunk->result()->count_records(), 120U);
+    ASSERT_EQ(stream.count_pending_tiles(), 2U);
+
+    auto second_chunk = stream.next();
+    ASSERT_TRUE(second_chunk.has_value());
+    ASSERT_EQ(second_chunk->result()->count_records(), 100U);
+
+    /// No sealed chunk left: The sender is released.
+    ASSERT_FALSE(stream.next().has_value());
+
+    /// Closing seals the open records as the last chunk and starts a new sender.
+    ASSERT_TRUE(stream.close(std::chrono::microseconds{42U}, nullptr));
+    auto last_chunk = stream.next();
+    ASSERT_TRUE(last_chunk.has_value());
+    ASSERT_TRUE(last_chunk->is_last());
+    ASSERT_EQ(last_chunk->result()->count_records(), 10U);
+    ASSERT_EQ(stream.count_records(), 230U);
+    ASSERT_EQ(stream.time().count(), 42U);
+    ASSERT_EQ(stream.count_pending_tiles(), 0U);
+}
+
+TEST(DB, QueryResultStreamFails)
+{
+    auto schema = db::topology::PhysicalSchema{};
+    schema.emplace_back(db::expression::Term::make_attribute("ID"), db::type::Type::make_bigint());
+
+    auto stream = db::io::QueryResultStream{0U, schema, 100U, 8U};
+    ASSERT_TRUE(stream.add(make_records(schema, 100U), nullptr));
+    ASSERT_FALSE(stream.add(make_records(schema, 50U), nullptr));
+
+    /// Records that were not sent are discarded; the error is the last chunk.
+    ASSERT_FALSE(stream.fail("out of memory"));
+    ASSERT_EQ(stream.count_pending_tiles(), 0U);
+
+    auto chunk = stream.next();
+    ASSERT_TRUE(chunk.has_value());
+    ASSERT_TRUE(chunk->is_last());
+    ASSERT_EQ(chunk->result(), nullptr);
+    ASSERT_EQ(chunk->error().value(), "out of memory");
+    ASSERT_FALSE(stream.next().has_value());
+}
+
+TEST(DB, QueryResultStreamCongests)
+{
+    auto schema = db::topology::PhysicalSchema{};
+    schema.emplace_back(db::expression::Term::make_attribute("ID"), db::type::Type::make_bigint());
+
+    auto stream = db::io::QueryResultStream{0U, schema, 100U, 2U};
+    ASSERT_TRUE(stream.add(make_records(schema, 100U), nullptr));
+    ASSERT_FALSE(stream.is_congested());
+
+    /// Two sealed chunks wait for the client.
+    ASSERT_FALSE(stream.add(make_records(schema, 100U), nullptr));
+    ASSERT_TRUE(stream.is_congested());
+
+    /// The sender caught up.
+    ASSERT_TRUE(stream.next().has_value());
+    ASSERT_FALSE(stream.is_congested());
+}
@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <db/data/pax_tile.h>
+#include <db/topology/table.h>
+#include <functional>
+#include <gtest/gtest.h>
+#include <mx/tasking/runtime.h>
+#include <mx/util/core_set.h>
+#include <vector>
+
+namespace {
+db::topology::PhysicalSchema make_schema()
+{
+    auto schema = db::topology::PhysicalSchema{};
+    schema.emplace_back(db::expression::Term::make_attribute("ID"), db::type::Type::make_bigint());
+    return schema;
+}
+
+/**
+ * Appends the ids [from, to) to the table.
+ */
+void insert(db::topology::Table &table, const std::int64_t from, const std::int64_t to)
+{
+    auto tile = db::data::PaxTile::make_for_client(table.schema());
+    auto *pax_tile = tile.get<db::data::PaxTile>();
+    for (auto id = from; id < to;)
+    {
+        pax_tile->size(0U);
+        while (id < to && pax_tile->full() == false)
+        {
+            pax_tile->allocate()->set(0U, db::type::underlying<db::type::BIGINT>::value(id++));
+        }
+        table.emplace_back(pax_tile);
+    }
+    pax_tile->~PaxTile();
+    std::free(pax_tile);
+}
+
+/**
+ * @return All ids stored in the given tiles, in order.
+ */
+std::vector<std::int64_t> ids(const std::vector<mx::resource::ptr> &tiles)
+{
+    auto ids = std::vector<std::int64_t>{};
+    for (const auto tile : tiles)
+    {
+        auto *pax_tile = tile.get<db::data::PaxTile>();
+        for (auto index = 0U; index < pax_tile->size(); ++index)
+        {
+            ids.emplace_back(pax_tile->view(index).get(0U).get<db::type::BIGINT>());
+        }
+    }
+    return ids;
+}
+
+std::vector<std::int64_t> sequence(const std::int64_t count)
+{
+    auto ids = std::vector<std::int64_t>{};
+    for (auto id = std::int64_t(0); id < count; ++id)
+    {
+        ids.emplace_back(id);
+    }
+    return ids;
+}
+
+/**
+ * @return All tiles handed out to scans of the given workers.
+ */
+std::vector<mx::resource::ptr> scanned_tiles(const db::topology::Table &table, const std::uint16_t count_workers)
+{
+    auto tiles = std::vector<mx::resource::ptr>{};
+    for (auto worker_id = std::uint16_t(0U); worker_id < count_workers; ++worker_id)
+    {
+        table.for_each_tile(worker_id, [&tiles, worker_id](const mx::resource::ptr tile) {
+            EXPECT_EQ(tile.worker_id(), worker_id);
+            tiles.emplace_back(tile);
+        });
+    }
+    return tiles;
+}
+/**
+ * Runs the callback on the first worker; tables allocate their tiles from the heap of the calling worker.
+ */
+void run_on_worker(std::function<void()> &&callback)
+{
+    auto *task = mx::tasking::runtime::new_task<mx::tasking::LambdaTask>(
+        0U, std::function<mx::tasking::TaskResult(std::uint16_t)>{
+                [callback = std::move(callback)](const std::uint16_t worker_id) {
+                    callback();
+                    return mx::tasking::TaskResult::make_stop(worker_id);
+                }});
+    task->annotate(std::uint16_t{0U});
+    mx::tasking::runtime::spawn(*task);
+    mx::tasking::runtime::start_and_wait();
+}
+} // namespace
+
+TEST(DB, TablePlacementChangeKeepsPinnedTilesReadable)
+{
+    ASSERT_TRUE(mx::tasking::runtime::init(mx::util::core_set::build(1U), mx::tasking::PrefetchDistance{0U}, false));
+    run_on_worker([] {
+        constexpr auto count_records = std::int64_t(db::config::tuples_per_tile() * 3U + 10U);
+
+        auto table = db::topology::Table{"placement", make_schema(), db::topology::Placement::Local};
+        table.initialize();
+        insert(table, 0, count_records);
+
+        /// A scan pins the table and reads the tiles handed out before the placement changes.
+        table.pin();
+        const auto pinned_tiles = scanned_tiles(table, mx::tasking::runtime::workers());
+
+        for (const auto placement : {db::topology::Placement::Interleaved, db::topology::Placement::Replicated,
+                                     db::topology::Placement::Local})
+        {
+            table.placement(placement);
+            EXPECT_EQ(table.placement(), placement);
+            EXPECT_EQ(ids(table.tiles()), sequence(count_records));
+            EXPECT_EQ(ids(scanned_tiles(table, mx::tasking::runtime::workers())), sequence(count_records));
+
+            /// Retired tiles are freed only after the last scan unpinned the table.
+            EXPECT_EQ(ids(pinned_tiles), sequence(count_records));
+        }
+
+        /// Tiles moved to interleaved memory and back are copies.
+        EXPECT_NE(table.tiles().front().get(), pinned_tiles.front().get());
+        table.unpin();
+
+        insert(table, count_records, count_records + 10);
+        EXPECT_EQ(ids(table.tiles()), sequence(count_records + 10));
+    });
+}
+
+TEST(DB, TableReplicasFollowAppends)
+{
+    ASSERT_TRUE(mx::tasking::runtime::init(mx::util::core_set::build(1U), mx::tasking::PrefetchDistance{0U}, false));
+    run_on_worker([] {
+        auto table = db::topology::Table{"replicated", make_schema(), db::topology::Placement::Replicated};
+        table.initialize();
+
+        /// Appends fill the last tile partially, the next append completes it and adds new tiles.
+        auto count_records = std::int64_t(0);
+        for (const auto count : {std::int64_t(10), std::int64_t(db::config::tuples_per_tile()),
+                                 std::int64_t(db::config::tuples_per_tile() * 2U + 7U)})
+        {
+            insert(table, count_records, count_records + count);
+            count_records += count;
+
+            /// Scans read the replica on the node of their worker, which holds every appended record.
+            const auto replicas = scanned_tiles(table, mx::tasking::runtime::workers());
+            EXPECT_EQ(ids(replicas), sequence(count_records));
+            EXPECT_EQ(ids(table.tiles()), sequence(count_records));
+            for (const auto replica : replicas)
+            {
+                EXPECT_TRUE(std::none_of(table.tiles().begin(), table.tiles().end(),
+                                         [replica](const auto tile) { return tile.get() == replica.get(); }));
+            }
+        }
+    });
+}
+
+TEST(DB, TableRebalanceTilesKeepsFairShareOfWorkers)
+{
+    ASSERT_TRUE(mx::tasking::runtime::init(mx::util::core_set::build(1U), mx::tasking::PrefetchDistance{0U}, false));
+    run_on_worker([] {
+        constexpr auto count_tiles = 10U;
+        constexpr auto count_records = std::int64_t(db::config::tuples_per_tile() * count_tiles);
+
+        for (const auto placement : {db::topology::Placement::Local, db::topology::Placement::Interleaved,
+                                     db::topology::Placement::Replicated})
+        {
+            auto table = db::topology::Table{"rebalanced", make_schema(), placement};
+            table.initialize();
+            insert(table, 0, count_records);
+
+            /// Map the tiles round robin to four workers.
+            table.update_core_mapping(mx::util::core_set{0U, 1U, 2U, 3U});
+            const auto count_all_tiles = table.tiles().size();
+            for (auto worker_id = std::uint16_t(0U); worker_id < 4U; ++worker_id)
+            {
+                EXPECT_GE(table.count_tiles(worker_id), count_all_tiles / 4U);
+            }
+
+            /// Two workers leave: Their tiles are handed to the remaining workers.
+            table.rebalance_tiles(2U);
+            EXPECT_EQ(table.count_tiles(0U) + table.count_tiles(1U), count_all_tiles);
+            EXPECT_EQ(table.count_tiles(2U) + table.count_tiles(3U), 0U);
+            EXPECT_LE(table.count_tiles(0U), (count_all_tiles + 1U) / 2U);
+            EXPECT_LE(table.count_tiles(1U), (count_all_tiles + 1U) / 2U);
+
+            auto tiles = scanned_tiles(table, 4U);
+            EXPECT_EQ(tiles.size(), count_all_tiles);
+            auto scanned_ids = ids(tiles);
+            std::sort(scanned_ids.begin(), scanned_ids.end());
+            EXPECT_EQ(scanned_ids, sequence(count_records));
+
+            /// Three workers join: Tiles exceeding the fair share move to the new workers.
+            table.rebalance_tiles(3U);
+            for (auto worker_id = std::uint16_t(0U); worker_id < 3U; ++worker_id)
+            {
+                EXPECT_LE(table.count_tiles(worker_id), (count_all_tiles + 2U) / 3U);
+            }
+            EXPECT_GT(table.count_tiles(2U), 0U);
+            EXPECT_EQ(table.count_tiles(3U), 0U);
+            EXPECT_EQ(scanned_tiles(table, 4U).size(), count_all_tiles);
+
+            /// Appends go to the tiles independent of their mapping.
+            insert(table, count_records, count_records + 10);
+            EXPECT_EQ(ids(table.tiles()), sequence(count_records + 10));
+        }
+    });
+}
@@ -0,0 +1,54 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <mx/memory/global_heap.h>
+
+TEST(MxTasking, GlobalHeapSmallAllocation)
+{
+    const auto statistics = mx::memory::GlobalHeap::huge_page_statistics();
+
+    auto *memory = mx::memory::GlobalHeap::allocate(0U, 4096U);
+    ASSERT_NE(memory, nullptr);
+    std::memset(memory, 1, 4096U);
+    mx::memory::GlobalHeap::free(memory, 4096U);
+
+    /// Small allocations are not backed by huge pages.
+    EXPECT_EQ(mx::memory::GlobalHeap::huge_page_statistics().bytes, statistics.bytes);
+}
+
+TEST(MxTasking, GlobalHeapHugePageAllocation)
+{
+    if constexpr (mx::memory::config::huge_pages() == mx::memory::config::huge_page_backing::None)
+    {
+        GTEST_SKIP();
+    }
+
+    const auto statistics = mx::memory::GlobalHeap::huge_page_statistics();
+
+    /// Large allocations are aligned to huge pages, also when falling back to transparent huge pages.
+    const auto size = mx::memory::config::huge_page_threshold() * 3U + 4096U;
+    auto *memory = mx::memory::GlobalHeap::allocate(0U, size);
+    ASSERT_NE(memory, nullptr);
+    EXPECT_EQ(std::uintptr_t(memory) % (std::uintptr_t(1U) << 21U), 0U);
+    std::memset(memory, 1, size);
+
+    const auto huge_page_statistics = mx::memory::GlobalHeap::huge_page_statistics();
+    const auto count_allocations = huge_page_statistics.explicit_allocations +
+                                   huge_page_statistics.transparent_allocations + huge_page_statistics.fallbacks;
+    EXPECT_GT(count_allocations,
+              statistics.explicit_allocations + statistics.transparent_allocations + statistics.fallbacks);
+
+    /// Only mappings backed by huge pages (explicit or advised for transparent huge pages) count.
+    if (huge_page_statistics.explicit_allocations + huge_page_statistics.transparent_allocations >
+        statistics.explicit_allocations + statistics.transparent_allocations)
+    {
+        EXPECT_GT(huge_page_statistics.bytes, statistics.bytes);
+    }
+    else
+    {
+        EXPECT_EQ(huge_page_statistics.bytes, statistics.bytes);
+    }
+
+    /// Freed mappings no longer count as huge page backed.
+    mx::memory::GlobalHeap::free(memory, size);
+    EXPECT_EQ(mx::memory::GlobalHeap::huge_page_statistics().bytes, statistics.bytes);
+}
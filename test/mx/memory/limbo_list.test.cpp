@@ -0,0 +1,45 @@
+#include <array>
+#include <gtest/gtest.h>
+#include <mx/memory/reclamation/epoch_manager.h>
+
+namespace {
+class Resource final : public mx::resource::ResourceInterface
+{
+public:
+    void on_reclaim() override {}
+};
+} // namespace
+
+TEST(MxTasking, LimboList)
+{
+    auto limbo_list = mx::memory::reclamation::LimboList{};
+    EXPECT_TRUE(limbo_list.empty());
+
+    auto resources = std::array<Resource, 4U>{};
+    for (auto index = 0U; index < resources.size(); ++index)
+    {
+        resources[index].remove_epoch(index / 2U);
+        limbo_list.push_back(&resources[index]);
+    }
+    EXPECT_EQ(limbo_list.size(), 4U);
+
+    /// Nothing was retired before epoch 0.
+    EXPECT_EQ(limbo_list.pop_front(0U).second, 0U);
+
+    /// The resources retired in epoch 0.
+    const auto [first, count] = limbo_list.pop_front(1U);
+    EXPECT_EQ(count, 2U);
+    EXPECT_EQ(first, &resources[0U]);
+    EXPECT_EQ(first->next(), &resources[1U]);
+    EXPECT_EQ(first->next()->next(), nullptr);
+    EXPECT_EQ(limbo_list.size(), 2U);
+
+    /// Resources retired later are appended behind the remaining ones.
+    auto resource = Resource{};
+    resource.remove_epoch(2U);
+    limbo_list.push_back(&resource);
+    EXPECT_EQ(limbo_list.pop_front(2U).second, 2U);
+    EXPECT_EQ(limbo_list.pop_front(3U).first, &resource);
+    EXPECT_TRUE(limbo_list.empty());
+    EXPECT_EQ(limbo_list.pop_all(), nullptr);
+}
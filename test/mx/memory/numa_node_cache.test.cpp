@@ -0,0 +1,45 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <mx/memory/global_heap.h>
+#include <mx/memory/numa_node_cache.h>
+#include <mx/system/cpu.h>
+
+TEST(MxTasking, NumaNodeCacheResolvesNodeOfMemory)
+{
+    auto cache = mx::memory::NumaNodeCache{};
+    for (auto numa_node_id = std::uint8_t(0U); numa_node_id <= mx::system::cpu::max_node_id(); ++numa_node_id)
+    {
+        if (numa_bitmask_isbitset(numa_all_nodes_ptr, numa_node_id) == 0)
+        {
+            continue;
+        }
+
+        auto *memory = mx::memory::GlobalHeap::allocate(numa_node_id, 4096U);
+        ASSERT_NE(memory, nullptr);
+        std::memset(memory, 1, 4096U);
+
+        EXPECT_EQ(mx::memory::GlobalHeap::numa_node_id(memory), numa_node_id);
+        EXPECT_EQ(cache.lookup(memory), numa_node_id);
+
+        /// Cached lookups answer without asking the kernel again.
+        EXPECT_EQ(cache.lookup(memory), numa_node_id);
+
+        cache.clear();
+        mx::memory::GlobalHeap::free(memory, 4096U);
+    }
+}
+
+TEST(MxTasking, NumaNodeCacheInterleavedMemoryHasNoHomeNode)
+{
+    constexpr auto size = std::size_t(1U) << 16U;
+    auto *memory = mx::memory::GlobalHeap::allocate_interleaved(size);
+    ASSERT_NE(memory, nullptr);
+    std::memset(memory, 1, size);
+
+    auto cache = mx::memory::NumaNodeCache{};
+    EXPECT_FALSE(mx::memory::GlobalHeap::numa_node_id(memory).has_value());
+    EXPECT_FALSE(cache.lookup(memory).has_value());
+    EXPECT_FALSE(cache.lookup(reinterpret_cast<std::byte *>(memory) + size - 1U).has_value());
+
+    mx::memory::GlobalHeap::free_interleaved(memory, size);
+}
@@ -0,0 +1,85 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <mx/memory/slab_allocator.h>
+#include <unordered_set>
+
+TEST(MxTasking, SlabArenaAllocation)
+{
+    auto arena = mx::memory::slab::Arena{2U, [](const std::uint16_t) { return std::uint8_t(0U); }};
+
+    auto objects = std::unordered_set<void *>{};
+    for (auto i = 0U; i < 100U; ++i)
+    {
+        auto *object = arena.allocate(0U, 1000U);
+        ASSERT_NE(object, nullptr);
+        EXPECT_EQ(std::uintptr_t(object) % 64U, 0U);
+        std::memset(object, 1, 1000U);
+        objects.insert(object);
+    }
+    EXPECT_EQ(objects.size(), 100U);
+    EXPECT_GE(arena.allocated_bytes(), 100U * 1024U);
+
+    /// Freed objects are recycled by the freeing worker.
+    auto *object = *objects.begin();
+    arena.free(1U, object, 1000U);
+    EXPECT_EQ(arena.allocate(1U, 1000U), object);
+
+    /// Threads that are no workers of the arena can not allocate.
+    EXPECT_EQ(arena.allocate(2U, 1000U), nullptr);
+}
+
+TEST(MxTasking, SlabArenaSizeClasses)
+{
+    auto arena = mx::memory::slab::Arena{1U, [](const std::uint16_t) { return std::uint8_t(0U); }};
+
+    for (auto size_class = 1U; size_class <= mx::memory::config::max_slab_size_classes(); ++size_class)
+    {
+        EXPECT_NE(arena.allocate(0U, size_class * 64U), nullptr);
+    }
+
+    /// Sizes within a cache line share the size class.
+    EXPECT_NE(arena.allocate(0U, 60U), nullptr);
+
+    /// Further size classes have to be allocated elsewhere.
+    EXPECT_EQ(arena.allocate(0U, (mx::memory::config::max_slab_size_classes() + 1U) * 64U), nullptr);
+}
+
+TEST(MxTasking, SlabArenaBlocks)
+{
+    auto arena = mx::memory::slab::Arena{1U, [](const std::uint16_t) { return std::uint8_t(0U); }};
+
+    /// Small blocks share a slab.
+    auto *first = arena.allocate_block(0U, 0U, 100U);
+    auto *second = arena.allocate_block(0U, 0U, 100U);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(std::uintptr_t(second), std::uintptr_t(first) + 128U);
+    EXPECT_EQ(arena.allocated_bytes(), mx::memory::config::max_slab_size());
+
+    /// Large blocks get a slab of their own.
+    auto *large = arena.allocate_block(0U, 0U, mx::memory::config::max_slab_size());
+    ASSERT_NE(large, nullptr);
+    std::memset(large, 1, mx::memory::config::max_slab_size());
+    EXPECT_EQ(arena.allocated_bytes(), 2U * mx::memory::config::max_slab_size());
+
+    EXPECT_EQ(arena.allocate_block(1U, 0U, 100U), nullptr);
+}
+
+TEST(MxTasking, SlabArenaBudget)
+{
+    const auto limit = 2U * mx::memory::config::max_slab_size();
+    auto arena = mx::memory::slab::Arena{1U, [](const std::uint16_t) { return std::uint8_t(0U); }, limit};
+
+    /// Every slab is charged to the budget.
+    EXPECT_NE(arena.allocate_block(0U, 0U, 100U), nullptr);
+    EXPECT_EQ(arena.budget().current(), mx::memory::config::max_slab_size());
+    EXPECT_TRUE(arena.budget().is_fitting(mx::memory::config::max_slab_size()));
+    EXPECT_FALSE(arena.budget().is_fitting(limit));
+    EXPECT_FALSE(arena.budget().is_exceeded());
+
+    /// Memory allocated elsewhere may be charged, too.
+    EXPECT_FALSE(arena.budget().charge(limit));
+    EXPECT_TRUE(arena.budget().is_exceeded());
+    arena.budget().release(limit);
+    EXPECT_EQ(arena.budget().current(), mx::memory::config::max_slab_size());
+    EXPECT_EQ(arena.budget().peak(), limit + mx::memory::config::max_slab_size());
+}
@@ -75,4 +75,42 @@ TEST(MxTasking, WorkerLocalDynamicSizeAllocatorStress)
     }
 
     EXPECT_TRUE(allocator.is_free());
-}
\ No newline at end of file
+}
+TEST(MxTasking, WorkerLocalDynamicSizeAllocatorStatistics)
+{
+    auto core_set = mx::util::core_set::build(1U);
+    auto allocator = mx::memory::dynamic::local::Allocator{core_set};
+    allocator.initialize_heap(0U, 1U);
+
+    const auto count_in_use_bytes = [&allocator]() {
+        auto bytes = std::uint64_t(0U);
+        for (const auto &statistics : allocator.statistics())
+        {
+            bytes += statistics.in_use_bytes();
+        }
+        return bytes;
+    };
+
+    auto statistics = allocator.statistics();
+    ASSERT_EQ(statistics.size(), 1U);
+    EXPECT_EQ(statistics.front().worker_id(), 0U);
+    EXPECT_EQ(statistics.front().count_blocks(), 1U);
+    EXPECT_EQ(statistics.front().in_use_bytes(), 0U);
+    EXPECT_EQ(statistics.front().largest_free_block(), statistics.front().cached_bytes());
+    EXPECT_EQ(statistics.front().fragmentation(), 0.0);
+
+    auto *local = allocator.allocate(0U, 0U, 64U, 1024U);
+    auto *remote = allocator.allocate(0U, 0U, 64U, 1024U);
+    EXPECT_GE(count_in_use_bytes(), 2048U);
+
+    /// Memory freed by another worker is in use until the owner refunds it.
+    allocator.free(0U, local);
+    allocator.free(remote);
+    statistics = allocator.statistics();
+    EXPECT_EQ(statistics.front().count_remote_frees(), 1U);
+    EXPECT_GE(statistics.front().in_use_bytes(), 1024U);
+
+    allocator.clean_up_remote_freed_memory(0U);
+    statistics = allocator.statistics();
+    EXPECT_TRUE(statistics.empty());
+}
@@ -14,4 +14,20 @@ TEST(MxTasking, MPSCQueue)
     EXPECT_EQ(&queue_item, pulled_item);
     EXPECT_EQ(queue.empty(), true);
     EXPECT_EQ(queue.pop_front(), nullptr);
-}
\ No newline at end of file
+}
+
+TEST(MxTasking, MPSCQueueFront)
+{
+    auto queue = mx::queue::MPSC<test::mx::queue::Item>{};
+    EXPECT_EQ(queue.front(), nullptr);
+
+    auto first_item = test::mx::queue::Item{};
+    auto second_item = test::mx::queue::Item{};
+    queue.push_back(&first_item);
+    queue.push_back(&second_item);
+    EXPECT_EQ(queue.front(), &first_item);
+    EXPECT_EQ(queue.pop_front(), &first_item);
+    EXPECT_EQ(queue.front(), &second_item);
+    EXPECT_EQ(queue.pop_front(), &second_item);
+    EXPECT_EQ(queue.front(), nullptr);
+}
@@ -0,0 +1,419 @@
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mx/tasking/dataflow/graph.h>
+#include <mx/tasking/dataflow/task_node.h>
+#include <mx/tasking/runtime.h>
+#include <vector>
+
+namespace {
+using mx::tasking::dataflow::EmitterInterface;
+using mx::tasking::dataflow::NodeInterface;
+using mx::tasking::dataflow::Token;
+
+/**
+ * Generates the numbers 1..count, all on the first partition.
+ */
+class NumberGenerator final : public mx::tasking::dataflow::TokenGenerator<std::uint64_t>
+{
+public:
+    explicit NumberGenerator(const std::uint64_t count) noexcept : _count(count) {}
+    ~NumberGenerator() noexcept override = default;
+
+    [[nodiscard]] std::vector<Token<std::uint64_t>> generate(const std::uint16_t partition_id) override
+    {
+        auto tokens = std::vector<Token<std::uint64_t>>{};
+        if (partition_id == 0U)
+        {
+            for (auto number = std::uint64_t(1U); number <= _count; ++number)
+            {
+                tokens.emplace_back(number);
+            }
+        }
+
+        return tokens;
+    }
+
+    [[nodiscard]] std::uint64_t count() override { return _count; }
+
+private:
+    const std::uint64_t _count;
+};
+
+/// Number of morsels reported as processed by the morsel generator.
+std::atomic_uint64_t processed_morsels{0U};
+
+/**
+ * Hands out the numbers 1..count in morsels of ten numbers.
+ */
+class MorselNumberGenerator final : public mx::tasking::dataflow::TokenGenerator<std::uint64_t>
+{
+public:
+    explicit MorselNumberGenerator(const std::uint64_t count) noexcept : _count(count) {}
+    ~MorselNumberGenerator() noexcept override = default;
+
+    [[nodiscard]] std::vector<Token<std::uint64_t>> generate(const std::uint16_t /*partition_id*/) override
+    {
+        return {};
+    }
+
+    [[nodiscard]] std::uint64_t count() override { return _count; }
+
+    [[nodiscard]] bool is_morsel_driven() const noexcept override { return true; }
+
+    [[nodiscard]] std::vector<Token<std::uint64_t>> next_morsel(const std::uint16_t /*worker_id*/) override
+    {
+        auto tokens = std::vector<Token<std::uint64_t>>{};
+        const auto begin = _next_number.fetch_add(10U);
+        for (auto number = begin; number < begin + 10U && number <= _count; ++number)
+        {
+            tokens.emplace_back(number);
+        }
+
+        return tokens;
+    }
+
+    void processed_morsel(const std::uint16_t /*worker_id*/, const std::uint64_t /*count_tokens*/,
+                          const std::chrono::nanoseconds /*duration*/) override
+    {
+        processed_morsels.fetch_add(1U);
+    }
+
+private:
+    const std::uint64_t _count;
+    std::atomic_uint64_t _next_number{1U};
+};
+
+class NumberNode final : public mx::tasking::dataflow::ProducingNodeInterface<std::uint64_t>
+{
+public:
+    explicit NumberNode(const std::uint64_t count, const bool is_morsel_driven = false)
+    {
+        if (is_morsel_driven)
+        {
+            this->annotation().produces(std::make_unique<MorselNumberGenerator>(count));
+        }
+        else
+        {
+            this->annotation().produces(std::make_unique<NumberGenerator>(count));
+        }
+        this->annotation().is_parallel(true);
+    }
+    ~NumberNode() override = default;
+
+    void consume(const std::uint16_t worker_id, EmitterInterface<std::uint64_t> &graph,
+                 Token<std::uint64_t> &&data) override
+    {
+        graph.emit(worker_id, this, std::move(data));
+    }
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "Numbers"; }
+};
+
+/// Highest number of pending tokens seen by a forwarding task.
+std::atomic_uint64_t max_pending_tokens{0U};
+
+/**
+ * Forwards the consumed numbers by a task per number.
+ */
+class ForwardTask final : public mx::tasking::dataflow::DataTaskInterface<std::uint64_t>
+{
+public:
+    void execute(const std::uint16_t worker_id, NodeInterface<std::uint64_t> *node,
+                 EmitterInterface<std::uint64_t> &emitter, Token<std::uint64_t> &&data) override
+    {
+        const auto pending_tokens = node->count_pending_tokens();
+        auto max_pending = max_pending_tokens.load();
+        while (pending_tokens > max_pending && max_pending_tokens.compare_exchange_weak(max_pending, pending_tokens))
+        {
+        }
+
+        emitter.emit(worker_id, node, std::move(data));
+    }
+};
+
+class ForwardNode final : public mx::tasking::dataflow::TaskNode<ForwardTask>
+{
+public:
+    ForwardNode() noexcept = default;
+    ~ForwardNode() noexcept override = default;
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "Forward"; }
+};
+
+/// State of the graph recorded when the sum node completed; the graph frees itself afterwards.
+std::atomic_uint64_t completed_sum{0U};
+std::atomic_uint64_t completed_in_pending_tokens{0U};
+std::atomic_uint64_t completed_parked_producers{0U};
+
+/**
+ * Sums up the consumed numbers and stops the runtime when the graph completed.
+ */
+class SumNode final : public NodeInterface<std::uint64_t>
+{
+public:
+    SumNode() = default;
+    ~SumNode() override = default;
+
+    void consume(const std::uint16_t /*worker_id*/, EmitterInterface<std::uint64_t> & /*graph*/,
+                 Token<std::uint64_t> &&data) override
+    {
+        _sum.fetch_add(data.data());
+    }
+
+    void in_completed(const std::uint16_t worker_id, EmitterInterface<std::uint64_t> &graph,
+                      NodeInterface<std::uint64_t> &in_node) override
+    {
+        completed_sum.store(_sum.load());
+        completed_in_pending_tokens.store(in_node.count_pending_tokens());
+        completed_parked_producers.store(
+            static_cast<mx::tasking::dataflow::Graph<std::uint64_t> &>(graph).count_parked_producers());
+
+        graph.finalize(worker_id, this);
+    }
+
+    void finalize(const std::uint16_t worker_id, EmitterInterface<std::uint64_t> & /*graph*/, const bool /*is_last*/,
+                  const mx::resource::ptr /*data*/, const mx::resource::ptr /*reduced_data*/) override
+    {
+        /// The graph frees itself (and this node) after the finalization.
+        auto *stop_task = mx::tasking::runtime::new_task<mx::tasking::StopTaskingTask>(worker_id, false);
+        stop_task->annotate(worker_id);
+        mx::tasking::runtime::spawn(*stop_task, worker_id);
+    }
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "Sum"; }
+
+private:
+    std::atomic_uint64_t _sum{0U};
+};
+
+/// Rounds the completion callback of the partial sum node was asked.
+std::atomic_uint16_t completion_rounds{0U};
+
+/**
+ * Completes after the third round.
+ */
+class RoundsCompletionCallback final
+    : public mx::tasking::dataflow::annotation<std::uint64_t>::CompletionCallbackInterface
+{
+public:
+    RoundsCompletionCallback() noexcept = default;
+    ~RoundsCompletionCallback() noexcept override = default;
+
+    [[nodiscard]] bool is_complete() noexcept override { return completion_rounds.fetch_add(1U) + 1U == 3U; }
+};
+
+/**
+ * Sums up the consumed numbers per worker and merges the partial sums
+ * when finalizing, either by reduction or by every worker.
+ */
+class PartialSumNode final : public NodeInterface<std::uint64_t>
+{
+public:
+    using FinalizationType = mx::tasking::dataflow::annotation<std::uint64_t>::FinalizationType;
+
+    PartialSumNode(const std::uint16_t count_workers, const FinalizationType finalization_type)
+        : _partial_sums(count_workers, 0U)
+    {
+        auto partial_sums = std::vector<mx::resource::ptr>{};
+        for (auto worker_id = std::uint16_t(0U); worker_id < count_workers; ++worker_id)
+        {
+            partial_sums.emplace_back(mx::resource::ptr{
+                &_partial_sums[worker_id], mx::resource::information{worker_id, mx::synchronization::primitive::None}});
+        }
+
+        this->annotation().finalization_type(finalization_type);
+        this->annotation().finalizes(std::move(partial_sums));
+        if (finalization_type == FinalizationType::parallel)
+        {
+            this->annotation().completion_callback(std::make_unique<RoundsCompletionCallback>());
+        }
+    }
+    ~PartialSumNode() override = default;
+
+    void consume(const std::uint16_t worker_id, EmitterInterface<std::uint64_t> & /*graph*/,
+                 Token<std::uint64_t> &&data) override
+    {
+        _partial_sums[worker_id] += data.data();
+    }
+
+    void in_completed(const std::uint16_t worker_id, EmitterInterface<std::uint64_t> &graph,
+                      NodeInterface<std::uint64_t> & /*in_node*/) override
+    {
+        graph.finalize(worker_id, this);
+    }
+
+    void finalize(const std::uint16_t /*worker_id*/, EmitterInterface<std::uint64_t> & /*graph*/,
+                  const bool /*is_last*/, const mx::resource::ptr data, const mx::resource::ptr reduced_data) override
+    {
+        if (this->annotation().finalization_type() == FinalizationType::parallel)
+        {
+            completed_sum.fetch_add(*data.get<std::uint64_t>());
+        }
+        else if (reduced_data != nullptr)
+        {
+            *data.get<std::uint64_t>() += *reduced_data.get<std::uint64_t>();
+        }
+        else
+        {
+            completed_sum.store(*data.get<std::uint64_t>());
+        }
+    }
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "PartialSum"; }
+
+private:
+    std::vector<std::uint64_t> _partial_sums;
+};
+
+/**
+ * Stops the runtime when the preceding node completed.
+ */
+class StopNode final : public NodeInterface<std::uint64_t>
+{
+public:
+    StopNode() = default;
+    ~StopNode() override = default;
+
+    void consume(const std::uint16_t /*worker_id*/, EmitterInterface<std::uint64_t> & /*graph*/,
+                 Token<std::uint64_t> && /*data*/) override
+    {
+    }
+
+    void in_completed(const std::uint16_t worker_id, EmitterInterface<std::uint64_t> &graph,
+                      NodeInterface<std::uint64_t> & /*in_node*/) override
+    {
+        graph.finalize(worker_id, this);
+    }
+
+    void finalize(const std::uint16_t worker_id, EmitterInterface<std::uint64_t> & /*graph*/, const bool /*is_last*/,
+                  const mx::resource::ptr /*data*/, const mx::resource::ptr /*reduced_data*/) override
+    {
+        auto *stop_task = mx::tasking::runtime::new_task<mx::tasking::StopTaskingTask>(worker_id, false);
+        stop_task->annotate(worker_id);
+        mx::tasking::runtime::spawn(*stop_task, worker_id);
+    }
+
+    [[nodiscard]] std::string to_string() const noexcept override { return "Stop"; }
+};
+
+void reset_completed_state()
+{
+    completed_sum.store(0U);
+    completion_rounds.store(0U);
+    processed_morsels.store(0U);
+    completed_in_pending_tokens.store(0U);
+    completed_parked_producers.store(0U);
+    max_pending_tokens.store(0U);
+}
+
+bool init_runtime(const std::uint16_t count_workers = 1U)
+{
+    return mx::tasking::runtime::init(mx::util::core_set::build(count_workers), mx::tasking::PrefetchDistance{0U},
+                                      false);
+}
+} // namespace
+
+TEST(MxTasking, GraphTaskNodeFinalizesAfterAllTokens)
+{
+    ASSERT_TRUE(init_runtime(2U));
+    reset_completed_state();
+
+    auto *graph = new mx::tasking::dataflow::Graph<std::uint64_t>{};
+    auto *number_node = new NumberNode{1000U};
+    auto *forward_node = new ForwardNode{};
+    auto *sum_node = new SumNode{};
+    graph->make_edge(number_node, forward_node);
+    graph->make_edge(forward_node, sum_node);
+
+    /// The sum node stops the runtime after the forwarding node finalized, which waits for all its tasks.
+    graph->start(0U);
+    mx::tasking::runtime::start_and_wait();
+    EXPECT_EQ(completed_sum.load(), 500500U);
+    EXPECT_EQ(completed_in_pending_tokens.load(), 0U);
+}
+
+TEST(MxTasking, GraphBackpressureParksProducersAtWatermark)
+{
+    ASSERT_TRUE(init_runtime());
+    reset_completed_state();
+
+    auto *graph = new mx::tasking::dataflow::Graph<std::uint64_t>{};
+    graph->is_use_backpressure(true);
+    graph->pending_tokens_watermark(8U);
+
+    auto *number_node = new NumberNode{1000U};
+    auto *forward_node = new ForwardNode{};
+    auto *sum_node = new SumNode{};
+    graph->make_edge(number_node, forward_node);
+    graph->make_edge(forward_node, sum_node);
+
+    graph->start(0U);
+    mx::tasking::runtime::start_and_wait();
+    EXPECT_EQ(completed_sum.load(), 500500U);
+
+    /// Producers stopped emitting at the watermark and were resumed until all numbers were produced.
+    EXPECT_GT(max_pending_tokens.load(), 0U);
+    EXPECT_LE(max_pending_tokens.load(), 8U);
+    EXPECT_EQ(completed_parked_producers.load(), 0U);
+}
+
+TEST(MxTasking, GraphReducesWorkerLocalData)
+{
+    ASSERT_TRUE(init_runtime(4U));
+    reset_completed_state();
+
+    auto *graph = new mx::tasking::dataflow::Graph<std::uint64_t>{};
+    auto *number_node = new NumberNode{1000U};
+    auto *forward_node = new ForwardNode{};
+    auto *sum_node = new PartialSumNode{mx::tasking::runtime::workers(), PartialSumNode::FinalizationType::reduce};
+    auto *stop_node = new StopNode{};
+    graph->make_edge(number_node, forward_node);
+    graph->make_edge(forward_node, sum_node);
+    graph->make_edge(sum_node, stop_node);
+
+    graph->start(0U);
+    mx::tasking::runtime::start_and_wait();
+    EXPECT_EQ(completed_sum.load(), 500500U);
+}
+
+TEST(MxTasking, GraphCompletesAfterCompletionRounds)
+{
+    ASSERT_TRUE(init_runtime(4U));
+    reset_completed_state();
+
+    auto *graph = new mx::tasking::dataflow::Graph<std::uint64_t>{};
+    auto *number_node = new NumberNode{1000U};
+    auto *forward_node = new ForwardNode{};
+    auto *sum_node = new PartialSumNode{mx::tasking::runtime::workers(), PartialSumNode::FinalizationType::parallel};
+    auto *stop_node = new StopNode{};
+    graph->make_edge(number_node, forward_node);
+    graph->make_edge(forward_node, sum_node);
+    graph->make_edge(sum_node, stop_node);
+
+    /// The node completes (and the stop node finalizes) only after the third round visiting all workers.
+    graph->start(0U);
+    mx::tasking::runtime::start_and_wait();
+    EXPECT_EQ(completed_sum.load(), 500500U);
+    EXPECT_EQ(completion_rounds.load(), 3U);
+}
+
+TEST(MxTasking, GraphPullsMorselsUntilExhausted)
+{
+    ASSERT_TRUE(init_runtime(2U));
+    reset_completed_state();
+
+    auto *graph = new mx::tasking::dataflow::Graph<std::uint64_t>{};
+    auto *number_node = new NumberNode{1000U, true};
+    auto *forward_node = new ForwardNode{};
+    auto *sum_node = new SumNode{};
+    graph->make_edge(number_node, forward_node);
+    graph->make_edge(forward_node, sum_node);
+
+    /// Every morsel is reported once after all its tokens were processed.
+    graph->start(0U);
+    mx::tasking::runtime::start_and_wait();
+    EXPECT_EQ(completed_sum.load(), 500500U);
+    EXPECT_EQ(processed_morsels.load(), 100U);
+}
@@ -0,0 +1,47 @@
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mx/tasking/dataflow/morsel.h>
+#include <vector>
+
+TEST(MxTasking, MorselCursor)
+{
+    auto cursor = mx::tasking::dataflow::MorselCursor<int>{{{0, 1, 2, 3, 4}, {5, 6}}};
+    EXPECT_EQ(cursor.size(), 7U);
+
+    /// Workers prefer morsels of their own NUMA node.
+    auto morsel = cursor.next(1U, 4U);
+    ASSERT_EQ(morsel.size(), 2U);
+    EXPECT_EQ(morsel[0U], 5);
+    EXPECT_EQ(morsel[1U], 6);
+
+    morsel = cursor.next(0U, 4U);
+    ASSERT_EQ(morsel.size(), 4U);
+    EXPECT_EQ(morsel[0U], 0);
+
+    /// The exhausted node steals from the other node.
+    morsel = cursor.next(1U, 4U);
+    ASSERT_EQ(morsel.size(), 1U);
+    EXPECT_EQ(morsel[0U], 4);
+
+    EXPECT_TRUE(cursor.next(0U, 4U).empty());
+    EXPECT_TRUE(cursor.next(1U, 4U).empty());
+}
+
+TEST(MxTasking, MorselSize)
+{
+    auto morsel_size = mx::tasking::dataflow::MorselSize{4U, 64U, std::chrono::microseconds{1000U}};
+    EXPECT_EQ(morsel_size.get(), 4U);
+
+    /// Cheap items (10us per item) grow the morsels towards 100 items, bounded by the limit.
+    morsel_size.update(4U, std::chrono::microseconds{40U});
+    EXPECT_EQ(morsel_size.get(), 34U);
+    morsel_size.update(34U, std::chrono::microseconds{340U});
+    EXPECT_EQ(morsel_size.get(), 49U);
+
+    /// Expensive items (1ms per item) shrink the morsels.
+    morsel_size.update(49U, std::chrono::milliseconds{49U});
+    EXPECT_EQ(morsel_size.get(), 25U);
+
+    morsel_size.limit(8U);
+    EXPECT_EQ(morsel_size.get(), 8U);
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <mx/tasking/dataflow/reduction.h>
+#include <vector>
+
+TEST(MxTasking, ReductionTree)
+{
+    using mx::tasking::dataflow::ReductionTree;
+
+    /// A single participant needs no step.
+    {
+        const auto tree = ReductionTree{{0U}, 2U};
+        EXPECT_TRUE(tree.steps().empty());
+        EXPECT_EQ(tree.root(), 0U);
+    }
+
+    /// Five participants on one node with a fanout of two: Three levels.
+    {
+        const auto tree = ReductionTree{{0U, 0U, 0U, 0U, 0U}, 2U};
+        ASSERT_EQ(tree.steps().size(), 4U);
+        EXPECT_EQ(tree.root(), 0U);
+
+        /// First level: (0 <- 1), (2 <- 3); participant 4 waits.
+        EXPECT_EQ(tree.steps()[0U].target(), 0U);
+        EXPECT_EQ(tree.steps()[0U].sources(), std::vector<std::size_t>{1U});
+        EXPECT_EQ(tree.steps()[0U].count_children(), 0U);
+        EXPECT_EQ(tree.steps()[1U].target(), 2U);
+        EXPECT_EQ(tree.steps()[0U].parent(), 2U);
+        EXPECT_EQ(tree.steps()[1U].parent(), 2U);
+
+        /// Second level: (0 <- 2); third level: (0 <- 4).
+        EXPECT_EQ(tree.steps()[2U].sources(), std::vector<std::size_t>{2U});
+        EXPECT_EQ(tree.steps()[2U].count_children(), 2U);
+        EXPECT_EQ(tree.steps()[2U].parent(), 3U);
+        EXPECT_EQ(tree.steps()[3U].sources(), std::vector<std::size_t>{4U});
+        EXPECT_EQ(tree.steps()[3U].count_children(), 1U);
+        EXPECT_FALSE(tree.steps()[3U].parent().has_value());
+    }
+
+    /// Participants are reduced on their NUMA node before crossing nodes.
+    {
+        const auto tree = ReductionTree{{0U, 1U, 0U, 1U, 0U, 1U}, 4U};
+        ASSERT_EQ(tree.steps().size(), 3U);
+        EXPECT_EQ(tree.steps()[0U].target(), 0U);
+        EXPECT_EQ(tree.steps()[0U].sources(), (std::vector<std::size_t>{2U, 4U}));
+        EXPECT_EQ(tree.steps()[1U].target(), 1U);
+        EXPECT_EQ(tree.steps()[1U].sources(), (std::vector<std::size_t>{3U, 5U}));
+
+        /// Only one participant per node crosses the interconnect.
+        EXPECT_EQ(tree.steps()[2U].target(), 0U);
+        EXPECT_EQ(tree.steps()[2U].sources(), std::vector<std::size_t>{1U});
+        EXPECT_EQ(tree.steps()[2U].count_children(), 2U);
+        EXPECT_EQ(tree.root(), 0U);
+    }
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <mx/tasking/dataflow/worker_share.h>
+
+TEST(MxTasking, WorkerShare)
+{
+    using mx::tasking::dataflow::WorkerShare;
+
+    /// A single pipeline spans all workers; partitions stay on their workers.
+    {
+        const auto shares = WorkerShare::allocate({42U}, 4U);
+        ASSERT_EQ(shares.size(), 1U);
+        EXPECT_EQ(shares[0U].first_worker_id(), 0U);
+        EXPECT_EQ(shares[0U].count_workers(), 4U);
+        for (auto partition_id = std::uint16_t(0U); partition_id < 4U; ++partition_id)
+        {
+            EXPECT_EQ(shares[0U].worker_id(partition_id, 4U), partition_id);
+        }
+    }
+
+    /// Workers are split proportional to the work; pipelines without work keep all workers.
+    {
+        const auto shares = WorkerShare::allocate({300U, 0U, 100U}, 8U);
+        ASSERT_EQ(shares.size(), 3U);
+        EXPECT_EQ(shares[0U].first_worker_id(), 0U);
+        EXPECT_EQ(shares[0U].count_workers(), 6U);
+        EXPECT_EQ(shares[1U].first_worker_id(), 0U);
+        EXPECT_EQ(shares[1U].count_workers(), 8U);
+        EXPECT_EQ(shares[2U].first_worker_id(), 6U);
+        EXPECT_EQ(shares[2U].count_workers(), 2U);
+
+        /// All partitions are mapped to the share.
+        EXPECT_EQ(shares[2U].worker_id(0U, 8U), 6U);
+        EXPECT_EQ(shares[2U].worker_id(3U, 8U), 6U);
+        EXPECT_EQ(shares[2U].worker_id(4U, 8U), 7U);
+        EXPECT_EQ(shares[2U].worker_id(7U, 8U), 7U);
+    }
+
+    /// Every pipeline gets at least one worker, even with little work.
+    {
+        const auto shares = WorkerShare::allocate({1000U, 1U}, 4U);
+        EXPECT_EQ(shares[0U].count_workers(), 3U);
+        EXPECT_EQ(shares[1U].first_worker_id(), 3U);
+        EXPECT_EQ(shares[1U].count_workers(), 1U);
+    }
+
+    /// More pipelines than workers.
+    {
+        const auto shares = WorkerShare::allocate({1U, 1U, 1U}, 2U);
+        EXPECT_EQ(shares[0U].first_worker_id(), 0U);
+        EXPECT_EQ(shares[1U].first_worker_id(), 1U);
+        EXPECT_EQ(shares[2U].first_worker_id(), 0U);
+        EXPECT_EQ(shares[2U].count_workers(), 1U);
+    }
+}
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <mx/memory/global_heap.h>
+#include <mx/system/cpu.h>
+#include <mx/tasking/config.h>
+#include <mx/tasking/runtime.h>
+
+namespace {
+std::atomic_uint16_t executing_worker_id{std::numeric_limits<std::uint16_t>::max()};
+
+/**
+ * Records the worker it is executed on and stops the runtime.
+ */
+class ProbeTask final : public mx::tasking::TaskInterface
+{
+public:
+    ProbeTask() noexcept = default;
+    ~ProbeTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(const std::uint16_t worker_id) override
+    {
+        executing_worker_id.store(worker_id);
+        return mx::tasking::TaskResult::make_stop(worker_id);
+    }
+};
+
+/**
+ * Spawns a probe task locally that references the given data by its prefetch hint.
+ * The data is tagged with the id of the spawning worker, like replicas or tiles
+ * allocated from the arena of another worker.
+ */
+class SpawnProbeTask final : public mx::tasking::TaskInterface
+{
+public:
+    explicit SpawnProbeTask(void *data) noexcept : _data(data) {}
+    ~SpawnProbeTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(const std::uint16_t worker_id) override
+    {
+        const auto data =
+            mx::resource::ptr{_data, mx::resource::information{worker_id, mx::synchronization::primitive::None}};
+
+        auto *probe_task = mx::tasking::runtime::new_task<ProbeTask>(worker_id);
+        probe_task->annotate(
+            mx::tasking::PrefetchHint::make_size(mx::tasking::PrefetchDescriptor::Temporal, 64U, data));
+        mx::tasking::runtime::spawn(*probe_task, worker_id);
+
+        return mx::tasking::TaskResult::make_remove();
+    }
+
+private:
+    void *_data;
+};
+
+/**
+ * Spawns a probe task from the first worker, referencing the given data.
+ *
+ * @return Worker the probe task was executed on.
+ */
+std::uint16_t dispatch_probe(void *data)
+{
+    executing_worker_id.store(std::numeric_limits<std::uint16_t>::max());
+
+    auto *spawn_task = mx::tasking::runtime::new_task<SpawnProbeTask>(0U, data);
+    spawn_task->annotate(std::uint16_t{0U});
+    mx::tasking::runtime::spawn(*spawn_task);
+    mx::tasking::runtime::start_and_wait();
+
+    return executing_worker_id.load();
+}
+
+bool init_runtime()
+{
+    return mx::tasking::runtime::init(mx::util::core_set::build(mx::system::cpu::count_cores()),
+                                      mx::tasking::PrefetchDistance{0U}, false);
+}
+} // namespace
+
+TEST(MxTasking, LocalityDispatchFollowsPlacementOfData)
+{
+    ASSERT_TRUE(init_runtime());
+
+    /// Data placed on the node of the last worker, but tagged with the first (spawning) worker.
+    const auto last_worker_id = std::uint16_t(mx::tasking::runtime::workers() - 1U);
+    const auto data_numa_node_id = mx::tasking::runtime::numa_node_id(last_worker_id);
+    auto *data = mx::memory::GlobalHeap::allocate(data_numa_node_id, 4096U);
+    ASSERT_NE(data, nullptr);
+    std::memset(data, 1, 4096U);
+
+    const auto worker_id = dispatch_probe(data);
+    if constexpr (mx::tasking::config::is_use_locality_aware_dispatch())
+    {
+        EXPECT_EQ(mx::tasking::runtime::numa_node_id(worker_id), data_numa_node_id);
+    }
+    else
+    {
+        EXPECT_EQ(worker_id, 0U);
+    }
+
+    mx::memory::GlobalHeap::free(data, 4096U);
+}
+
+TEST(MxTasking, LocalityDispatchKeepsTasksOnInterleavedDataLocal)
+{
+    ASSERT_TRUE(init_runtime());
+
+    constexpr auto size = std::size_t(1U) << 16U;
+    auto *data = mx::memory::GlobalHeap::allocate_interleaved(size);
+    ASSERT_NE(data, nullptr);
+    std::memset(data, 1, size);
+
+    /// Interleaved data has no home node, the task stays with the spawning worker.
+    EXPECT_EQ(dispatch_probe(data), 0U);
+
+    mx::memory::GlobalHeap::free_interleaved(data, size);
+}
@@ -0,0 +1,56 @@
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <mx/tasking/prefetch_distance_controller.h>
+#include <numeric>
+
+TEST(MxTasking, PrefetchDistanceControllerConverges)
+{
+    auto controller = mx::tasking::PrefetchDistanceController{};
+
+    /// Tasks stall on memory until the distance covers the latency (6 tasks ahead);
+    /// prefetching further ahead evicts the data before it is used.
+    const auto task_cycles = [](const std::uint8_t distance) {
+        return 100U + 20U * std::uint32_t(std::abs(std::int32_t(distance) - 6));
+    };
+
+    /// 64 samples correspond to ~4k tasks of a worker (see config::prefetch_distance_sample_period()).
+    constexpr auto trace_id = 42U;
+    for (auto i = 0U; i < 64U; ++i)
+    {
+        const auto distance = controller.distance(trace_id, [] { return std::uint8_t(2U); });
+        controller.add(trace_id, task_cycles(distance));
+    }
+
+    EXPECT_EQ(controller.current_distance(trace_id), 6U);
+
+    /// Every chosen distance was recorded.
+    const auto histogram = controller.histogram();
+    EXPECT_EQ(std::accumulate(histogram.begin(), histogram.end(), std::uint64_t(0U)), 64U);
+    EXPECT_GT(histogram[2U], 0U);
+
+    controller.reset_histogram();
+    const auto empty_histogram = controller.histogram();
+    EXPECT_EQ(std::accumulate(empty_histogram.begin(), empty_histogram.end(), std::uint64_t(0U)), 0U);
+}
+
+TEST(MxTasking, PrefetchDistanceControllerBounds)
+{
+    auto controller = mx::tasking::PrefetchDistanceController{};
+
+    /// Unknown task types start with the estimated distance, limited to the maximum.
+    EXPECT_EQ(controller.distance(1U, [] { return std::uint8_t(3U); }), 3U);
+    EXPECT_EQ(controller.distance(2U, [] { return std::uint8_t(255U); }), mx::tasking::config::max_prefetch_distance());
+
+    /// Tasks without trace id are not tuned.
+    EXPECT_EQ(controller.distance(0U, [] { return std::uint8_t(4U); }), 4U);
+    EXPECT_EQ(controller.current_distance(0U), 0U);
+
+    /// The more cycles, the shorter the distance; it never drops below one.
+    for (auto i = 0U; i < 1000U; ++i)
+    {
+        const auto distance = controller.distance(1U, [] { return std::uint8_t(3U); });
+        controller.add(1U, 1000U + distance * 100U);
+    }
+    EXPECT_GE(controller.current_distance(1U), 1U);
+    EXPECT_LE(controller.current_distance(1U), 2U);
+}
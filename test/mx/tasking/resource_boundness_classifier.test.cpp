@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include <mx/tasking/resource_boundness_classifier.h>
+
+using mx::tasking::ResourceBoundnessClassifier;
+using boundness = enum mx::tasking::annotation::resource_boundness;
+
+TEST(MxTasking, ResourceBoundnessClassify)
+{
+    EXPECT_EQ(ResourceBoundnessClassifier::classify(0U, 0U), boundness::mixed);
+    EXPECT_EQ(ResourceBoundnessClassifier::classify(100000U, 0U), boundness::compute);
+    EXPECT_EQ(ResourceBoundnessClassifier::classify(100000U, 500U), boundness::memory);
+    EXPECT_EQ(ResourceBoundnessClassifier::classify(100000U, 100U), boundness::mixed);
+}
+
+TEST(MxTasking, ResourceBoundnessClassifier)
+{
+    constexpr auto samples = mx::tasking::config::resource_boundness_samples();
+
+    auto classifier = std::make_unique<ResourceBoundnessClassifier>();
+    EXPECT_EQ(classifier->get(42U), boundness::mixed);
+
+    /// Tasks are classified after a number of samples.
+    classifier->update(42U, samples - 1U, 100000U, 500U);
+    EXPECT_EQ(classifier->get(42U), boundness::mixed);
+    classifier->update(42U, samples, 100000U, 500U);
+    EXPECT_EQ(classifier->get(42U), boundness::memory);
+    classifier->update(7U, samples, 100000U, 0U);
+    EXPECT_EQ(classifier->get(7U), boundness::compute);
+
+    /// Classifications are revised with further samples.
+    classifier->update(42U, samples * 2U, 200000U, 0U);
+    EXPECT_EQ(classifier->get(42U), boundness::compute);
+
+    /// Tasks without trace id are never classified.
+    classifier->update(0U, samples, 100000U, 500U);
+    EXPECT_EQ(classifier->get(0U), boundness::mixed);
+
+    classifier->clear();
+    EXPECT_EQ(classifier->get(7U), boundness::mixed);
+}
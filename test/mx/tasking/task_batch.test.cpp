@@ -0,0 +1,155 @@
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <mx/tasking/runtime.h>
+#include <mx/tasking/task_batch.h>
+#include <vector>
+
+namespace {
+class NoopTask final : public mx::tasking::TaskInterface
+{
+public:
+    NoopTask() noexcept = default;
+    ~NoopTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(const std::uint16_t /*worker_id*/) override
+    {
+        return mx::tasking::TaskResult::make_null();
+    }
+};
+
+std::array<std::atomic_uint16_t, 64U> executing_worker_ids;
+std::atomic_uint64_t count_pending_tasks{0U};
+
+/**
+ * Records the worker it is executed on; the last task stops the runtime.
+ */
+class RecordWorkerTask final : public mx::tasking::TaskInterface
+{
+public:
+    explicit RecordWorkerTask(const std::uint16_t task_id) noexcept : _task_id(task_id) {}
+    ~RecordWorkerTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(const std::uint16_t worker_id) override
+    {
+        executing_worker_ids[_task_id].store(worker_id);
+        if (count_pending_tasks.fetch_sub(1U) == 1U)
+        {
+            return mx::tasking::TaskResult::make_stop(worker_id);
+        }
+
+        return mx::tasking::TaskResult::make_remove();
+    }
+
+private:
+    const std::uint16_t _task_id;
+};
+
+/**
+ * Spawns a batch of tasks, every task annotated with a worker and a priority.
+ */
+class SpawnBatchTask final : public mx::tasking::TaskInterface
+{
+public:
+    SpawnBatchTask() noexcept = default;
+    ~SpawnBatchTask() noexcept override = default;
+
+    mx::tasking::TaskResult execute(const std::uint16_t worker_id) override
+    {
+        auto tasks = std::vector<mx::tasking::TaskInterface *>{};
+        for (auto task_id = std::uint16_t(0U); task_id < executing_worker_ids.size(); ++task_id)
+        {
+            auto *task = mx::tasking::runtime::new_task<RecordWorkerTask>(worker_id, task_id);
+            task->annotate(std::uint16_t(task_id % mx::tasking::runtime::workers()));
+            task->annotate(mx::tasking::priority(task_id % mx::tasking::count_priorities));
+            tasks.emplace_back(task);
+        }
+        mx::tasking::runtime::spawn_batch(tasks, worker_id);
+
+        return mx::tasking::TaskResult::make_remove();
+    }
+};
+} // namespace
+
+TEST(MxTasking, TaskBatchGroupsLinkTasksPerWorkerAndPriority)
+{
+    auto tasks = std::array<NoopTask, 6U>{};
+    tasks[1U].annotate(mx::tasking::priority::high);
+    tasks[4U].annotate(mx::tasking::priority::high);
+
+    auto groups = mx::tasking::TaskBatchGroups{};
+    groups.add(3U, &tasks[0U]);
+    groups.add(1U, &tasks[1U]);
+    groups.add(3U, &tasks[2U]);
+    groups.add(3U, &tasks[3U]);
+    groups.add(1U, &tasks[4U]);
+    groups.add(1U, &tasks[5U]);
+    EXPECT_EQ(groups.count_groups(), 2U);
+
+    auto worker_ids = std::vector<std::uint16_t>{};
+    groups.flush([&](const std::uint16_t worker_id,
+                     const std::array<mx::tasking::TaskBatchGroups::list, mx::tasking::count_priorities> &lists,
+                     const std::uint64_t count_tasks) {
+        worker_ids.emplace_back(worker_id);
+        EXPECT_EQ(count_tasks, 3U);
+
+        const auto [first_normal, last_normal] = lists[std::uint8_t(mx::tasking::priority::normal)];
+        const auto [first_high, last_high] = lists[std::uint8_t(mx::tasking::priority::high)];
+        EXPECT_EQ(lists[std::uint8_t(mx::tasking::priority::low)].first, nullptr);
+        EXPECT_EQ(lists[std::uint8_t(mx::tasking::priority::critical)].first, nullptr);
+        if (worker_id == 3U)
+        {
+            EXPECT_EQ(first_normal, &tasks[0U]);
+            EXPECT_EQ(first_normal->next(), &tasks[2U]);
+            EXPECT_EQ(tasks[2U].next(), &tasks[3U]);
+            EXPECT_EQ(last_normal, &tasks[3U]);
+            EXPECT_EQ(first_high, nullptr);
+        }
+        else
+        {
+            EXPECT_EQ(first_normal, &tasks[5U]);
+            EXPECT_EQ(last_normal, &tasks[5U]);
+            EXPECT_EQ(first_high, &tasks[1U]);
+            EXPECT_EQ(first_high->next(), &tasks[4U]);
+            EXPECT_EQ(last_high, &tasks[4U]);
+        }
+    });
+
+    /// Groups are handed over in the order the workers were touched and reset afterward.
+    EXPECT_EQ(worker_ids, (std::vector<std::uint16_t>{3U, 1U}));
+    EXPECT_EQ(groups.count_groups(), 0U);
+
+    auto task = NoopTask{};
+    groups.add(1U, &task);
+    groups.flush([&](const std::uint16_t worker_id,
+                     const std::array<mx::tasking::TaskBatchGroups::list, mx::tasking::count_priorities> &lists,
+                     const std::uint64_t count_tasks) {
+        EXPECT_EQ(worker_id, 1U);
+        EXPECT_EQ(count_tasks, 1U);
+        EXPECT_EQ(lists[std::uint8_t(mx::tasking::priority::normal)].first, &task);
+        EXPECT_EQ(lists[std::uint8_t(mx::tasking::priority::high)].first, nullptr);
+    });
+}
+
+TEST(MxTasking, SpawnBatchDispatchesTasksToTheirWorkers)
+{
+    ASSERT_TRUE(mx::tasking::runtime::init(mx::util::core_set::build(4U), mx::tasking::PrefetchDistance{0U}, false));
+
+    for (auto &worker_id : executing_worker_ids)
+    {
+        worker_id.store(std::numeric_limits<std::uint16_t>::max());
+    }
+    count_pending_tasks.store(executing_worker_ids.size());
+
+    auto *spawn_task = mx::tasking::runtime::new_task<SpawnBatchTask>(0U);
+    spawn_task->annotate(std::uint16_t{0U});
+    mx::tasking::runtime::spawn(*spawn_task);
+    mx::tasking::runtime::start_and_wait();
+
+    for (auto task_id = std::uint16_t(0U); task_id < executing_worker_ids.size(); ++task_id)
+    {
+        EXPECT_EQ(executing_worker_ids[task_id].load(), task_id % mx::tasking::runtime::workers());
+    }
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+#include <mx/tasking/profiling/task_cycle_accounting.h>
+
+TEST(MxTasking, TaskCycleAccounting)
+{
+    auto accounting = std::make_unique<mx::tasking::profiling::TaskCycleAccounting>();
+    EXPECT_FALSE(accounting->is_enabled());
+    accounting->enable(true);
+    EXPECT_TRUE(accounting->is_enabled());
+
+    /// Runs become visible after flushing.
+    accounting->record(0U, 42U, 100U, 2U);
+    accounting->record(1U, 42U, 50U, 1U);
+    accounting->record(1U, 7U, 30U, 3U);
+    EXPECT_TRUE(accounting->get().empty());
+
+    accounting->flush(0U);
+    accounting->flush(1U);
+    auto task_cycles = accounting->get();
+    EXPECT_EQ(task_cycles.size(), 2U);
+    EXPECT_EQ(task_cycles[42U].cycles(), 150U);
+    EXPECT_EQ(task_cycles[42U].count(), 3U);
+    EXPECT_EQ(task_cycles[42U].average(), 50U);
+    EXPECT_EQ(task_cycles[7U].average(), 10U);
+
+    /// Tasks without trace id are not accounted.
+    accounting->record(0U, 0U, 100U, 1U);
+    accounting->flush(0U);
+    EXPECT_EQ(accounting->get().size(), 2U);
+
+    EXPECT_EQ(accounting->get({7U}).size(), 1U);
+
+    accounting->retire({42U});
+    task_cycles = accounting->get();
+    EXPECT_EQ(task_cycles.size(), 1U);
+    EXPECT_EQ(task_cycles.count(42U), 0U);
+
+    accounting->clear();
+    EXPECT_TRUE(accounting->get().empty());
+}
@@ -0,0 +1,182 @@
+#include <array>
+#include <gtest/gtest.h>
+#include <memory>
+#include <mx/tasking/task_pool.h>
+#include <vector>
+
+namespace test::mx::tasking {
+class PriorityTask final : public ::mx::tasking::TaskInterface
+{
+public:
+    explicit PriorityTask(const ::mx::tasking::priority priority) noexcept { annotate(priority); }
+    ~PriorityTask() noexcept override = default;
+
+    ::mx::tasking::TaskResult execute(const std::uint16_t /*worker_id*/) override
+    {
+        return ::mx::tasking::TaskResult::make_remove();
+    }
+};
+} // namespace test::mx::tasking
+
+TEST(MxTasking, TaskPoolWithdrawHighestPriorityFirst)
+{
+    auto pool = std::make_unique<mx::tasking::TaskPool>(1U, 0U, 0U);
+    auto buffer = mx::tasking::TaskBuffer<mx::tasking::config::task_buffer_size()>{mx::tasking::PrefetchDistance{0U}};
+
+    auto normal_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    auto critical_task = test::mx::tasking::PriorityTask{mx::tasking::priority::critical};
+    pool->push_back_local(&normal_task);
+    pool->push_back_local(&critical_task);
+
+    ASSERT_EQ(pool->withdraw(buffer), 2U);
+    ASSERT_EQ(buffer.next().get(), &critical_task);
+    ASSERT_EQ(buffer.next().get(), &normal_task);
+    ASSERT_TRUE(pool->empty());
+}
+
+TEST(MxTasking, TaskPoolWithdrawLowPriorityWhenIdle)
+{
+    auto pool = std::make_unique<mx::tasking::TaskPool>(1U, 0U, 0U);
+    auto buffer = mx::tasking::TaskBuffer<mx::tasking::config::task_buffer_size()>{mx::tasking::PrefetchDistance{0U}};
+
+    auto low_task = test::mx::tasking::PriorityTask{mx::tasking::priority::low};
+    auto normal_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    pool->push_back_local(&low_task);
+    pool->push_back_local(&normal_task);
+
+    /// Low prioritized tasks wait until no other task is waiting.
+    ASSERT_EQ(pool->withdraw(buffer), 1U);
+    ASSERT_EQ(buffer.next().get(), &normal_task);
+    ASSERT_FALSE(pool->empty());
+
+    ASSERT_EQ(pool->withdraw(buffer), 1U);
+    ASSERT_EQ(buffer.next().get(), &low_task);
+    ASSERT_TRUE(pool->empty());
+}
+
+TEST(MxTasking, TaskPoolWithdrawDoesNotStarveNormalPriority)
+{
+    auto pool = std::make_unique<mx::tasking::TaskPool>(1U, 0U, 0U);
+    auto buffer = mx::tasking::TaskBuffer<mx::tasking::config::task_buffer_size()>{mx::tasking::PrefetchDistance{0U}};
+
+    auto critical_tasks = std::vector<test::mx::tasking::PriorityTask>{};
+    critical_tasks.reserve(mx::tasking::config::task_buffer_size() * 8U);
+    for (auto i = 0U; i < mx::tasking::config::task_buffer_size() * 8U; ++i)
+    {
+        pool->push_back_local(&critical_tasks.emplace_back(mx::tasking::priority::critical));
+    }
+
+    auto normal_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    pool->push_back_local(&normal_task);
+
+    /// The normal prioritized task has to be withdrawn, although
+    /// critical tasks are still waiting.
+    auto is_normal_task_withdrawn = false;
+    for (auto refill = 0U; refill < 4U && is_normal_task_withdrawn == false; ++refill)
+    {
+        const auto size = pool->withdraw(buffer);
+        for (auto i = 0U; i < size; ++i)
+        {
+            is_normal_task_withdrawn |= buffer.next().get() == &normal_task;
+        }
+    }
+
+    ASSERT_TRUE(is_normal_task_withdrawn);
+    ASSERT_FALSE(pool->empty());
+}
+
+TEST(MxTasking, TaskPoolPushBackRemoteList)
+{
+    auto pool = std::make_unique<mx::tasking::TaskPool>(2U, 0U, 0U);
+    auto buffer = mx::tasking::TaskBuffer<mx::tasking::config::task_buffer_size()>{mx::tasking::PrefetchDistance{0U}};
+
+    auto tasks = std::array<test::mx::tasking::PriorityTask, 3U>{
+        test::mx::tasking::PriorityTask{mx::tasking::priority::normal},
+        test::mx::tasking::PriorityTask{mx::tasking::priority::normal},
+        test::mx::tasking::PriorityTask{mx::tasking::priority::normal}};
+    tasks[0U].next(&tasks[1U]);
+    tasks[1U].next(&tasks[2U]);
+    pool->push_back_remote(&tasks[0U], &tasks[2U], 0U, 1U);
+
+    ASSERT_EQ(pool->withdraw(buffer), 3U);
+    for (auto &task : tasks)
+    {
+        ASSERT_EQ(buffer.next().get(), &task);
+    }
+    ASSERT_TRUE(pool->empty());
+}
+
+TEST(MxTasking, TaskPoolSharedQueue)
+{
+    auto shared_queue = std::make_unique<mx::tasking::NUMASharedTaskQueue>();
+    auto pool = std::make_unique<mx::tasking::TaskPool>(2U, 0U, 0U);
+    auto sibling_pool = std::make_unique<mx::tasking::TaskPool>(2U, 1U, 0U);
+    pool->share(shared_queue.get());
+    sibling_pool->share(shared_queue.get());
+    auto buffer = mx::tasking::TaskBuffer<mx::tasking::config::task_buffer_size()>{mx::tasking::PrefetchDistance{0U}};
+
+    /// Tasks pinned or bound to a worker and tasks spawned by the owner are not shared.
+    auto shared_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    auto pinned_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    auto bound_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    auto local_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    pinned_task.annotate(std::uint16_t(0U));
+    bound_task.annotate(mx::tasking::annotation::bound);
+    pool->push_back_remote(&shared_task, 0U, 1U);
+    pool->push_back_remote(&pinned_task, 0U, 1U);
+    pool->push_back_remote(&bound_task, 0U, 1U);
+    pool->push_back_local(&local_task);
+
+    ASSERT_EQ(sibling_pool->withdraw(buffer), 1U);
+    ASSERT_EQ(buffer.next().get(), &shared_task);
+    ASSERT_TRUE(sibling_pool->empty());
+
+    ASSERT_EQ(pool->withdraw(buffer), 3U);
+    ASSERT_EQ(buffer.next().get(), &local_task);
+    ASSERT_EQ(buffer.next().get(), &pinned_task);
+    ASSERT_EQ(buffer.next().get(), &bound_task);
+    ASSERT_TRUE(pool->empty());
+}
+
+TEST(MxTasking, TaskPoolStealStealableTasks)
+{
+    auto pool = std::make_unique<mx::tasking::TaskPool>(2U, 0U, 0U);
+    auto buffer = mx::tasking::TaskBuffer<mx::tasking::config::task_buffer_size()>{mx::tasking::PrefetchDistance{0U}};
+
+    /// Tasks annotated with a worker id are only stolen when annotated as stealable.
+    auto stealable_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    auto pinned_task = test::mx::tasking::PriorityTask{mx::tasking::priority::normal};
+    stealable_task.annotate(std::uint16_t(0U));
+    stealable_task.annotate(mx::tasking::annotation::stealable);
+    pinned_task.annotate(std::uint16_t(0U));
+    pool->push_back_remote(&stealable_task, 0U, 1U);
+    pool->push_back_remote(&pinned_task, 0U, 1U);
+
+    ASSERT_EQ(pool->steal(buffer), 1U);
+    ASSERT_EQ(buffer.next().get(), &stealable_task);
+    ASSERT_EQ(pool->steal(buffer), 0U);
+
+    ASSERT_EQ(pool->withdraw(buffer), 1U);
+    ASSERT_EQ(buffer.next().get(), &pinned_task);
+    ASSERT_TRUE(pool->empty());
+}
+
+TEST(MxTasking, TaskPoolWithdrawRespectsTaskBufferCapacity)
+{
+    auto pool = std::make_unique<mx::tasking::TaskPool>(1U, 0U, 0U);
+    auto buffer =
+        mx::tasking::TaskBuffer<mx::tasking::config::task_buffer_size()>{mx::tasking::PrefetchDistance{0U}, 8U};
+
+    auto tasks = std::vector<test::mx::tasking::PriorityTask>{};
+    tasks.reserve(16U);
+    for (auto i = 0U; i < 16U; ++i)
+    {
+        pool->push_back_local(&tasks.emplace_back(mx::tasking::priority::normal));
+    }
+
+    /// The buffer holds no more tasks than its capacity, although more tasks are waiting.
+    ASSERT_EQ(buffer.max_size(), 8U);
+    ASSERT_EQ(pool->withdraw(buffer), 8U);
+    ASSERT_EQ(buffer.available_slots(), 0U);
+    ASSERT_FALSE(pool->empty());
+}